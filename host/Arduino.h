@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string>
+#include <algorithm>
+
+// The part of the Arduino core the firmware uses, for the native env in
+// platformio.ini. Time comes from the host's steady clock, Serial writes to
+// stdout and never has input, and the button reads as released.
+
+using std::abs;
+typedef uint8_t byte;
+
+#define LOW 0
+#define HIGH 1
+#define INPUT_PULLUP 2
+#define CHANGE 3
+#define A0 36
+#define IRAM_ATTR
+#define digitalPinToInterrupt(pin) (pin)
+
+class String {
+public:
+  String() {}
+  String(const char* text) : text(text ? text : "") {}
+  String(const std::string& text) : text(text) {}
+  String(int value) : text(std::to_string(value)) {}
+
+  unsigned int length() const { return text.size(); }
+  const char* c_str() const { return text.c_str(); }
+  bool reserve(unsigned int size) { text.reserve(size); return true; }
+  char charAt(unsigned int index) const { return text[index]; }
+  char operator[](unsigned int index) const { return text[index]; }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t found = text.find(c, from);
+    return found == std::string::npos ? -1 : (int)found;
+  }
+  String substring(unsigned int begin, unsigned int end) const { return String(text.substr(begin, end - begin)); }
+  String substring(unsigned int begin) const { return String(text.substr(begin)); }
+  void trim() {
+    size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+      text.clear();
+      return;
+    }
+    text.erase(text.find_last_not_of(" \t\r\n") + 1);
+    text.erase(0, first);
+  }
+
+  String& operator+=(const char* other) { text += other; return *this; }
+  String& operator+=(const String& other) { text += other.text; return *this; }
+  String& operator+=(char c) { text += c; return *this; }
+  bool operator==(const String& other) const { return text == other.text; }
+  bool operator!=(const String& other) const { return text != other.text; }
+
+private:
+  std::string text;
+};
+
+class HardwareSerial {
+public:
+  void begin(unsigned long baud) {}
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char* text) { return fputs(text, stdout) < 0 ? 0 : strlen(text); }
+  size_t print(const String& text) { return print(text.c_str()); }
+  size_t println(const char* text = "") { return print(text) + print("\n"); }
+  size_t println(const String& text) { return println(text.c_str()); }
+  size_t write(uint8_t value) { return fputc(value, stdout) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* data, size_t length) { return fwrite(data, 1, length, stdout); }
+  int available() { return 0; }
+  int read() { return -1; }
+  int availableForWrite() { return 64; }
+  void flush() { fflush(stdout); }
+};
+
+extern HardwareSerial Serial;
+
+// C linkage, like the Arduino core, so the diagnostics' --wrap flags apply
+extern "C" unsigned long millis();
+extern "C" unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// The sketch
+void setup();
+void loop();
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+inline void attachInterrupt(int interrupt, void (*handler)(), int mode) {}
@@ -0,0 +1,122 @@
+#pragma once
+#include <Arduino.h>
+
+// The part of FastLED the firmware uses, for the native env in platformio.ini.
+// Colors use the same layout as FastLED, but HSV is converted with the plain
+// spectrum formula rather than FastLED's rainbow, so frames differ slightly
+// from the device's and golden frame hashes are recorded per platform.
+// show() writes nothing.
+
+#define FASTLED_VERSION 3010001
+
+struct CHSV {
+  uint8_t h, s, v;
+  CHSV() : h(0), s(0), v(0) {}
+  CHSV(uint8_t h, uint8_t s, uint8_t v) : h(h), s(s), v(v) {}
+};
+
+struct CRGB {
+  union {
+    struct { uint8_t r, g, b; };
+    uint8_t raw[3];
+  };
+
+  enum HTMLColorCode {
+    Black = 0x000000,
+    Blue = 0x0000FF,
+    Green = 0x008000,
+    Orange = 0xFFA500,
+    Red = 0xFF0000,
+    White = 0xFFFFFF
+  };
+
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+  CRGB(uint32_t code) : r((code >> 16) & 0xFF), g((code >> 8) & 0xFF), b(code & 0xFF) {}
+  CRGB(HTMLColorCode code) : CRGB((uint32_t)code) {}
+  CRGB(const CHSV& hsv) { setHSV(hsv.h, hsv.s, hsv.v); }
+  CRGB& operator=(const CHSV& hsv) { return setHSV(hsv.h, hsv.s, hsv.v); }
+
+  CRGB& setHSV(uint8_t hue, uint8_t sat, uint8_t val) {
+    uint8_t region = hue / 43;
+    uint8_t rest = (hue - region * 43) * 6;
+    uint8_t p = (val * (255 - sat)) >> 8;
+    uint8_t q = (val * (255 - ((sat * rest) >> 8))) >> 8;
+    uint8_t t = (val * (255 - ((sat * (255 - rest)) >> 8))) >> 8;
+    switch (region) {
+      case 0: r = val; g = t; b = p; break;
+      case 1: r = q; g = val; b = p; break;
+      case 2: r = p; g = val; b = t; break;
+      case 3: r = p; g = q; b = val; break;
+      case 4: r = t; g = p; b = val; break;
+      default: r = val; g = p; b = q; break;
+    }
+    return *this;
+  }
+
+  CRGB& fadeToBlackBy(uint8_t fade) {
+    r = r * (255 - fade) / 255;
+    g = g * (255 - fade) / 255;
+    b = b * (255 - fade) / 255;
+    return *this;
+  }
+
+  bool operator==(const CRGB& other) const { return r == other.r && g == other.g && b == other.b; }
+  bool operator!=(const CRGB& other) const { return !(*this == other); }
+  uint8_t& operator[](int index) { return raw[index]; }
+  const uint8_t& operator[](int index) const { return raw[index]; }
+};
+
+enum EOrder { RGB, GRB };
+template <uint8_t PIN, EOrder ORDER> struct WS2812Controller800Khz {};
+
+class CLEDController {
+public:
+  CLEDController() : data(nullptr), count(0) {}
+  void setLeds(CRGB* leds, int length) { data = leds; count = length; }
+  CRGB* leds() { return data; }
+  int size() { return count; }
+
+private:
+  CRGB* data;
+  int count;
+};
+
+class CFastLED {
+public:
+  CFastLED() : controllerCount(0), brightness(255) {}
+
+  template <template <uint8_t, EOrder> class CHIPSET, uint8_t PIN, EOrder ORDER>
+  CLEDController& addLeds(CRGB* leds, int count) {
+    CLEDController& controller = controllers[controllerCount < MAX_CONTROLLERS ? controllerCount++ : MAX_CONTROLLERS - 1];
+    controller.setLeds(leds, count);
+    return controller;
+  }
+
+  CLEDController& operator[](int index) { return controllers[index]; }
+  int count() { return controllerCount; }
+  void setBrightness(uint8_t value) { brightness = value; }
+  uint8_t getBrightness() { return brightness; }
+  void show() {}
+
+private:
+  static const int MAX_CONTROLLERS = 8;
+  CLEDController controllers[MAX_CONTROLLERS];
+  int controllerCount;
+  uint8_t brightness;
+};
+
+extern CFastLED FastLED;
+
+inline void fill_solid(CRGB* leds, int count, const CRGB& color) {
+  for (int i = 0; i < count; i++) leds[i] = color;
+}
+
+// FastLED's 16-bit generator, so seeded runs repeat
+uint16_t& random16_seed();
+inline void random16_set_seed(uint16_t seed) { random16_seed() = seed; }
+inline uint8_t random8() {
+  uint16_t& seed = random16_seed();
+  seed = seed * 2053 + 13849;
+  return (uint8_t)((seed & 0xFF) + (seed >> 8));
+}
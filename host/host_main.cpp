@@ -0,0 +1,32 @@
+// Entry point of the native build. With no arguments it runs the firmware as
+// the board would. Otherwise each argument is a serial diagnostic command
+// (such as B, R, G, g, S or O), run in order once setup has finished; the
+// exit status is 1 if any of them failed. H, which only exists here, runs the
+// render host (render_host.h).
+#ifndef PIO_UNIT_TESTING
+#include <Arduino.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "render_host.h"
+
+extern void setup_firmware();
+extern bool run_diagnostic(char command);
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    setup();
+    for (;;) loop();
+  }
+
+  setup_firmware();
+  bool failed = false;
+  for (int i = 1; i < argc; i++) {
+    bool passed = argv[i][0] == RENDER_HOST_COMMAND ? RenderHost::run() : run_diagnostic(argv[i][0]);
+    if (!passed) failed = true;
+  }
+
+  // Segment workers are still running; leave without tearing down globals under them
+  fflush(stdout);
+  _exit(failed ? 1 : 0);
+}
+#endif
@@ -0,0 +1,257 @@
+#include "render_host.h"
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+#include "content_manager.h"
+#include "display_controller.h"
+#include "frame_stream.h"
+#include "scenario_replay.h"
+#include "segment_renderer.h"
+#include "space_animation.h"
+#include "transition_effects.h"
+#include "virtual_clock.h"
+
+extern CRGB* leds;
+extern DisplayController displayController;
+
+// One display as its worker sees it
+struct RenderedDisplay {
+  CRGB* frame;
+  ContentManager content;
+  TransitionEffect* transition;  // Text displays
+  SpaceAnimation* space;         // The rest
+  FrameStreamEncoder* encoder;
+  int stream;                    // Write end of the pipe to the device
+};
+
+// One display as the device end sees it
+struct SimulatedDevice {
+  CRGB* frame;
+  FrameStreamDecoder* decoder;
+  int stream;                    // Read end, -1 once the worker closed it
+};
+
+static uint8_t streamIdFor(int display) {
+  return display % FRAME_STREAM_BROADCAST_ID;
+}
+
+static unsigned long long processCpuMicros() {
+  timespec now;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+  return (unsigned long long)now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+static bool writeAll(int fd, const uint8_t* data, size_t length) {
+  while (length > 0) {
+    ssize_t written = write(fd, data, length);
+    if (written <= 0) return false;
+    data += written;
+    length -= written;
+  }
+  return true;
+}
+
+static void setUpDisplay(RenderedDisplay& display, int index) {
+  int ledCount = g_topology.getLedCount();
+  const ContentManager& stories = displayController.getContentManager();
+
+  display.frame = new CRGB[ledCount]();
+  leds = display.frame;
+  for (int i = 0; i < stories.getStoryCount(); i++) {
+    display.content.addStory(stories.getStory(i), stories.getStoryFontId(i));
+  }
+  display.content.selectStory(index % stories.getStoryCount());
+  display.content.setColorMode(static_cast<ColorMode>(index % 4));
+
+  // Spread the displays over the space animation and every transition
+  display.transition = nullptr;
+  display.space = nullptr;
+  if (index % RENDER_HOST_SPACE_EVERY == RENDER_HOST_SPACE_EVERY - 1) {
+    display.space = new SpaceAnimation();
+    display.space->reset();
+  } else {
+    TransitionType type = static_cast<TransitionType>(index % TransitionFactory::getImplementedCount());
+    display.transition = TransitionFactory::createTransition(type);
+    display.transition->reset();
+  }
+  display.encoder = new FrameStreamEncoder(ledCount, streamIdFor(index));
+  display.encoder->setKeyframeInterval(FRAME_STREAM_KEYFRAME_INTERVAL);
+}
+
+// Body of a worker process: render and send every frame of displays
+// [first, first + count), then leave the last frames and the CPU time spent
+// in the shared results
+static void renderWorker(int first, int count, unsigned long frames, const int* streams,
+                         CRGB* lastFrames, unsigned long long* cpuMicros) {
+  g_segmentRenderer.setEnabled(false); // Its worker threads were not forked along
+  suspend_output(true);                // Frames go to the devices, not the firmware's sinks
+  VirtualClock::start(SCENARIO_CLOCK_START_MICROS);
+  randomSeed(SCENARIO_SEED + first);
+  random16_set_seed(SCENARIO_SEED + first);
+
+  std::vector<RenderedDisplay> displays(count);
+  size_t capacity = 0;
+  for (int i = 0; i < count; i++) {
+    setUpDisplay(displays[i], first + i);
+    displays[i].stream = streams[i];
+    if (displays[i].encoder->maxPacketSize() > capacity) capacity = displays[i].encoder->maxPacketSize();
+  }
+  uint8_t* packet = new uint8_t[capacity];
+
+  unsigned long long start = processCpuMicros();
+  for (unsigned long frame = 0; frame < frames; frame++) {
+    for (int i = 0; i < count; i++) {
+      RenderedDisplay& display = displays[i];
+      leds = display.frame;
+      if (display.space) {
+        display.space->update();
+        display.space->render();
+      } else {
+        display.transition->update(display.content);
+      }
+      size_t length = display.encoder->encode(reinterpret_cast<const uint8_t*>(display.frame), packet, capacity);
+      if (!writeAll(display.stream, packet, length)) _exit(1);
+    }
+    VirtualClock::advance(1000000UL / RENDER_HOST_FPS);
+  }
+  *cpuMicros = processCpuMicros() - start;
+
+  int ledCount = g_topology.getLedCount();
+  for (int i = 0; i < count; i++) {
+    memcpy(lastFrames + (size_t)(first + i) * ledCount, displays[i].frame, sizeof(CRGB) * ledCount);
+    close(displays[i].stream);
+  }
+  fflush(stdout);
+  _exit(0);
+}
+
+bool RenderHost::run(int displayCount, int workerCount, unsigned long frames, RenderHostResult& result) {
+  if (workerCount <= 0) workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (workerCount > displayCount) workerCount = displayCount;
+  if (workerCount < 1) workerCount = 1;
+  memset(&result, 0, sizeof(result));
+  result.displays = displayCount;
+  result.workers = workerCount;
+  result.frames = frames;
+
+  // The workers' results come back through memory shared across the fork
+  int ledCount = g_topology.getLedCount();
+  size_t sharedSize = sizeof(unsigned long long) * workerCount + sizeof(CRGB) * ledCount * displayCount;
+  void* shared = mmap(nullptr, sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (shared == MAP_FAILED) return false;
+  unsigned long long* cpuMicros = static_cast<unsigned long long*>(shared);
+  CRGB* lastFrames = reinterpret_cast<CRGB*>(cpuMicros + workerCount);
+
+  std::vector<SimulatedDevice> devices(displayCount);
+  std::vector<pid_t> workers;
+  bool started = true;
+  fflush(stdout); // Or the workers print it again
+  for (int w = 0; w < workerCount && started; w++) {
+    int first = displayCount * w / workerCount;
+    int count = displayCount * (w + 1) / workerCount - first;
+
+    // A pipe per display, so each device only sees its own stream
+    std::vector<int> writeEnds(count);
+    for (int i = 0; i < count; i++) {
+      int ends[2];
+      if (pipe(ends) != 0) {
+        started = false;
+        count = i;
+        break;
+      }
+      SimulatedDevice& device = devices[first + i];
+      device.frame = new CRGB[ledCount]();
+      device.decoder = new FrameStreamDecoder(reinterpret_cast<uint8_t*>(device.frame), ledCount, streamIdFor(first + i));
+      device.stream = ends[0];
+      writeEnds[i] = ends[1];
+    }
+    if (!started) break;
+
+    pid_t pid = fork();
+    if (pid == 0) renderWorker(first, count, frames, writeEnds.data(), lastFrames, &cpuMicros[w]);
+    if (pid < 0) started = false;
+    else workers.push_back(pid);
+    for (int i = 0; i < count; i++) {
+      close(writeEnds[i]); // The device sees the end of its stream once the worker closes its copy
+    }
+  }
+
+  // Play the devices: feed each stream to its decoder until every worker is done
+  std::vector<pollfd> open;
+  std::vector<int> openDevice;
+  uint8_t chunk[4096];
+  while (true) {
+    open.clear();
+    openDevice.clear();
+    for (int i = 0; i < displayCount; i++) {
+      if (devices[i].decoder && devices[i].stream >= 0) {
+        pollfd entry = { devices[i].stream, POLLIN, 0 };
+        open.push_back(entry);
+        openDevice.push_back(i);
+      }
+    }
+    if (open.empty()) break;
+    if (poll(open.data(), open.size(), -1) < 0) break;
+    for (size_t i = 0; i < open.size(); i++) {
+      if (!open[i].revents) continue;
+      SimulatedDevice& device = devices[openDevice[i]];
+      ssize_t length = read(device.stream, chunk, sizeof(chunk));
+      if (length <= 0) {
+        close(device.stream);
+        device.stream = -1;
+        continue;
+      }
+      result.bytesSent += length;
+      for (ssize_t b = 0; b < length; b++) {
+        device.decoder->feed(chunk[b]);
+      }
+    }
+  }
+
+  for (size_t w = 0; w < workers.size(); w++) {
+    int status = 0;
+    if (waitpid(workers[w], &status, 0) != workers[w] || !WIFEXITED(status) || WEXITSTATUS(status) != 0) started = false;
+  }
+
+  result.framesMatch = started;
+  for (int i = 0; i < displayCount; i++) {
+    SimulatedDevice& device = devices[i];
+    if (!device.decoder) {
+      result.framesMatch = false;
+      continue;
+    }
+    result.framesApplied += device.decoder->getFramesApplied();
+    result.framesDropped += device.decoder->getFramesDropped();
+    result.checksumErrors += device.decoder->getChecksumErrors();
+    if (memcmp(device.frame, lastFrames + (size_t)i * ledCount, sizeof(CRGB) * ledCount) != 0) {
+      result.framesMatch = false;
+    }
+    delete device.decoder;
+    delete[] device.frame;
+  }
+  for (int w = 0; w < workerCount; w++) {
+    result.cpuMicros += cpuMicros[w];
+  }
+  munmap(shared, sharedSize);
+
+  unsigned long displayFrames = (unsigned long)displayCount * frames;
+  float cpuPerFrame = displayFrames > 0 ? (float)result.cpuMicros / displayFrames : 0;
+  result.displaysPerCore = cpuPerFrame > 0 ? 1000000.0f / (cpuPerFrame * RENDER_HOST_FPS) : 0;
+
+  Serial.printf("{\"displays\":%d,\"workers\":%d,\"frames\":%lu,\"fps\":%d,\"bytes_per_frame\":%lu,\"cpu_us_per_frame\":%.1f,"
+                "\"displays_per_core\":%.1f,\"frames_applied\":%lu,\"frames_dropped\":%lu,\"checksum_errors\":%lu,"
+                "\"frames_match\":%s}\n",
+                result.displays, result.workers, result.frames, RENDER_HOST_FPS,
+                displayFrames > 0 ? result.bytesSent / displayFrames : 0UL, cpuPerFrame, result.displaysPerCore,
+                result.framesApplied, result.framesDropped, result.checksumErrors, result.framesMatch ? "true" : "false");
+  return result.framesMatch;
+}
+
+bool RenderHost::run(int displays, int workers, unsigned long frames) {
+  RenderHostResult result;
+  return run(displays, workers, frames, result);
+}
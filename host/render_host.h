@@ -0,0 +1,53 @@
+#pragma once
+#include <Arduino.h>
+
+// Render host configuration constants
+#define RENDER_HOST_COMMAND 'H'          // host_main argument that runs the render host
+#define RENDER_HOST_DISPLAYS 32          // Simulated displays driven by one run
+#define RENDER_HOST_WORKERS 0            // Worker processes; 0 for one per core
+#define RENDER_HOST_FRAMES 300           // Frames rendered for every display
+#define RENDER_HOST_FPS 30               // Rate each display is rendered at, for displays per core
+#define RENDER_HOST_SPACE_EVERY 4        // Every 4th display shows the space animation, the rest text
+
+struct RenderHostResult {
+  int displays;
+  int workers;
+  unsigned long frames;           // Per display
+  unsigned long bytesSent;        // Every packet to every display
+  unsigned long framesApplied;    // By the simulated devices, all displays together
+  unsigned long framesDropped;
+  unsigned long checksumErrors;
+  bool framesMatch;               // Every device ended on its renderer's last frame
+  unsigned long long cpuMicros;   // Rendering and encoding, all workers together
+  float displaysPerCore;          // At RENDER_HOST_FPS
+};
+
+// Renders frames for many displays at once and streams each its own frame
+// stream (frame_stream.h), as a host driving a wall of thin displays would.
+//
+// The displays are shared out over a pool of worker processes. The renderers
+// draw through the firmware's process-wide state - leds[], random() and the
+// timing points - so a worker is a forked process rather than a thread; it
+// keeps one LED buffer, one ContentManager and one transition or space
+// animation per display and points leds[] at each display's buffer in turn.
+// Every display has its own pipe to a simulated device, a FrameStreamDecoder
+// in the parent process, as it would have its own socket to a real one.
+//
+// Rendering runs on the virtual clock (virtual_clock.h), one frame period
+// per frame, so frames come out as fast as the workers can make them. The
+// CPU time the workers spent gives the displays one host core can drive at
+// RENDER_HOST_FPS. run() prints one JSON line, e.g.
+//
+//   {"displays":32,"workers":4,"frames":300,"fps":30,"bytes_per_frame":2410,"cpu_us_per_frame":96,
+//    "displays_per_core":347.2,"frames_applied":9600,"frames_dropped":0,"checksum_errors":0,"frames_match":true}
+//
+// Host builds only; the stories, topology and fonts are the firmware's, so
+// setup_firmware() must have run.
+class RenderHost {
+public:
+  // False if a worker could not be started or a device did not end on the
+  // frame its renderer drew. workers 0 means one per core.
+  static bool run(int displays, int workers, unsigned long frames, RenderHostResult& result);
+  static bool run(int displays = RENDER_HOST_DISPLAYS, int workers = RENDER_HOST_WORKERS,
+                  unsigned long frames = RENDER_HOST_FRAMES);
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <Arduino.h>
+#include "diagnostic_hooks.h"
+
+// Heap allocation counting. In diagnostic builds malloc, calloc, realloc and
+// free are routed through hooks by the linker (see diagnostic_hooks.h), so
+// String, std::vector and new are all seen; production builds count nothing. Allocations made straight through
+// heap_caps_malloc (FreeRTOS, WiFi) bypass the hooks; the report's free heap
+// and largest block still reflect them.
+
+// Allocation tracking configuration constants
+#define ENABLE_ALLOCATION_TRACKING DIAGNOSTIC_HOOKS
+#define ALLOCATION_CHECK false         // Report every steady-state frame that allocates
+#define ALLOCATION_WARMUP_FRAMES 60    // Frames after a mode or transition change that may still allocate
+#define MAX_ALLOCATION_SITES 8         // Mode/transition pairs broken out in one report window
+
+struct AllocationCount {
+  unsigned long allocations = 0;
+  unsigned long bytes = 0;
+};
+
+class AllocationTracker {
+public:
+  // From the first call, allocations made on the calling task are also counted
+  // on their own, so a frame is not charged for what other tasks allocate
+  static void watchCurrentTask();
+
+  // Counters only grow; callers difference them
+  static AllocationCount watched();
+  static AllocationCount watchedSince(const AllocationCount& start);
+  static AllocationCount total();
+  static unsigned long frees();
+
+  // Free heap, its low-water mark since boot and the largest free block;
+  // 0 where the platform cannot tell
+  static unsigned long freeHeap();
+  static unsigned long minimumFreeHeap();
+  static unsigned long largestFreeBlock();
+
+  // Called by the hooks
+  static void onAllocate(size_t bytes);
+  static void onFree();
+};
@@ -2,6 +2,8 @@
 #include <Arduino.h>
 #include <FastLED.h>
 #include <vector>
+#include "font.h"
+#include "topology.h"
 
 // Color mode enumeration
 enum class ColorMode {
@@ -17,22 +19,30 @@ public:
   ContentManager();
   
   // Story management
-  void addStory(const String& story);
+  void addStory(const String& story, FontId font = DEFAULT_FONT);
   void selectRandomStory();
   void selectStory(int index);
-  String getCurrentStory() const;
+  const String& getCurrentStory() const;
+  const String& getStory(int index) const { return stories[index]; }
   int getCurrentStoryIndex() const { return currentStoryIndex; }
   int getStoryCount() const { return stories.size(); }
   
+  // Each story is drawn in its own font, which can be changed at any time
+  void setStoryFont(int index, FontId font);
+  FontId getStoryFontId(int index) const { return storyFonts[index]; }
+  const Font& getStoryFont(int index) const { return getFont(storyFonts[index]); }
+  const Font& getCurrentFont() const;
+  
   // Text processing for scroll modes
   char getCharacterAt(int position) const;
   bool isAtStoryEnd(int position) const;
   int getStoryLength() const;
   
-  // Line-based processing for line modes
-  std::vector<String> extractLines(const String& story) const;
-  std::vector<String> getCurrentLines();
-  void refreshCurrentLines();
+  // Line-based processing for line modes. Lines are split once per story in
+  // addStory(), so switching stories costs no allocations. Proportional text
+  // wraps at the display width in columns of the story's font.
+  std::vector<String> extractLines(const String& story, const Font& font = getFont(DEFAULT_FONT)) const;
+  const std::vector<String>& getCurrentLines() const;
   
   // Color management
   void setColorMode(ColorMode mode) { currentColorMode = mode; }
@@ -40,28 +50,32 @@ public:
   void randomizeColorMode();
   const char* getColorModeName() const;
   
+  // Time-varying colors (Single Color hue drift) make a held frame stale.
+  // The epoch changes whenever colors may have changed; 0 when they never do.
+  unsigned long getColorEpoch() const;
+  unsigned long getNextColorChange() const; // millis() deadline of the next epoch
+  
   // Color generation based on current mode
   CRGB getCharacterColor(const String& text, int position, int scrollPosition = 0) const;
   CRGB getWordColor(const String& text, int position) const; // Legacy method
   
   // Navigation
-  void reset();
   bool hasNewlineAt(int position) const;
   int findNextPrintableChar(int startPos) const;
   
 private:
   std::vector<String> stories;
+  std::vector<std::vector<String>> storyLines; // Indexed like stories
+  std::vector<FontId> storyFonts;
   int currentStoryIndex;
-  std::vector<String> currentLines;
-  bool linesNeedRefresh;
   ColorMode currentColorMode;
   
   // Helper functions
+  int charsThatFit(const String& line, const Font& font) const; // Leading characters of a line that fit the display
   String smartWordWrap(const String& line, int maxWidth) const;
   String padToWidth(const String& line, int width) const;
 };
 
 // Constants for display parameters
-#define NUM_CHARS 32
 #define CPS_TARGET 15.0
 #define LINE_TRANSITION_SMOOTH true 
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+// Link-time hooks for diagnostics. The diagnostics and native envs in
+// platformio.ini wrap malloc, calloc, realloc, free, millis and micros with
+// the linker's --wrap option and set DIAGNOSTIC_HOOKS to match. Production
+// firmware calls them directly: allocations go uncounted and there is no
+// simulated time, so scenario replay, golden frames and the soak test refuse
+// to run.
+#ifndef DIAGNOSTIC_HOOKS
+#define DIAGNOSTIC_HOOKS 0
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "font.h"
+
+// Forward declarations
+extern CRGB* leds;
+extern void write_character(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset);
+extern void show_frame();
+extern void clear_frame();
+extern void set_output_length(int count); // LEDs the output writes, from the start of the chain
+extern void force_next_frame();           // Send the next frame even if it matches the last one
+
+// Throughput benchmark configuration constants
+#define BENCHMARK_PATTERNS 4          // Blank, solid, text, noise
+#define BENCHMARK_LENGTHS 3           // Quarter, half and the full chain
+#define BENCHMARK_CONFIGS (BENCHMARK_PATTERNS * BENCHMARK_LENGTHS)
+#define BENCHMARK_WARMUP_FRAMES 5     // Frames per configuration that are not measured
+#define BENCHMARK_FRAMES 60           // Measured frames per configuration
+
+// One row of the summary table
+struct BenchmarkResult {
+  const char* pattern;
+  int ledCount;
+  unsigned long frames;
+  unsigned long elapsedMicros;  // First to last measured frame
+  unsigned long renderMicros;   // Total spent drawing the pattern
+  unsigned long shows;          // FastLED.show() calls seen by the performance monitor
+  unsigned long showMicros;
+};
+
+// Sweeps frame content and effective chain length, running each configuration
+// back to back as fast as the output allows. Each sweep logs a table of
+// render time, FastLED.show() time and achieved FPS per configuration, next to
+// the show time the output timing model predicts for the same number of LEDs.
+class DisplayBenchmark {
+public:
+  DisplayBenchmark();
+
+  // Start a new sweep; restores the full chain length
+  void reset();
+
+  // Render and show one benchmark frame
+  void update();
+
+private:
+  int config;
+  int outputLength;  // LEDs the output currently writes
+  int frame;
+  unsigned long measureStart;
+  unsigned long showCountStart;
+  unsigned long showMicrosStart;
+  BenchmarkResult results[BENCHMARK_CONFIGS];
+
+  void setOutputLength(int count);
+  void beginConfig();
+  void endConfig();
+  void renderPattern(int pattern);
+  void logResults();
+};
@@ -4,89 +4,174 @@
 #include "content_manager.h"
 #include "transition_effects.h"
 #include "space_animation.h"
+#include "frame_stream.h"
+#include "display_benchmark.h"
+#include "quality_controller.h"
 
 // Display modes
 enum class DisplayMode {
   TEXT_CONTENT = 0,    // Show text content with transitions
   SPACE_ANIMATION = 1, // Show space animation
   COLOR_SHOW = 2,      // Original color show mode
-  TEST_PATTERNS = 3    // Original test patterns
+  TEST_PATTERNS = 3,   // Original test patterns
+  BENCHMARK = 4,       // Measure refresh throughput across content and chain lengths
+  STREAM_RECEIVER = 5  // Show frames streamed from a render host
 };
+#define NUM_DISPLAY_MODES 6
 
-// Display controller manages content, transitions, and modes
+// Button gestures, produced by whichever context samples the button
+enum class InputEvent : uint8_t {
+  NONE = 0,
+  SHORT_PRESS = 1,
+  LONG_PRESS = 2
+};
+
+// Scheduling contract each display mode declares to the controller
+struct ModeSchedule {
+  unsigned long frameInterval;   // Cadence: minimum milliseconds between frames (0 = every loop)
+  unsigned long frameCostMicros; // Expected cost of one frame, refined from measurements
+};
+
+// Display controller manages content, transitions, and modes. It owns the frame
+// loop: every call to update() is one frame that polls input, runs the active
+// mode when its cadence is due, and fits background work (reporting, auto
+// cycling) into whatever is left of the frame budget.
 class DisplayController {
 public:
   DisplayController();
   ~DisplayController();
-  
+
   // Initialization
   void initialize();
-  
-  // Main update loop
-  void update();
-  
-  // Mode management  
+
+  // Main update loop; returns true if the active mode ran this frame
+  bool update();
+
+  // millis() deadline of the next frame that can change the display, and
+  // whether the wait may use light sleep (serial input and WiFi need the CPU)
+  unsigned long getNextWakeTime() const;
+  bool canLightSleep() const;
+
+  // When input and reporting run in their own context (see task_runner.h) the
+  // frame loop skips them; that context samples the button and forwards events
+  void setInlineInput(bool enabled) { inlineInput = enabled; }
+  void setInlineReporting(bool enabled) { inlineReporting = enabled; }
+  bool getInlineInput() const { return inlineInput; }
+  bool getInlineReporting() const { return inlineReporting; }
+  InputEvent sampleButton();
+  void handleInput(InputEvent event);
+
+  // Mode management
   void setDisplayMode(DisplayMode mode);
   DisplayMode getDisplayMode() const { return currentMode; }
-  int getDisplayModeCount() const { return 4; }
+  int getDisplayModeCount() const { return NUM_DISPLAY_MODES; }
   const char* getDisplayModeName() const;
-  
+  const ModeSchedule& getModeSchedule(DisplayMode mode) const { return schedules[static_cast<int>(mode)]; }
+
   // Transition management (for text content mode)
   void setTransitionType(TransitionType type);
   TransitionType getTransitionType() const;
   const char* getTransitionName() const;
   int getTransitionCount() const;
   void cycleThroughTransitions();
-  
+
   // Content management
   ContentManager& getContentManager() { return contentManager; }
-  
+  void cycleStoryFont(); // Next registered font for the current story
+
   // Space animation access
   SpaceAnimation& getSpaceAnimation() { return spaceAnimation; }
-  
+
+  // Effect detail shed under load (see quality_controller.h)
+  QualityController& getQualityController() { return quality; }
+
   // Configuration
   void setSmoothTransitions(bool smooth);
   bool getSmoothTransitions() const { return smoothTransitions; }
-  
+  void setAutoTransitionCycling(bool enabled) { autoTransitionCycling = enabled; }
+
   // Button handling
   void handleShortPress();
   void handleLongPress();
-  
+
   // Reset current mode
   void reset();
-  
+
 private:
   // Core components
   ContentManager contentManager;
-  std::unique_ptr<TransitionEffect> currentTransition;
+  std::unique_ptr<TransitionEffect> transitions[NUM_TRANSITION_TYPES]; // Created on first use, then reused
+  TransitionEffect* currentTransition;
   SpaceAnimation spaceAnimation;
-  
+  std::unique_ptr<FrameStreamDecoder> streamDecoder;
+  DisplayBenchmark benchmark;
+  QualityController quality;
+
   // State
   DisplayMode currentMode;
   TransitionType currentTransitionType;
   bool smoothTransitions;
-  
+
   // Transition cycling
   unsigned long lastTransitionChange;
   unsigned long transitionChangeInterval; // Auto-cycle transitions every N seconds
   bool autoTransitionCycling;
-  
+
+  // Frame scheduling
+  ModeSchedule schedules[NUM_DISPLAY_MODES];
+  unsigned long lastModeFrame;
+  int deferredReports;
+  bool inlineInput;
+  bool inlineReporting;
+  unsigned long feedbackUntil; // Mode frames are held while button feedback is showing
+
+  // Button state
+  unsigned long buttonPressTime;
+  bool longPressActive;
+
+  // Color show state (non-blocking)
+  enum ColorShowPhase { COLOR_FILL, COLOR_HOLD, COLOR_FADE };
+  ColorShowPhase colorPhase;
+  int colorIndex;
+  int colorHue;
+  unsigned long colorPhaseTime;
+
+  // Test pattern state (non-blocking)
+  int testX;
+  int testY;
+  bool testPixelOn;
+  unsigned long testStepTime;
+
   // Mode-specific update functions
   void updateTextContent();
   void updateSpaceAnimation();
   void updateColorShow();
   void updateTestPatterns();
-  
-  // Original functions (from main.cpp)
-  void color_show();
-  void test_patterns();
-  
+  void updateStreamReceiver();
+
+  // Frame loop stages
+  bool isModeDue(unsigned long now) const;
+  unsigned long getFrameInterval() const; // Declared cadence, stretched at low quality
+  void runModeFrame();
+  void runBackgroundWork(unsigned long frameStart, bool beforeMode);
+
   // Helper functions
   void createTransition(TransitionType type);
+  void applyQuality();
+  void resetModeState();
   const char* getDisplayModeNameFor(DisplayMode mode) const;
 };
 
 // Configuration constants
-#define NUM_DISPLAY_MODES 4
 #define AUTO_TRANSITION_CYCLE_INTERVAL 15000 // milliseconds (15 seconds)
-#define ENABLE_AUTO_TRANSITION_CYCLING false 
\ No newline at end of file
+#define ENABLE_AUTO_TRANSITION_CYCLING false
+#define FRAME_BUDGET_MICROS 40000            // Target frame time (25 FPS)
+#define BACKGROUND_COST_MICROS 8000          // Expected cost of a performance report
+#define MAX_DEFERRED_REPORTS 100             // Frames a due report may wait for budget
+#define LONG_PRESS_TIME 1000                 // milliseconds
+#define BUTTON_FEEDBACK_TIME 300             // milliseconds
+#define BUTTON_POLL_INTERVAL 10              // milliseconds between samples while the button is held
+#define STREAM_POLL_INTERVAL 5               // milliseconds; drains serial before the UART buffer fills
+#define FONT_CYCLE_COMMAND 'F'               // Serial command that switches the current story's font
+#define BUTTON_PIN 0
+#define MAX_BRIGHTNESS 24
@@ -0,0 +1,157 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include <stdio.h>
+#include "frame_stream.h"
+
+// Frame sink configuration constants
+#define FRAME_SINK_MAX 4                     // Sinks the output hands each frame to
+#define FRAME_SINK_SKIP_UNCHANGED true       // LEDs keep their colors; don't resend identical frames
+#define FRAME_SINK_RECORD_PATH nullptr       // Host builds: record every frame to this file
+#define FRAME_SINK_NETWORK false             // Broadcast frames to stream receivers over UDP
+#define FRAME_SINK_NETWORK_PORT 4211
+#define FRAME_SINK_NETWORK_DISPLAY_ID FRAME_STREAM_BROADCAST_ID
+
+struct FrameInfo {
+  unsigned long sequence;
+  bool changed;  // False when the frame is identical to the one before it
+};
+
+// Somewhere finished frames go. show_frame() hands each frame to every sink
+// in turn through g_frameOutput. The frame is the output buffer itself and is
+// only valid during write(); a sink that needs it later copies what it needs.
+class FrameSink {
+public:
+  virtual ~FrameSink() = default;
+
+  // Also the name of the sink's spans in the trace
+  virtual const char* getName() const = 0;
+
+  // False when the sink left the frame out
+  virtual bool write(const CRGB* frame, int count, const FrameInfo& info) = 0;
+
+  // Only the first count LEDs of the chain are written (the display benchmark sweeps this)
+  virtual void setLength(int count) {}
+};
+
+// The LED chain, through FastLED. One controller per output of the topology,
+// each on its slice of the buffer that frames are written from; FastLED sends
+// them all at once. Unchanged frames are skipped unless the brightness moved.
+class FastLedSink : public FrameSink {
+public:
+  // frame is the buffer later passed to write()
+  explicit FastLedSink(CRGB* frame);
+
+  const char* getName() const override { return "FastLED.show"; }
+  bool write(const CRGB* frame, int count, const FrameInfo& info) override;
+  void setLength(int count) override;
+
+private:
+  CRGB* frame;
+  uint8_t shownBrightness;
+  bool shown;  // A frame went out since the controllers were set up or resized
+};
+
+// Every frame as a binary PPM image in display coordinates, back to back in
+// one file. ffmpeg reads the file as is:
+//   ffmpeg -f image2pipe -c:v ppm -i frames.ppm frames.mp4
+// The row buffer is allocated once; the file is flushed every frame.
+class FrameRecorderSink : public FrameSink {
+public:
+  explicit FrameRecorderSink(FILE* file);
+  ~FrameRecorderSink();
+
+  const char* getName() const override { return "recorder"; }
+  bool write(const CRGB* frame, int count, const FrameInfo& info) override;
+
+private:
+  FILE* file;
+  uint8_t* row;
+};
+
+// Frames encoded as frame stream packets (frame_stream.h) for thin displays.
+// Unchanged frames go out as packets with no spans, so receivers still see
+// the sequence advance. Subclasses move the packets.
+class FrameStreamSink : public FrameSink {
+public:
+  FrameStreamSink(uint16_t pixelCount, uint8_t displayId);
+  ~FrameStreamSink();
+
+  bool write(const CRGB* frame, int count, const FrameInfo& info) override;
+
+  unsigned long getSendFailures() const { return sendFailures; }
+
+protected:
+  virtual bool sendPacket(const uint8_t* packet, size_t length) = 0;
+
+private:
+  FrameStreamEncoder encoder;
+  uint8_t* packet;
+  size_t capacity;
+  unsigned long sendFailures;
+};
+
+#if defined(ESP32)
+#include <WiFiUdp.h>
+
+// Packets broadcast over UDP. WiFi must be connected by the application
+// before packets will flow; frames until then are counted as failures.
+class UdpFrameSink : public FrameStreamSink {
+public:
+  UdpFrameSink(uint16_t pixelCount, uint8_t displayId, uint16_t port)
+    : FrameStreamSink(pixelCount, displayId), port(port) {}
+
+  const char* getName() const override { return "network"; }
+
+protected:
+  bool sendPacket(const uint8_t* packet, size_t length) override;
+
+private:
+  WiFiUDP udp;
+  uint16_t port;
+};
+#endif
+
+// The one place frames leave the firmware. Owns the output buffer the sinks
+// read, which always holds the last frame, so a new frame is compared with it
+// and only copied in when it changed. Times each sink, records it in the
+// trace and the show histogram, and passes the output length on.
+//
+// With one rendering context write() does it all. With the task layer the
+// render task calls stage() and the output task send(), so rendering of the
+// next frame overlaps with the sinks writing out the last one.
+class FrameOutput {
+public:
+  FrameOutput() : frame(nullptr), count(0), forced(true), sinkCount(0) {}
+
+  // Allocates the output buffer; once, before any sinks are added
+  void begin(int count);
+  CRGB* getFrame() const { return frame; }
+
+  // Sinks are kept for the life of the firmware; false when all slots are taken
+  bool addSink(FrameSink* sink);
+
+  // Copy a finished frame into the output buffer unless it matches the one
+  // already there. Returns whether it changed.
+  bool stage(const CRGB* source);
+  // Hand the output buffer to every sink
+  void send(unsigned long sequence, bool changed);
+  // stage() then send()
+  void write(const CRGB* source, unsigned long sequence);
+
+  // The next frame counts as changed even if it matches the last one
+  void forceNext() { forced = true; }
+  void setLength(int count);
+
+  int getSinkCount() const { return sinkCount; }
+  FrameSink* getSink(int index) const { return sinks[index]; }
+
+private:
+  CRGB* frame;
+  int count;
+  bool forced;
+  FrameSink* sinks[FRAME_SINK_MAX];
+  int sinkCount;
+};
+
+extern FrameOutput g_frameOutput;
@@ -0,0 +1,102 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Compact delta-encoded frame stream for driving thin displays from a render host.
+//
+// Packet layout (little endian):
+//   magic 'R' 'F' | version | flags | displayId | sequence:u16 | pixelCount:u16 | payloadLength:u16
+//   payload: repeated spans of  start:u16 | length:u8 | length * RGB
+//   checksum:u8 (xor of header and payload bytes)
+//
+// A keyframe carries every pixel; delta frames only carry the spans that changed
+// since the previous frame. Receivers drop deltas after a sequence gap until the
+// next keyframe arrives. A displayId of 0xFF addresses every receiver.
+//
+// This header only depends on the standard library so the encoder can be reused
+// by a host-side renderer as well as the firmware.
+
+#define FRAME_STREAM_MAGIC_0 'R'
+#define FRAME_STREAM_MAGIC_1 'F'
+#define FRAME_STREAM_VERSION 1
+#define FRAME_STREAM_FLAG_KEYFRAME 0x01
+
+#define FRAME_STREAM_HEADER_SIZE 11
+#define FRAME_STREAM_BROADCAST_ID 0xFF
+#define FRAME_STREAM_SPAN_HEADER_SIZE 3
+#define FRAME_STREAM_MAX_SPAN_LENGTH 255
+
+// Encodes successive frames for one display into packets
+class FrameStreamEncoder {
+public:
+  FrameStreamEncoder(uint16_t pixelCount, uint8_t displayId = 0);
+  ~FrameStreamEncoder();
+
+  // Encode rgb (pixelCount * 3 bytes) into out. Returns packet size, or 0 if
+  // capacity is too small. Unchanged frames produce a packet with no spans.
+  size_t encode(const uint8_t* rgb, uint8_t* out, size_t capacity);
+
+  void requestKeyframe() { forceKeyframe = true; }
+  void setKeyframeInterval(uint16_t frames) { keyframeInterval = frames; }
+
+  uint16_t getPixelCount() const { return pixelCount; }
+  uint8_t getDisplayId() const { return displayId; }
+
+  // Worst case packet size for a keyframe of this display
+  size_t maxPacketSize() const;
+
+private:
+  uint16_t pixelCount;
+  uint8_t displayId;
+  uint16_t sequence;
+  uint16_t keyframeInterval;
+  uint16_t framesSinceKeyframe;
+  bool forceKeyframe;
+  uint8_t* previous;
+
+  size_t writeSpan(const uint8_t* rgb, uint16_t start, uint16_t length, uint8_t* out, size_t pos, size_t capacity);
+};
+
+// Incremental packet parser; feed bytes as they arrive and apply completed frames
+class FrameStreamDecoder {
+public:
+  FrameStreamDecoder(uint8_t* rgb, uint16_t pixelCount, uint8_t displayId = 0);
+  ~FrameStreamDecoder();
+
+  // Returns true when a byte completes a valid frame that was applied to the buffer
+  bool feed(uint8_t byte);
+  void reset();
+
+  unsigned long getFramesApplied() const { return framesApplied; }
+  unsigned long getFramesDropped() const { return framesDropped; }
+  unsigned long getChecksumErrors() const { return checksumErrors; }
+
+private:
+  enum State { WAIT_MAGIC_0, WAIT_MAGIC_1, READ_HEADER, READ_PAYLOAD, READ_CHECKSUM };
+
+  uint8_t* rgb;
+  uint16_t pixelCount;
+  uint8_t displayId;
+
+  State state;
+  uint8_t header[FRAME_STREAM_HEADER_SIZE];
+  uint8_t headerPos;
+  uint8_t* payload;
+  uint16_t payloadCapacity;
+  uint16_t payloadLength;
+  uint16_t payloadPos;
+  uint8_t checksum;
+
+  uint16_t lastSequence;
+  bool synced; // Have we applied a keyframe since the last gap?
+
+  unsigned long framesApplied;
+  unsigned long framesDropped;
+  unsigned long checksumErrors;
+
+  bool finishPacket();
+};
+
+// Frame stream configuration constants
+#define FRAME_STREAM_KEYFRAME_INTERVAL 60  // frames between forced keyframes
+#define FRAME_STREAM_RECEIVER_AT_BOOT false // Start in receiver mode (thin display)
@@ -0,0 +1,9 @@
+// Golden frame hashes for the platform being built, checked by
+// GoldenFrameCheck (see golden_frames.h). Each platform keeps its own table.
+#pragma once
+
+#if defined(ESP32)
+  #include "golden_frame_table_esp32.h"
+#else
+  #include "golden_frame_table_host.h"
+#endif
@@ -0,0 +1,10 @@
+// Golden frame hashes, checked by GoldenFrameCheck (see golden_frames.h).
+// Replace with the output of 'g' on serial from a diagnostics build on the esp32:
+//   python3 tools/golden_frames.py update capture.txt
+#pragma once
+
+#define GOLDEN_TABLE_PLATFORM ""  // Not recorded yet
+
+static const GoldenCase GOLDEN_CASES[] = {
+  { nullptr, nullptr, 0 }
+};
@@ -0,0 +1,503 @@
+// Golden frame hashes, checked by GoldenFrameCheck (see golden_frames.h).
+// Replace with the output of 'g' on serial from a diagnostics build on the host:
+//   python3 tools/golden_frames.py update capture.txt
+#pragma once
+
+#define GOLDEN_TABLE_PLATFORM "host"
+
+static const uint32_t GOLDEN_0[] = {
+  0x63f08845, 0xdbc9e705, 0x86424b36, 0xa2d9dddd, 0xecbab0ce, 0x6b161e30, 0x550d622f, 0x57e59fa8,
+  0x2b938681, 0xb03aea40, 0x326c1301, 0xf88d0458, 0x3fd7f978, 0x432d57de, 0x4c0fdcb0, 0x5ff2bf64,
+  0x2089135f, 0x994540bf, 0x3c64d95e, 0x723be8ab, 0xe9fc80ba, 0x9273f64f, 0x398f1c91, 0xfa5cfd72,
+  0x2aae62c9, 0x248752e6, 0x2532e9b6, 0xf4542ee1, 0x829b13ea, 0x63f08845, 0xd5be39f0, 0xc0e8821c,
+  0xd3e2be07, 0xe2af97a7, 0x7fa8abdb, 0x15ad7e55, 0x40b27057, 0xb0e7918a, 0x08b9db7a, 0xeb429ec0,
+  0x36e91b4b, 0xd88abfea, 0xa9eecd0f, 0xc85f95fc, 0xb88b6344, 0x1a656fc2, 0x4080eb39, 0x6d7f90d6,
+  0x4438b2cf, 0x167c9243, 0x94cb8d1a, 0x3a1d60a9, 0xabe40755, 0x9a63a584, 0x74f3c8dc, 0xfffbb7b6,
+  0xfac37231, 0xc9e63ece, 0xb48ca8e0, 0x53adea6b, 0x128ff9a8, 0xdbbde2e5, 0xa5c18aed, 0xb6abaa4c,
+  0x41841c96, 0xf679f7ec, 0xc40573c0, 0xf76d213e, 0xce66c0ac, 0x4b603d52, 0xa9240b4a, 0xd8db2d52,
+  0x1783e654, 0x57e76744, 0x183df436, 0x7c5c2353, 0xde92c697, 0xd63264b0, 0xf99085b1, 0xe517517e,
+  0x405601f8, 0xffd71771, 0x6c5da988, 0xc249e176, 0xfa06f2f5, 0xc2d39c72, 0x5f8d0351, 0x467a2c04,
+  0xff2739ff, 0x41b5f9b6, 0x602abbaa, 0x8d1939e3, 0xb81fe677, 0x6edaa1ae, 0x899715ef, 0x77e67a56,
+  0x67a4d284, 0x689049a6, 0x20cc3ff9, 0x12120939, 0xfdc6e833, 0x0201c0dd, 0x656a8d7a, 0x72ce5215,
+  0x49c6c3d5, 0x16741483, 0x1ab715dd, 0x1969868b, 0xb8b027e3, 0x531c0245, 0xfde38e13, 0xf407ea35,
+  0xeebd8b9b, 0xbbce5475, 0x4e717b05, 0x0f62cefd, 0xbb62b213, 0x979225cd, 0xcae11cad, 0x5a9deced,
+  0xcff509f4, 0xe87cc9a2, 0xfb8aeed9, 0x17ae1c8b, 0x6811e9b9, 0xd002288d, 0x99fa6a55, 0x051ebb9b,
+  0x5eb2a001, 0xb01d5d69, 0xc5c9a189, 0x467fc43d, 0x6c144ca8, 0xd429b318, 0x01b84747, 0x0aa6a88b,
+  0xe883dcf1, 0x8d65b95a, 0x001ba96a, 0x2dc16f45, 0xda3dea9a, 0x1cff34d6, 0xc89e5c83, 0x8505589b,
+  0x2a1ecd60, 0xedbfde44, 0xbfa1e034, 0xb6c79c47, 0x98558f23, 0x63f08845, 0xe13d9807, 0x001e4f37,
+  0x5a28e8f2, 0x47e9bee8, 0x632fcff9, 0x4d7693a4, 0x383e2b33, 0xff41b8e0, 0x371b5fb7, 0xf6eaf1cf,
+  0xae1acc93, 0xb481e2d5, 0xcb4ade25, 0x886fb34b, 0x0e3afc50, 0x1ae81bcb, 0x9d2ab605, 0x5aaad94b,
+  0x50b1d4dd, 0xed99b94b, 0x4f9d8ebb, 0x34bc3afd, 0xa2737351, 0x3b4593b5, 0xc533da1b, 0x05deb81b,
+  0x4415476a, 0x493cf087, 0x28e1664c, 0x69f2c2da, 0x7d6ef3d3, 0xab0e3c7a, 0xb5421011, 0xd3fa09c4,
+  0xe142a098, 0x05db6ec1, 0x6ed123c4, 0xb8e32d8b, 0x0a7b778b, 0x1995ee37, 0x7e0de2a2, 0xc3dad45f,
+  0x3d33b218, 0x9fcd090f, 0x432c14db, 0x223d3e95, 0x5b6bab22, 0x1cd43af6, 0x5601f338, 0xb92d0432,
+};
+
+static const uint32_t GOLDEN_1[] = {
+  0x63f08845, 0xdbc9e705, 0x86424b36, 0xa2d9dddd, 0xecbab0ce, 0x6b161e30, 0x550d622f, 0x57e59fa8,
+  0x2b938681, 0xb03aea40, 0x326c1301, 0xf88d0458, 0x3fd7f978, 0x432d57de, 0x4c0fdcb0, 0x5ff2bf64,
+  0x2089135f, 0x994540bf, 0x3c64d95e, 0x723be8ab, 0xe9fc80ba, 0x9273f64f, 0x398f1c91, 0xfa5cfd72,
+  0x2aae62c9, 0x248752e6, 0x2532e9b6, 0xf4542ee1, 0x829b13ea, 0x63f08845, 0x1998bf31, 0x6f7d2619,
+  0xa3bd702d, 0x791b2775, 0x924de5f6, 0x927b2352, 0x6597ac80, 0x7bc3265b, 0x93aeaeb9, 0xd5da5bcd,
+  0x55c874bf, 0x9107eebb, 0xf6ac5e8f, 0xd1185f38, 0x17c2ab12, 0x6fe37eca, 0x4310bf6f, 0x578cd2e4,
+  0x88e0598c, 0x59c6fc44, 0x2ea4312b, 0xf0fcd1bc, 0x259da4e4, 0x7f1cbe32, 0x75504f3b, 0xd0a0a1c7,
+  0xc24203e2, 0x3d411881, 0xac122c8e, 0x7c478011, 0xd634fa2d, 0xc9e90de5, 0xb989c3e7, 0x04a19ace,
+  0x4ce01ff6, 0xe05ed14b, 0x64fc2a9f, 0x5d869b33, 0x8e990e55, 0x3c900ff3, 0x6218a40b, 0xf7d1150e,
+  0xa26d6077, 0x05162bda, 0xe5859e39, 0xd3f21aec, 0xa0cc29a9, 0x49a5a3bc, 0xdc82d33b, 0xbc254f1a,
+  0xed4bcabb, 0x8dd9eefd, 0x88c482e1, 0xa5d73f7d, 0x01352a4d, 0xd94458d2, 0xfd5a0a44, 0x0cf8fbf2,
+  0xba69c7f8, 0x80179e46, 0xbab7e39f, 0x2e64595b, 0xd2ab112a, 0x224e63cd, 0x1e0d3fa6, 0x9cc60ddf,
+  0xde365ed0, 0x975a810b, 0x1f21c24a, 0x47cede0a, 0x27a0988a, 0xd8708721, 0x60eae1df, 0x67860e1c,
+  0xb572d16a, 0x6361e0a7, 0x6ecc704d, 0x98d3e606, 0x28fed0c8, 0xb6361c95, 0xe6ff676f, 0x1bf4616a,
+  0xf273cecd, 0xbe2d69a0, 0x2d5dd5e6, 0xc512986e, 0xbfb2740f, 0xc34ddee6, 0x8f82f6a5, 0x3bbbf11a,
+  0xd07f332b, 0xe87cc9a2, 0xfb8aeed9, 0x17ae1c8b, 0x6811e9b9, 0xd002288d, 0x99fa6a55, 0x051ebb9b,
+  0x5eb2a001, 0xb01d5d69, 0xc5c9a189, 0x467fc43d, 0x6c144ca8, 0xd429b318, 0x01b84747, 0x0aa6a88b,
+  0xe883dcf1, 0x8d65b95a, 0x001ba96a, 0x2dc16f45, 0xda3dea9a, 0x1cff34d6, 0xc89e5c83, 0x8505589b,
+  0x2a1ecd60, 0xedbfde44, 0xbfa1e034, 0xb6c79c47, 0x98558f23, 0x63f08845, 0xf4ee0872, 0xb4abc65b,
+  0xbe8e7afe, 0xe616a336, 0x13e17a63, 0xba090003, 0x9d32535a, 0xa3a47f05, 0x73f5e9e5, 0xb800e021,
+  0xc59bf8b1, 0xc9de5f1b, 0xfcc2974a, 0x9b29e624, 0xe4807e84, 0x8780c9df, 0x584335bf, 0x19d5cd8a,
+  0xa99cd604, 0x9609ad1c, 0xa923baca, 0x991e030d, 0x3d3e3275, 0x35be4fe3, 0x3aeb9016, 0x05deb81b,
+  0x4415476a, 0x493cf087, 0x28e1664c, 0x69f2c2da, 0x7d6ef3d3, 0xab0e3c7a, 0xb5421011, 0xd3fa09c4,
+  0xe142a098, 0x05db6ec1, 0x6ed123c4, 0xb8e32d8b, 0x0a7b778b, 0x1995ee37, 0x7e0de2a2, 0xc3dad45f,
+  0x3d33b218, 0x9fcd090f, 0x432c14db, 0x223d3e95, 0x5b6bab22, 0x1cd43af6, 0x5601f338, 0xb92d0432,
+};
+
+static const uint32_t GOLDEN_2[] = {
+  0x63f08845, 0xdbc9e705, 0x86424b36, 0xa2d9dddd, 0xecbab0ce, 0x6b161e30, 0x550d622f, 0x57e59fa8,
+  0x2b938681, 0xb03aea40, 0x326c1301, 0xf88d0458, 0x3fd7f978, 0x432d57de, 0x4c0fdcb0, 0x5ff2bf64,
+  0x2089135f, 0x994540bf, 0x3c64d95e, 0x723be8ab, 0xe9fc80ba, 0x9273f64f, 0x398f1c91, 0xfa5cfd72,
+  0x2aae62c9, 0x248752e6, 0x2532e9b6, 0xf4542ee1, 0x829b13ea, 0x63f08845, 0xd4a7d48d, 0x045130a1,
+  0xbfb1e0a4, 0x9f1f0306, 0xc9369168, 0x7d5b7894, 0x3bef43f4, 0x77ae347b, 0xcd7639cd, 0xca9e29bd,
+  0xe6bfde4c, 0xf0cb305f, 0x3da451bc, 0x6c5992ff, 0xbdea9f09, 0xf959be75, 0x4bc3aa08, 0x8b2b325d,
+  0xf2b757b0, 0xf7500018, 0xa1f8b6a6, 0x4647f5e6, 0x63587800, 0x2b443c89, 0x1289946e, 0x8d4aa987,
+  0xf58408f3, 0xf516f0ab, 0x48269d36, 0xc052a594, 0x97c52b17, 0xd3427652, 0x41980ec0, 0x80e4341a,
+  0xf25d0d7f, 0x6b03f134, 0xb4f5ff47, 0x0fd3013a, 0xdbaeb8a9, 0x0167074e, 0x23666d63, 0x57931f8b,
+  0x151cbeb0, 0xa79fa162, 0x95f80a03, 0x149cf9f3, 0x3bc079ca, 0xe7e883b0, 0xda56455e, 0x930632fe,
+  0xcddbc121, 0xfb0b2375, 0x27cdbc7f, 0xe3b667e9, 0x82343e10, 0xfee1f47e, 0x373c6271, 0xddba9144,
+  0x61c8b4e7, 0xe0d88725, 0x98e88d06, 0x34251e6a, 0x3ae1eb4f, 0x3b8d0019, 0x3d60883b, 0xee644dc2,
+  0xcc77b76b, 0x378e097c, 0x3d5849ce, 0xcc614b87, 0x95e139ba, 0xe285c9ff, 0xdd3578e8, 0x3ad9bead,
+  0xfcd9eef9, 0xa2cf2b34, 0x9fd85dda, 0x11288623, 0x46dd4020, 0x1d1f2fc3, 0xe2c9e022, 0x961dc7cf,
+  0x90c9ac23, 0xed02ed4f, 0xc04f308f, 0x88964270, 0x0c3ea6a2, 0xfe69ec20, 0x6fe5ae8a, 0xe6aa3724,
+  0x944e314c, 0xe87cc9a2, 0xfb8aeed9, 0x17ae1c8b, 0x6811e9b9, 0xd002288d, 0x99fa6a55, 0x051ebb9b,
+  0x5eb2a001, 0xb01d5d69, 0xc5c9a189, 0x467fc43d, 0x6c144ca8, 0xd429b318, 0x01b84747, 0x0aa6a88b,
+  0xe883dcf1, 0x8d65b95a, 0x001ba96a, 0x2dc16f45, 0xda3dea9a, 0x1cff34d6, 0xc89e5c83, 0x8505589b,
+  0x2a1ecd60, 0xedbfde44, 0xbfa1e034, 0xb6c79c47, 0x98558f23, 0x63f08845, 0x770670ca, 0x164e7f49,
+  0x47a07399, 0xb64be1f9, 0xaec750d6, 0x1b09ee85, 0x46b0e094, 0xbc9df5cf, 0xf2063bc2, 0x28a76167,
+  0xd5a7cb46, 0x25ff22dd, 0x30ed7bbe, 0x0b99a693, 0xb90de71a, 0xd3e823f3, 0xdb19497e, 0xdbd5f3c1,
+  0xb0aa9a19, 0x8b419574, 0xdbf68d55, 0x30160ef8, 0x33a03299, 0x41f1f5ca, 0x5afa7c29, 0x05deb81b,
+  0x4415476a, 0x493cf087, 0x28e1664c, 0x69f2c2da, 0x7d6ef3d3, 0xab0e3c7a, 0xb5421011, 0xd3fa09c4,
+  0xe142a098, 0x05db6ec1, 0x6ed123c4, 0xb8e32d8b, 0x0a7b778b, 0x1995ee37, 0x7e0de2a2, 0xc3dad45f,
+  0x3d33b218, 0x9fcd090f, 0x432c14db, 0x223d3e95, 0x5b6bab22, 0x1cd43af6, 0x5601f338, 0xb92d0432,
+};
+
+static const uint32_t GOLDEN_3[] = {
+  0x63f08845, 0xdbc9e705, 0x86424b36, 0xa2d9dddd, 0xecbab0ce, 0x6b161e30, 0x550d622f, 0x57e59fa8,
+  0x2b938681, 0xb03aea40, 0x326c1301, 0xf88d0458, 0x3fd7f978, 0x432d57de, 0x4c0fdcb0, 0x5ff2bf64,
+  0x2089135f, 0x994540bf, 0x3c64d95e, 0x723be8ab, 0xe9fc80ba, 0x9273f64f, 0x398f1c91, 0xfa5cfd72,
+  0x2aae62c9, 0x248752e6, 0x2532e9b6, 0xf4542ee1, 0x829b13ea, 0x63f08845, 0xf7bae4ed, 0x484688af,
+  0xd6e76384, 0xb612ee5e, 0x25965264, 0xf291049e, 0x8457db2c, 0x27c38afb, 0x25d822da, 0x51b005ac,
+  0x236646fd, 0xc181edc7, 0x479e74fc, 0x683851ba, 0xea401986, 0x0b1c629f, 0x674141da, 0xc36f2532,
+  0xf393575e, 0xa8c27c4f, 0x4dc870f5, 0xfd725efa, 0x4c96276d, 0x0e5c839f, 0x2de9477a, 0xd6437b08,
+  0x2eb27cc5, 0x4d9fc911, 0xaa8a0aaf, 0xf9be8dd7, 0x219d27cc, 0x9b0fd7a6, 0x408d497a, 0x574fdce1,
+  0x7c026599, 0xe95346e5, 0x17b730f1, 0x477f6b11, 0x5054a81a, 0x7a8310fd, 0x89a048a5, 0x7562d9e1,
+  0x127ac76a, 0x4010bce7, 0xe393a877, 0x9ce928ce, 0x8ad094d9, 0x330469c0, 0x6cf4dd49, 0xb3c2dd68,
+  0xaceea346, 0x4773119a, 0x4ea5c5e7, 0x7fb9d177, 0x936bb6bf, 0xb149ea57, 0x677e57ff, 0xb761e2c2,
+  0xc9b2c768, 0xbb1f025b, 0xb104d59a, 0x81fd7107, 0x4d46c0b6, 0xa13afefa, 0x73e6778a, 0xe30a8236,
+  0xbe4c33bf, 0x48b6c6a9, 0xaf7cba67, 0xf5353ec7, 0x2b5d8e40, 0x682a1c59, 0x46d41279, 0x6b6a801d,
+  0x2b42e961, 0x0075f7b8, 0x49ad449b, 0x2b8b51af, 0x318ad6ae, 0x0185048e, 0xdcb0c4b4, 0x323b9ffc,
+  0xac78b12d, 0x8b95a0b0, 0xa5c5dbfc, 0x7c32d90b, 0x7bc0d6a8, 0x94d8f15b, 0x7bd08203, 0x003bfbf7,
+  0x6eaaf3b9, 0xe87cc9a2, 0xfb8aeed9, 0x17ae1c8b, 0x6811e9b9, 0xd002288d, 0x99fa6a55, 0x051ebb9b,
+  0x5eb2a001, 0xb01d5d69, 0xc5c9a189, 0x467fc43d, 0x6c144ca8, 0xd429b318, 0x01b84747, 0x0aa6a88b,
+  0xe883dcf1, 0x8d65b95a, 0x001ba96a, 0x2dc16f45, 0xda3dea9a, 0x1cff34d6, 0xc89e5c83, 0x8505589b,
+  0x2a1ecd60, 0xedbfde44, 0xbfa1e034, 0xb6c79c47, 0x98558f23, 0x63f08845, 0xbf4374f8, 0xe019f504,
+  0x1b3614b5, 0xf0327409, 0x8d0d9bb9, 0x74d62247, 0x82e5414b, 0x08198aae, 0xfff6c162, 0xdef00065,
+  0x58b9774e, 0x65e17a81, 0xa8ef50c5, 0x75dfb998, 0xc5b93e6c, 0xac98995e, 0xad57ebe0, 0x3773b4ca,
+  0x1cd9474c, 0x50a97ffd, 0xb16e7ba0, 0x659d7447, 0x8ab1a00a, 0x503f1af5, 0x29fbc012, 0x05deb81b,
+  0x4415476a, 0x493cf087, 0x28e1664c, 0x69f2c2da, 0x7d6ef3d3, 0xab0e3c7a, 0xb5421011, 0xd3fa09c4,
+  0xe142a098, 0x05db6ec1, 0x6ed123c4, 0xb8e32d8b, 0x0a7b778b, 0x1995ee37, 0x7e0de2a2, 0xc3dad45f,
+  0x3d33b218, 0x9fcd090f, 0x432c14db, 0x223d3e95, 0x5b6bab22, 0x1cd43af6, 0x5601f338, 0xb92d0432,
+};
+
+static const uint32_t GOLDEN_4[] = {
+  0x4d30ddc3, 0x4d30ddc3, 0xd5be39f0, 0xd5be39f0, 0x9a0ec297, 0x9a0ec297, 0x6807a35e, 0x6807a35e,
+  0x9a6fce69, 0x9a6fce69, 0x40b27057, 0x40b27057, 0x08b9db7a, 0x08b9db7a, 0x36e91b4b, 0x36e91b4b,
+  0xa9eecd0f, 0xa9eecd0f, 0xbf91474e, 0xbf91474e, 0xb8953097, 0xb8953097, 0xebd4fb29, 0xebd4fb29,
+  0xd86cedb9, 0xd86cedb9, 0xbd9c4b30, 0xbd9c4b30, 0xf9c243a5, 0xf9c243a5, 0x0553cc76, 0x0553cc76,
+  0xfffbb7b6, 0xfffbb7b6, 0xc9e63ece, 0xc9e63ece, 0xb48ca8e0, 0xb48ca8e0, 0x128ff9a8, 0x128ff9a8,
+  0x0cdc5464, 0x0cdc5464, 0x650e0674, 0x650e0674, 0x9032ed02, 0x9032ed02, 0x93680424, 0x93680424,
+  0xdface840, 0xdface840, 0x4b603d52, 0x4b603d52, 0xd8db2d52, 0xd8db2d52, 0x57e76744, 0x57e76744,
+  0x183df436, 0x183df436, 0xde92c697, 0xde92c697, 0xf99085b1, 0xf99085b1, 0x49bacaa6, 0x49bacaa6,
+  0xffd71771, 0xffd71771, 0xc249e176, 0xc249e176, 0xc2d39c72, 0xc2d39c72, 0x467a2c04, 0x467a2c04,
+  0x41b5f9b6, 0x41b5f9b6, 0x43533788, 0x43533788, 0x210d3c67, 0x210d3c67, 0x512a0af3, 0x512a0af3,
+  0xcb460513, 0xcb460513, 0x2c7b8879, 0x2c7b8879, 0x758cb995, 0x758cb995, 0xcaf763a5, 0xcaf763a5,
+  0x9579def5, 0x9579def5, 0x49c6c3d5, 0x49c6c3d5, 0x1ab715dd, 0x1ab715dd, 0xb8b027e3, 0xb8b027e3,
+  0xfde38e13, 0xfde38e13, 0xeebd8b9b, 0xeebd8b9b, 0x4e717b05, 0x4e717b05, 0x62fa43a5, 0x62fa43a5,
+  0x582f728d, 0x582f728d, 0x5a9deced, 0x5a9deced, 0x97e1df20, 0x97e1df20, 0xe13d9807, 0xe13d9807,
+  0x001e4f37, 0x001e4f37, 0xfa24fa0c, 0xfa24fa0c, 0x9c11cf4e, 0x9c11cf4e, 0xd3630a30, 0xd3630a30,
+  0x371b5fb7, 0x371b5fb7, 0xae1acc93, 0xae1acc93, 0xcb4ade25, 0xcb4ade25, 0xccb3b1a7, 0xccb3b1a7,
+  0xec58f911, 0xec58f911, 0x81e9b1b7, 0x81e9b1b7, 0xed99b94b, 0xed99b94b, 0x34bc3afd, 0x34bc3afd,
+  0x3b4593b5, 0x3b4593b5, 0x415f5c17, 0x415f5c17, 0xc89a672b, 0xc89a672b, 0xf72871d3, 0xf72871d3,
+  0x24cb439a, 0x24cb439a, 0xe9018476, 0xe9018476, 0x5bd8435d, 0x5bd8435d, 0x6441c487, 0x6441c487,
+  0xb2fd7b3d, 0xb2fd7b3d, 0xfba51595, 0xfba51595, 0x3da68175, 0x3da68175, 0x859f1c75, 0x859f1c75,
+  0xf282ec21, 0xf282ec21, 0xbbba579f, 0xbbba579f, 0x9afe766b, 0x9afe766b, 0x285d901b, 0x285d901b,
+  0x9ad30ab3, 0x9ad30ab3, 0x5eb04d09, 0x5eb04d09, 0x9d8c743b, 0x9d8c743b, 0xc0088847, 0xc0088847,
+  0x41bb5491, 0x41bb5491, 0x2ef6427f, 0x2ef6427f, 0x19d4d7c9, 0x19d4d7c9, 0x6442c75b, 0x6442c75b,
+  0x3b0fefe0, 0x3b0fefe0, 0xa691c6bd, 0xa691c6bd, 0x51f8a45b, 0x51f8a45b, 0x42d59995, 0x42d59995,
+  0x3182b691, 0x3182b691, 0x11717119, 0x11717119, 0xa91333a0, 0xa91333a0, 0x861c3652, 0x861c3652,
+};
+
+static const uint32_t GOLDEN_5[] = {
+  0x53c72519, 0x53c72519, 0x1998bf31, 0x1998bf31, 0xe942a1b5, 0xe942a1b5, 0xac7bbced, 0xac7bbced,
+  0xddf70290, 0xddf70290, 0x6597ac80, 0x6597ac80, 0x93aeaeb9, 0x93aeaeb9, 0x55c874bf, 0x55c874bf,
+  0xf6ac5e8f, 0xf6ac5e8f, 0x58045e3e, 0x58045e3e, 0x8284d165, 0x8284d165, 0xb12d6528, 0xb12d6528,
+  0x25346894, 0x25346894, 0xb9397585, 0xb9397585, 0xd54c48b8, 0xd54c48b8, 0x8eeb4027, 0x8eeb4027,
+  0xd0a0a1c7, 0xd0a0a1c7, 0x3d411881, 0x3d411881, 0xac122c8e, 0xac122c8e, 0xd634fa2d, 0xd634fa2d,
+  0xbf3184db, 0xbf3184db, 0xf04bb6d0, 0xf04bb6d0, 0xd8520827, 0xd8520827, 0xfe763667, 0xfe763667,
+  0x4785d50d, 0x4785d50d, 0x3c900ff3, 0x3c900ff3, 0xf7d1150e, 0xf7d1150e, 0x05162bda, 0x05162bda,
+  0xe5859e39, 0xe5859e39, 0xa0cc29a9, 0xa0cc29a9, 0xdc82d33b, 0xdc82d33b, 0x0a86f687, 0x0a86f687,
+  0x8dd9eefd, 0x8dd9eefd, 0xa5d73f7d, 0xa5d73f7d, 0xd94458d2, 0xd94458d2, 0x0cf8fbf2, 0x0cf8fbf2,
+  0x80179e46, 0x80179e46, 0x000326ab, 0x000326ab, 0x7d65bc51, 0x7d65bc51, 0x148babcf, 0x148babcf,
+  0xbc9e10da, 0xbc9e10da, 0x2a73a8ef, 0x2a73a8ef, 0x07b97ad1, 0x07b97ad1, 0xaced3378, 0xaced3378,
+  0xd4498ad4, 0xd4498ad4, 0x380e944a, 0x380e944a, 0x6ecc704d, 0x6ecc704d, 0x28fed0c8, 0x28fed0c8,
+  0xe6ff676f, 0xe6ff676f, 0xf273cecd, 0xf273cecd, 0x2d5dd5e6, 0x2d5dd5e6, 0x8e465c54, 0x8e465c54,
+  0x4269f56d, 0x4269f56d, 0x3bbbf11a, 0x3bbbf11a, 0x55ecd606, 0x55ecd606, 0xf4ee0872, 0xf4ee0872,
+  0xb4abc65b, 0xb4abc65b, 0x39bda162, 0x39bda162, 0xb2de8d05, 0xb2de8d05, 0x67162db5, 0x67162db5,
+  0x73f5e9e5, 0x73f5e9e5, 0xc59bf8b1, 0xc59bf8b1, 0xfcc2974a, 0xfcc2974a, 0xac83015f, 0xac83015f,
+  0x040a01df, 0x040a01df, 0x3f783de3, 0x3f783de3, 0x9609ad1c, 0x9609ad1c, 0x991e030d, 0x991e030d,
+  0x35be4fe3, 0x35be4fe3, 0xf552315d, 0xf552315d, 0xe034df91, 0xe034df91, 0x3744909f, 0x3744909f,
+  0x4c4751e6, 0x4c4751e6, 0x651c3803, 0x651c3803, 0x76697112, 0x76697112, 0xa2027db0, 0xa2027db0,
+  0xad7fd4cf, 0xad7fd4cf, 0x3452b084, 0x3452b084, 0x26ad166d, 0x26ad166d, 0x65793b86, 0x65793b86,
+  0x9b91d122, 0x9b91d122, 0x8848d5e0, 0x8848d5e0, 0x3251b216, 0x3251b216, 0xd9965a95, 0xd9965a95,
+  0x48208b91, 0x48208b91, 0x74837c29, 0x74837c29, 0xbd383355, 0xbd383355, 0x1a5c85da, 0x1a5c85da,
+  0x25b0052a, 0x25b0052a, 0xb6a9a0fc, 0xb6a9a0fc, 0xd39bd977, 0xd39bd977, 0xa57de14c, 0xa57de14c,
+  0x2c8f8d1b, 0x2c8f8d1b, 0xad5d5e37, 0xad5d5e37, 0x18c95a55, 0x18c95a55, 0xdb81e6a0, 0xdb81e6a0,
+  0x8fe053b5, 0x8fe053b5, 0x50f05396, 0x50f05396, 0xf892f3c5, 0xf892f3c5, 0xe37c9b79, 0xe37c9b79,
+};
+
+static const uint32_t GOLDEN_6[] = {
+  0xcc7d5cb8, 0xcc7d5cb8, 0xd4a7d48d, 0xd4a7d48d, 0xfa44f826, 0xfa44f826, 0x3e5c55e1, 0x3e5c55e1,
+  0x42dc20b2, 0x42dc20b2, 0x3bef43f4, 0x3bef43f4, 0xcd7639cd, 0xcd7639cd, 0xe6bfde4c, 0xe6bfde4c,
+  0x3da451bc, 0x3da451bc, 0x34c7ee77, 0x34c7ee77, 0x8d288aba, 0x8d288aba, 0x0a05af56, 0x0a05af56,
+  0x34cd064a, 0x34cd064a, 0x9522de34, 0x9522de34, 0xbc7c5bf4, 0xbc7c5bf4, 0xe230bcf0, 0xe230bcf0,
+  0x8d4aa987, 0x8d4aa987, 0xf516f0ab, 0xf516f0ab, 0x48269d36, 0x48269d36, 0x97c52b17, 0x97c52b17,
+  0xa01cb5bd, 0xa01cb5bd, 0x1f09c11f, 0x1f09c11f, 0x19a56fe2, 0x19a56fe2, 0x4915a0c4, 0x4915a0c4,
+  0xb60912d3, 0xb60912d3, 0x0167074e, 0x0167074e, 0x57931f8b, 0x57931f8b, 0xa79fa162, 0xa79fa162,
+  0x95f80a03, 0x95f80a03, 0x3bc079ca, 0x3bc079ca, 0xda56455e, 0xda56455e, 0x39e6fc49, 0x39e6fc49,
+  0xfb0b2375, 0xfb0b2375, 0xe3b667e9, 0xe3b667e9, 0xfee1f47e, 0xfee1f47e, 0xddba9144, 0xddba9144,
+  0xe0d88725, 0xe0d88725, 0x150fd047, 0x150fd047, 0x8b359896, 0x8b359896, 0xd832a237, 0xd832a237,
+  0xb025929a, 0xb025929a, 0xba7ca834, 0xba7ca834, 0x1c53383b, 0x1c53383b, 0xb9f61ae3, 0xb9f61ae3,
+  0x99b431ed, 0x99b431ed, 0xfcd9eef9, 0xfcd9eef9, 0x9fd85dda, 0x9fd85dda, 0x46dd4020, 0x46dd4020,
+  0xe2c9e022, 0xe2c9e022, 0x90c9ac23, 0x90c9ac23, 0xc04f308f, 0xc04f308f, 0xaa9f4941, 0xaa9f4941,
+  0x200cbe68, 0x200cbe68, 0xe6aa3724, 0xe6aa3724, 0x9cedcffd, 0x9cedcffd, 0x770670ca, 0x770670ca,
+  0x164e7f49, 0x164e7f49, 0x9d3d3cc9, 0x9d3d3cc9, 0x818f2aa1, 0x818f2aa1, 0x4c9bfdd3, 0x4c9bfdd3,
+  0xf2063bc2, 0xf2063bc2, 0xd5a7cb46, 0xd5a7cb46, 0x30ed7bbe, 0x30ed7bbe, 0x4c5e00d2, 0x4c5e00d2,
+  0xd56b862d, 0xd56b862d, 0x459eac09, 0x459eac09, 0x8b419574, 0x8b419574, 0x30160ef8, 0x30160ef8,
+  0x41f1f5ca, 0x41f1f5ca, 0x7ed96999, 0x7ed96999, 0xf940f9c9, 0xf940f9c9, 0xa35a8ba3, 0xa35a8ba3,
+  0xd34f52e0, 0xd34f52e0, 0xb57c05a8, 0xb57c05a8, 0x7bcd87cf, 0x7bcd87cf, 0x33f10e22, 0x33f10e22,
+  0x5896637d, 0x5896637d, 0xf1f85cb4, 0xf1f85cb4, 0x3a067ad4, 0x3a067ad4, 0x7ccca956, 0x7ccca956,
+  0x6b83676f, 0x6b83676f, 0x6738b172, 0x6738b172, 0x4575ac46, 0x4575ac46, 0xc3145de8, 0xc3145de8,
+  0x4085d986, 0x4085d986, 0x9a17732a, 0x9a17732a, 0xce256be0, 0xce256be0, 0x8cf1df78, 0x8cf1df78,
+  0x40499d48, 0x40499d48, 0x253433ba, 0x253433ba, 0x0118f1e0, 0x0118f1e0, 0x8625ed06, 0x8625ed06,
+  0x5bc88477, 0x5bc88477, 0xd2eece1c, 0xd2eece1c, 0x296d5e72, 0x296d5e72, 0x295139f1, 0x295139f1,
+  0x47ce11f6, 0x47ce11f6, 0xb5f6efcc, 0xb5f6efcc, 0x9fced3fc, 0x9fced3fc, 0x7ecff028, 0x7ecff028,
+};
+
+static const uint32_t GOLDEN_7[] = {
+  0x4bd23696, 0x4bd23696, 0x5e82642e, 0x5e82642e, 0x926e5ab6, 0x926e5ab6, 0xf2a40ea0, 0xf2a40ea0,
+  0x29063d48, 0x29063d48, 0x5693ec21, 0x5693ec21, 0x7c923765, 0x7c923765, 0x23e25e3e, 0x23e25e3e,
+  0xc4913560, 0xc4913560, 0xa95f6109, 0xa95f6109, 0x79fc705b, 0x79fc705b, 0x74664dd5, 0x74664dd5,
+  0xa1937dd9, 0xa1937dd9, 0xf2ea55a3, 0xf2ea55a3, 0x940197b7, 0x481ac0b1, 0xfeb68342, 0xfeb68342,
+  0xd6437b08, 0xd6437b08, 0x4d9fc911, 0x4d9fc911, 0xaa8a0aaf, 0xaa8a0aaf, 0xe6cda205, 0xe6cda205,
+  0xadaaae73, 0xadaaae73, 0xc3f5f83d, 0xc3f5f83d, 0x61ea2628, 0x61ea2628, 0xcf172389, 0xcf172389,
+  0xb8cc7cd4, 0xb8cc7cd4, 0xf2e2779e, 0xf2e2779e, 0xb4140203, 0xb4140203, 0x660dcdb1, 0x660dcdb1,
+  0xa70bfeaa, 0xa70bfeaa, 0xe20b7f4a, 0x8ad094d9, 0x6cf4dd49, 0x6cf4dd49, 0xd1f4ad30, 0xd1f4ad30,
+  0x4773119a, 0x4773119a, 0x7fb9d177, 0x7fb9d177, 0xb149ea57, 0xb149ea57, 0xb761e2c2, 0xb761e2c2,
+  0xb63d00e6, 0xb63d00e6, 0xcdac7587, 0xcdac7587, 0x88c58df9, 0x88c58df9, 0xebba9602, 0xebba9602,
+  0x95518199, 0x95518199, 0xb68c8dcd, 0xb68c8dcd, 0x486e6a44, 0x486e6a44, 0xae05d103, 0xae05d103,
+  0x82d61f59, 0x82d61f59, 0xbc5188e0, 0xbc5188e0, 0x49ad449b, 0x49ad449b, 0x318ad6ae, 0x318ad6ae,
+  0xdcb0c4b4, 0xdcb0c4b4, 0xac78b12d, 0xac78b12d, 0xa5c5dbfc, 0xa5c5dbfc, 0x67491018, 0x67491018,
+  0xbfae9397, 0xbfae9397, 0xd919f2cd, 0xd919f2cd, 0xf7f0becf, 0xf7f0becf, 0xda5d325f, 0xda5d325f,
+  0x5fdf2362, 0x5fdf2362, 0x28607685, 0x28607685, 0xf953d329, 0xf953d329, 0x1a15c145, 0x1a15c145,
+  0xe95349fb, 0xe95349fb, 0xd04450e4, 0xd04450e4, 0x23d4f0a7, 0x23d4f0a7, 0x2841fe07, 0x2841fe07,
+  0x7ee365f1, 0x7ee365f1, 0xec6d7b4e, 0xec6d7b4e, 0xb2b83aa1, 0xb2b83aa1, 0x5588a90b, 0x5588a90b,
+  0x717a2dbe, 0x717a2dbe, 0x6f8a8bd3, 0x6f8a8bd3, 0x9191f0ea, 0x9191f0ea, 0xfae8eda4, 0xfae8eda4,
+  0x909c5e5e, 0x909c5e5e, 0xbaf28f41, 0x9378091a, 0xa02783ee, 0xa02783ee, 0x9092584f, 0x9092584f,
+  0x5fb65883, 0x5fb65883, 0x223ecf64, 0x223ecf64, 0x784a750e, 0x784a750e, 0x436c1ac1, 0x436c1ac1,
+  0x2678fa23, 0x2678fa23, 0x8f56b3f0, 0x8f56b3f0, 0x6ba183ba, 0x6ba183ba, 0xf98c9165, 0xf98c9165,
+  0x883858d7, 0x883858d7, 0x0d5ba0ad, 0x0d5ba0ad, 0xbd400152, 0xbd400152, 0x2dab6cc5, 0x2dab6cc5,
+  0x194ad47d, 0x70ea194e, 0x671e1824, 0x671e1824, 0xce64cad5, 0xce64cad5, 0x25184ab8, 0x25184ab8,
+  0x00174a1d, 0x00174a1d, 0x5e334239, 0x5e334239, 0x3ea0a7d6, 0x3ea0a7d6, 0x5a19f81d, 0x5a19f81d,
+  0xd6abb940, 0xd6abb940, 0x7bb3c564, 0x7bb3c564, 0x0c48f925, 0x0c48f925, 0xab9e2745, 0xab9e2745,
+};
+
+static const uint32_t GOLDEN_8[] = {
+  0x63f08845, 0x63f08845, 0x63f08845, 0x63f08845, 0xda658380, 0x4c70815f, 0x5122b787, 0x17ee393c,
+  0x12bfcc5b, 0x408d4e7d, 0x1c8e22e6, 0x1c8e22e6, 0x2d69e3d3, 0x2a4cb2bc, 0x8599efe9, 0x83fb3cab,
+  0xe1404172, 0x551a748d, 0x9697bed2, 0x8ef8818e, 0xfc7ffbfe, 0xfc7ffbfe, 0x59dc4b45, 0xf972f0c0,
+  0xf095c3d0, 0x40355bb3, 0xe135ee41, 0x6f69777f, 0x25cf671d, 0x1aaf6339, 0xec5db591, 0xec5db591,
+  0xd5e9b615, 0xe94d0815, 0x7c26ead0, 0x28f8bde9, 0x3ad5bb38, 0x262c79b4, 0xde298c42, 0xd2a214f3,
+  0x15c5de53, 0x15c5de53, 0x93535d58, 0x951f1a57, 0xa0d63dcd, 0xd31afe4f, 0x4646e818, 0xf1f9b6d0,
+  0x1e9e3bb9, 0x078d6f5d, 0x468e44c4, 0x468e44c4, 0x943c65e9, 0xd5a0e869, 0x8555f8a9, 0x305f14d8,
+  0xfba0f744, 0x0ac89af3, 0xda9ebeae, 0xdcc6ffe4, 0xfa3f478a, 0xfa3f478a, 0x640df55b, 0x23457757,
+  0xec24b28e, 0xa1f4fe99, 0x9166802f, 0xfaef6c89, 0x3318fe92, 0xacd390a3, 0xdf16d211, 0xdf16d211,
+  0xd439f4f1, 0x6069c91b, 0x63ad534a, 0x3a1a50d7, 0xf5e1d5bb, 0xd9da87c8, 0xaafcde8c, 0x89b73ea1,
+  0xbb5cd489, 0xbb5cd489, 0x3a206c3e, 0x291b9863, 0x468b8095, 0xb364c83a, 0x6a886877, 0x056b826f,
+  0x5b191129, 0x785102b6, 0xce4234e0, 0xce4234e0, 0x19991349, 0x70413e4a, 0x580c671a, 0xff00dc70,
+  0x962d3d4f, 0x5b3b0b78, 0xf2f83a34, 0x39296140, 0xef4187e5, 0xef4187e5, 0x17acbef4, 0xb4d42403,
+  0x9d2203ad, 0xb77e8fdb, 0x152e6816, 0x39c5bcfa, 0xd8c42ce1, 0x22db7aca, 0x5d565b1a, 0x5d565b1a,
+  0x7351b2a1, 0x410cd011, 0x813f61ee, 0x761c5143, 0x3b7a86d3, 0x0cba7749, 0x7471d4e4, 0xa9a54e6d,
+  0xa83e1265, 0xa83e1265, 0x7102654f, 0xaa398c92, 0x71f71a23, 0x80e85f7c, 0xe13b0649, 0x8bb7b4e7,
+  0x6e2d1d11, 0x4259d9dc, 0xfc8e58b2, 0xfc8e58b2, 0x20b70f39, 0x74cac19b, 0x9d540c05, 0x76c537b8,
+  0x4557bcd1, 0x36ba339f, 0x4a406430, 0x7a2074af, 0xd72696c5, 0xd72696c5, 0xa30c6ae1, 0x2b4651b5,
+  0x05773a06, 0xf4aac80d, 0xdb4c79a8, 0xc5d18cb4, 0x393a70a4, 0x47f698a5, 0x1524ddaf, 0x1524ddaf,
+  0x9bcee24b, 0xf413da49, 0x3c22e32b, 0x82fe94e7, 0x0e7ff05e, 0xa2757bd6, 0x71a0c5e7, 0x2984f4ff,
+  0xea2a20c9, 0xea2a20c9, 0xc9443437, 0x847b8ffe, 0xf30dea46, 0x3629bf81, 0xe8b6be00, 0xd3460b34,
+  0x618c3759, 0x14b06558, 0xca741100, 0xca741100, 0xd989a2dd, 0x652da7a1, 0x86fff5d7, 0x1dfa85bb,
+  0xdedbf178, 0xfb8c96f9, 0x042deee7, 0xa495e13d, 0xdda139d1, 0xdda139d1, 0x5e541849, 0xe2e98003,
+  0xa4169801, 0xb7a0e93a, 0x992835d2, 0x11810584, 0x84d72d0c, 0x189b2336, 0x3088f1dd, 0x3088f1dd,
+  0x016cf39b, 0xcf094256, 0x1ad96f0e, 0x2c7bf37a, 0xfabd718e, 0xcd0da470, 0x856e58ff, 0x4d2c552e,
+};
+
+static const uint32_t GOLDEN_9[] = {
+  0x63f08845, 0x63f08845, 0x63f08845, 0x63f08845, 0x0d45da04, 0xe265d32d, 0xe57697a0, 0xdf10b12f,
+  0xd0b9def1, 0x88a45285, 0xbfdc3ad4, 0xbfdc3ad4, 0xdd156b89, 0x6d36ca64, 0x6cdd28ac, 0x0927c8b6,
+  0x0a0a3167, 0xbc58d72f, 0x90ddcfec, 0x8412937e, 0xbb2a0550, 0xbb2a0550, 0x6de0ba9d, 0x06c0fca0,
+  0x9c3cc88d, 0x25815da8, 0xb08ed942, 0xe710f70e, 0x3b9e17ea, 0x22dfb0a2, 0xd4623f0a, 0xd4623f0a,
+  0x6ec19dc4, 0xe973d365, 0x1bcf8e7b, 0x6a4df903, 0xbab9207d, 0x04a269fb, 0x9673ceaa, 0xdab36831,
+  0x19879966, 0x19879966, 0xd74b43ba, 0xfdc4df4a, 0x082d17c3, 0x08722dc8, 0xfded8131, 0x01c1750c,
+  0x2a1eef90, 0x659fcc38, 0x6f3dd605, 0x6f3dd605, 0x4b53b884, 0xbd7acaf3, 0xe1e751d3, 0x19933c92,
+  0x2cd446ed, 0x848e158d, 0x21fb7ca7, 0x100c90e0, 0xe971fe81, 0xe971fe81, 0xc4b9a5a7, 0x85c262b6,
+  0x0247c513, 0xc80fba74, 0xb45ad4f0, 0x0b9194bb, 0x0124bd6d, 0xf929a9ba, 0xcd89502a, 0xcd89502a,
+  0x19f50565, 0x96ad85c2, 0x641b1351, 0x72ddd146, 0x1fddd6c7, 0x43f61a74, 0x368bc7bf, 0x28d3eabf,
+  0x4ba8bcd8, 0x4ba8bcd8, 0xfe2aa982, 0x3916359d, 0x4a23662b, 0x62cf8afb, 0xad854750, 0x705cedd8,
+  0x2d890108, 0x3a78b001, 0xe21e75fc, 0xe21e75fc, 0xe3f255ce, 0x9689aaf6, 0xbd14d475, 0x5a9ccb73,
+  0xd230294b, 0x1e0db0c2, 0xd41e9067, 0x5987077f, 0xbcae1d8f, 0xbcae1d8f, 0x9ab694be, 0x056de1f4,
+  0x8e8eed37, 0xf96c712b, 0x1f997790, 0xee77a70a, 0x7e28d6a1, 0xa244547b, 0x97761c0f, 0x97761c0f,
+  0x1800ec89, 0xb94203f1, 0xebc7cf9e, 0xccddcbf3, 0x6ff76624, 0x03e6bfe7, 0xc270a947, 0x0f92fe1f,
+  0xb2bb7bf2, 0xb2bb7bf2, 0x570b8a22, 0x3fd63da9, 0x5bc01302, 0x2ff64d2b, 0x0ac37c78, 0xe2b6e8c1,
+  0x10b8fe89, 0x0aa10f75, 0xe4a24fe2, 0xe4a24fe2, 0xc9296d71, 0xc7803353, 0x43a73a31, 0x994a5107,
+  0xda13e189, 0xe8db4e10, 0xc8ecc75a, 0x72d4fd87, 0xc5d5fc5f, 0xc5d5fc5f, 0xf6d7d7ee, 0x1da3bf25,
+  0xd41a34da, 0x63d415f9, 0x3c88015e, 0x3317ef85, 0xf8b4adac, 0x88ce9a1a, 0xf641a06c, 0xf641a06c,
+  0x8594df24, 0x96a1a40c, 0x3d42f326, 0x78ce2a19, 0x19cf946e, 0x456b1395, 0x9854f718, 0x06a01cf6,
+  0x73e43a92, 0x73e43a92, 0xc94df848, 0x573c619d, 0xba3a2e25, 0xf3526f2b, 0x7a2e9d70, 0x5f9f86d1,
+  0xe8c168eb, 0xc2ebce35, 0x55d6a263, 0x55d6a263, 0xcd0d39cf, 0x03d56ea8, 0xc180608a, 0xe771b841,
+  0x0ab5e6a3, 0xef1160cf, 0xd2b0a133, 0xb2c07efe, 0x639d43d6, 0x639d43d6, 0x16392c5c, 0x2208a002,
+  0xdc95db0b, 0x8bc2cb03, 0x8509abe2, 0xacaa5b46, 0x8cebaee1, 0xd6655501, 0xb6383dcd, 0xb6383dcd,
+  0x11bca5b6, 0xe77ebaf6, 0xdd9bc377, 0x74a0284c, 0x2805c2f5, 0xece59f35, 0xb5ea08ae, 0xfd7d08d2,
+};
+
+static const uint32_t GOLDEN_10[] = {
+  0x63f08845, 0x63f08845, 0x63f08845, 0x63f08845, 0xd78c50cc, 0x4772fec0, 0x4eb7a216, 0xb6bc49bb,
+  0x60d9fceb, 0x27bcbd33, 0x520546f0, 0x520546f0, 0x8c69e4e5, 0xa0da86ef, 0x8a8667cc, 0xd8f12bf8,
+  0x8b569d2e, 0x5db2aa87, 0x0a39b5f7, 0x74a7421e, 0x832a247b, 0x832a247b, 0xf445bf52, 0x3035db51,
+  0x311a92bd, 0x2bf0eb40, 0x89a86d01, 0x6050397e, 0x25cf671d, 0x1aaf6339, 0xec5db591, 0xec5db591,
+  0xd5e9b615, 0xe94d0815, 0x1db29066, 0x076b99b9, 0x7b1076a7, 0x355e2af1, 0x66b9e4d9, 0xfa3f531c,
+  0xff1d040f, 0xff1d040f, 0x6973dc06, 0xa979a22b, 0x17fb7a5e, 0x36310c3b, 0x24cde970, 0x0c0ae7d0,
+  0x3c93486b, 0x623187fd, 0x9e18c8ed, 0x9e18c8ed, 0x21d19a1c, 0xce0a751d, 0x6e6d289c, 0x1074955d,
+  0xa7925840, 0x506cb31d, 0x948d1165, 0x76957b17, 0xd0a4ab17, 0xd0a4ab17, 0x5f380393, 0xc5041003,
+  0x536860a9, 0x74efaf2c, 0x4bfa9653, 0x9e05d8f5, 0x9fc7cfa7, 0xda64795b, 0x536f1bc4, 0x536f1bc4,
+  0x665a8a03, 0xe810f285, 0x40ae1c9f, 0x2ee8f200, 0x07ceea0b, 0xdd282b87, 0xe520d714, 0xe323187e,
+  0xc9e6cbf9, 0xc9e6cbf9, 0x90d7c5d2, 0xf0debc81, 0xb6465b29, 0xd6910eb5, 0xa2ef1004, 0x26e4dafa,
+  0x98d0e75a, 0x31981ade, 0xb0b90ace, 0xb0b90ace, 0x958e150f, 0xe37be923, 0x20268f51, 0x8494112f,
+  0x3c0b0255, 0x5b6c9bbd, 0xc5bbb964, 0x072aa06d, 0x79e31bc2, 0x79e31bc2, 0x8196294d, 0xcbed4837,
+  0xaf95f585, 0x1ddc5c9f, 0x7da0ba04, 0x0e733621, 0xc91a72c8, 0xc618f08f, 0xa6de0b76, 0xa6de0b76,
+  0x2ae202a3, 0x1d4ebcbb, 0x0a2cb4b5, 0x6a3e1125, 0xab68b460, 0xaf9238d5, 0xfb4989d0, 0x43e24130,
+  0x9db3441b, 0x9db3441b, 0x4c9a510b, 0xf7cda2d5, 0x6ef51bcc, 0x6e605efd, 0xf227bdbd, 0xe8bc805b,
+  0x8f6698e3, 0x0ffad1cd, 0x758365b6, 0x758365b6, 0xe3b15d7e, 0x607e8ab5, 0xf051154e, 0xa81098f8,
+  0xc3fe6fe3, 0x0f142f75, 0xfe1b3ec8, 0x83474c43, 0x0fa8c809, 0x0fa8c809, 0xc650d6de, 0x2fa244ac,
+  0x6134089f, 0x3d667dbb, 0x725ff77c, 0xab776ef1, 0x6c30f81a, 0xcd7a64f5, 0x21f3002c, 0x21f3002c,
+  0x5e3dbc85, 0x84a3d2d9, 0xf886482a, 0x42eff5a6, 0x4dc77eb0, 0x929546ee, 0xbc917f89, 0x6cd36bfa,
+  0x1a17c8ac, 0x1a17c8ac, 0x30c5f144, 0x47ed0be0, 0x9a484768, 0xedfe02f7, 0x228c69f3, 0xd9fcdd04,
+  0x05c5c7c9, 0xa505240a, 0xf6daa972, 0xf6daa972, 0x19df67a5, 0x87b0bd79, 0xa8180d50, 0xd2ff1366,
+  0x2a2d7db1, 0xb67ad3fa, 0x66abbc90, 0x84d7b8e3, 0x44c1ad05, 0x44c1ad05, 0x72086cd0, 0x139be428,
+  0x0ca1926a, 0x5357a418, 0x2e3816fe, 0xcc41f335, 0x5a8703c2, 0x15024fb2, 0x0cac8651, 0x0cac8651,
+  0x48fa8089, 0x51b544f7, 0x9d963fd7, 0x0c963a1c, 0x8a4a6dce, 0x6925316c, 0x17577151, 0x502e808b,
+};
+
+static const uint32_t GOLDEN_11[] = {
+  0x63f08845, 0x63f08845, 0x63f08845, 0x63f08845, 0x63f08845, 0xeaa1a64b, 0x5e311eab, 0xf399f2c2,
+  0x16fd941e, 0xb20d50d4, 0x093c5811, 0x63415b48, 0x18f875a0, 0x18f875a0, 0x58b87479, 0xc26168e7,
+  0xeddf7a20, 0xbc24cc32, 0x43ac966f, 0x2100fcfd, 0xc41492d6, 0x47dc0ba6, 0x6592c188, 0xd76c0464,
+  0xd76c0464, 0x5dc0e72f, 0xbfd11dc6, 0xbe1e96b5, 0x6511b3f5, 0xa5ed5f38, 0x6d3b060f, 0xb30c13e8,
+  0x8f58a40c, 0xad522582, 0xe7aacd44, 0xa4967321, 0xa4967321, 0x63e4c4f4, 0x65b6f07b, 0x2d545e0f,
+  0x9854df3f, 0x42e9b72d, 0x4ca01e4f, 0xdd4e9f62, 0xf9ecc250, 0x73c09d15, 0xe2faef68, 0xe2faef68,
+  0x5a59d0c3, 0x49cc595a, 0x55e4906d, 0x8278c346, 0x424f5225, 0xc6b1f192, 0x378f2d75, 0xc305cc48,
+  0x01fb7092, 0x8e16b4ae, 0x8e16b4ae, 0xbab5e85a, 0xc1349248, 0xc1070ee0, 0xdc343cb3, 0xb2a7c3ab,
+  0x9428a84c, 0x79ebc4d3, 0x56ef90b6, 0xbaab58d9, 0x4b2099f0, 0x4b2099f0, 0x1f2876c8, 0xc847f01c,
+  0xd8fb5ccb, 0xf04504e5, 0x3324cab0, 0x36854ed2, 0xc12c68a9, 0x40748cf1, 0x6a572bb5, 0xc76120d4,
+  0xc76120d4, 0x3e1bcbab, 0x289f94dc, 0xd2eb18a4, 0xa2e2a2c3, 0xe5d261cf, 0xd985ec0c, 0xa5d17c22,
+  0x75ae2f56, 0x5b7ba484, 0xaf4090d8, 0xf2a51556, 0xf2a51556, 0x098860e3, 0x9ef6c5f5, 0x137a0879,
+  0x4a9a74f0, 0xe8f18d12, 0xa0ef5f1f, 0x226cb8ec, 0xa76d2ad8, 0x08b82763, 0x9ffbab71, 0x9ffbab71,
+  0xbb89cf78, 0x0588002f, 0xe2b085b3, 0xe916f92a, 0x4a1ce794, 0x8c40bbec, 0x8d703f10, 0x7bdf2b0d,
+  0xafce6b08, 0x8b304568, 0x8b304568, 0xbc9d575e, 0x645052d9, 0x333dc711, 0xa60795e2, 0x3731f2b7,
+  0x1a755171, 0xe030ca1f, 0xd218df15, 0x7b22744a, 0x7b22744a, 0xfddab121, 0x8f53a71b, 0x436956d5,
+  0x50a19a29, 0xae47d2ba, 0x2732d8f3, 0x770fb2e7, 0xc97a31bb, 0xc4d4a8e6, 0x8c093b84, 0x8c093b84,
+  0xe0501591, 0xfb25c135, 0x6eb636ec, 0x32b3a9e5, 0x96bfe350, 0xaa366ea7, 0x2374bb7a, 0x8ffc085e,
+  0x62dc520b, 0x552874de, 0x552874de, 0x44376019, 0xefb05073, 0xc7e1bdcc, 0x950b7200, 0xa29af63f,
+  0xaf7b7a30, 0x48b3533d, 0x47938854, 0x7c025fa8, 0x807c2c9d, 0xa98f2b82, 0xa98f2b82, 0x580fa917,
+  0xad0b2412, 0x7f218c20, 0x38b510f2, 0x1015c409, 0x7f9e5cf3, 0x3e5dd4d6, 0x6fea5c79, 0xcbd45353,
+  0x50d6318d, 0x5832e26f, 0x5832e26f, 0x4f5bb7e9, 0x65c12f78, 0x841af5f2, 0x8f5d48a4, 0xd1d8332a,
+  0x405acbae, 0x93ecbb5a, 0xf3240da7, 0x309bb05d, 0x0e6fff84, 0x0e6fff84, 0xe379cfff, 0x4974dc50,
+  0xd9074d01, 0x13d16d90, 0xa168f916, 0x722acf38, 0x3dc8b2e4, 0x325d4f4f, 0x6cbcdfcb, 0x5e3b6e9c,
+  0x5e3b6e9c, 0xd18003bb, 0x2ecbed2b, 0x3742ec82, 0xb30ff7ef, 0x044e9c12, 0x62ddfd25, 0x0211e8a5,
+};
+
+static const uint32_t GOLDEN_12[] = {
+  0x63f08845, 0x3f0ffe10, 0x4f35f228, 0x2d2614b2, 0x3172939c, 0xc31d8c3a, 0x7d12a1f2, 0x76c1304a,
+  0x17d1c6e2, 0x042baae8, 0xef2e15c0, 0x2c8b99da, 0xffe1da9a, 0x706798b6, 0x93d71c84, 0xee22cf78,
+  0xe89c8d40, 0x937d8138, 0x43bf1c32, 0xc8075db6, 0xb1526216, 0x68d48a76, 0x4bc6a260, 0x33b6f9ce,
+  0xbcd59b3e, 0xd74e67d2, 0xea1c9ac2, 0x1c8e22e6, 0x3de8ec91, 0x1c8e22e6, 0x3de8ec91, 0x1c8e22e6,
+  0x3de8ec91, 0x1c8e22e6, 0x3de8ec91, 0x1c8e22e6, 0x3de8ec91, 0x1c8e22e6, 0x3de8ec91, 0x1c8e22e6,
+  0x3de8ec91, 0x1c8e22e6, 0x1c8e22e6, 0x3f0ffe10, 0xe7766604, 0x16afcef4, 0x9c0f0db8, 0x6e916ccc,
+  0xe5114eb0, 0x8f59d228, 0x5c62ec78, 0x78e8e4b8, 0x5f37d018, 0x586fd7d4, 0x5454e07c, 0x0d34f3b4,
+  0xd712141e, 0x116dcd8c, 0x627c2d5c, 0x476dca00, 0x627c74ca, 0x09147109, 0x63554843, 0x4a81c07d,
+  0x49e692fc, 0x1c582f24, 0x42376906, 0x3b993c57, 0x78e88b8b, 0xfc7ffbfe, 0xb81eaf89, 0xfc7ffbfe,
+  0xb81eaf89, 0xfc7ffbfe, 0xb81eaf89, 0xfc7ffbfe, 0xb81eaf89, 0xfc7ffbfe, 0xb81eaf89, 0xfc7ffbfe,
+  0xb81eaf89, 0xfc7ffbfe, 0xb81eaf89, 0xfc7ffbfe, 0xfc7ffbfe, 0x3f0ffe10, 0x5f6d08ac, 0xf29f4588,
+  0x50ed8598, 0xd7add7f0, 0xd07af59a, 0x38975a52, 0xd785de42, 0x728dbb22, 0xef215116, 0xac77942e,
+  0xa6a6b112, 0x32e84fea, 0x288ba70a, 0xec5db591, 0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591,
+  0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591,
+  0xec5db591, 0x3f0ffe10, 0xae0613d0, 0x30987258, 0x1fec9d00, 0xfe207e50, 0x63db0b2a, 0x005b249c,
+  0x65e26e5d, 0x9f4ccb6b, 0x3caf9f7d, 0xea34c194, 0x17620d0a, 0x42f613f8, 0x7e8777ce, 0x92b4ea38,
+  0x8bab3bc9, 0xed927171, 0x6a9db59b, 0x77e5b494, 0xbcd76326, 0x46a3a25a, 0x5d469f36, 0x2fab98f2,
+  0x2a1f344c, 0x24b8bbac, 0x15c5de53, 0xf1341ebc, 0x15c5de53, 0xf1341ebc, 0x15c5de53, 0xf1341ebc,
+  0x15c5de53, 0xf1341ebc, 0x15c5de53, 0xf1341ebc, 0x15c5de53, 0xf1341ebc, 0x15c5de53, 0xf1341ebc,
+  0xf1341ebc, 0x3f0ffe10, 0x00ac12b0, 0x92fd761c, 0xe7d251ac, 0x4f3db76c, 0x6f095a76, 0xab0dfe6c,
+  0x54c512b6, 0x9fd43c1e, 0xb7c1d8c6, 0x50ef2d24, 0x19d62e36, 0x509035c0, 0xe73d93bf, 0x78d9f36f,
+  0xd31e7991, 0x2136c16d, 0x7f1a9bff, 0xfbd5d911, 0x1fae8bd3, 0xea410171, 0x8ff8d2b9, 0x32ef02c1,
+  0x967d95a3, 0x16d0461b, 0xdcf211f3, 0x009646eb, 0x468e44c4, 0x6b7eb8c3, 0x468e44c4, 0x6b7eb8c3,
+  0x468e44c4, 0x6b7eb8c3, 0x468e44c4, 0x6b7eb8c3, 0x468e44c4, 0x6b7eb8c3, 0x468e44c4, 0x6b7eb8c3,
+  0x468e44c4, 0x6b7eb8c3, 0x468e44c4, 0x468e44c4, 0x3f0ffe10, 0x8c1e1478, 0x796269d0, 0x12fe76e0,
+};
+
+static const uint32_t GOLDEN_13[] = {
+  0x63f08845, 0x3f0ffe10, 0x4f35f228, 0x2d2614b2, 0x06507f41, 0x9a34fe5e, 0x486923f6, 0x217297ae,
+  0x6a18b296, 0x635ba6ec, 0xb8cb47ca, 0x447653e4, 0x66880614, 0x1f359b70, 0x3c34433e, 0x4833ef5d,
+  0x982c38c9, 0x15698211, 0x4c52530b, 0x0f3ca1ff, 0x409b0e7d, 0x3fb77c25, 0x7dea908f, 0xd79d15fd,
+  0x86eacb95, 0xad4165f7, 0xac169bbf, 0xbfdc3ad4, 0x4e88a8a3, 0xbfdc3ad4, 0x4e88a8a3, 0xbfdc3ad4,
+  0x4e88a8a3, 0xbfdc3ad4, 0x4e88a8a3, 0xbfdc3ad4, 0x4e88a8a3, 0xbfdc3ad4, 0x4e88a8a3, 0xbfdc3ad4,
+  0x4e88a8a3, 0xbfdc3ad4, 0xbfdc3ad4, 0x3f0ffe10, 0xe7766604, 0x10d3002c, 0xa9f7e29b, 0x3b04d66a,
+  0x412a5819, 0x56efc0b1, 0x287f04e9, 0x109ff105, 0x1f48677f, 0x48fff222, 0xdaf831aa, 0xa048f282,
+  0x2ee17b7c, 0xb596c2ea, 0x3b71e8ca, 0x685cbde2, 0x8c21eaac, 0x581b82f9, 0xfd2e1bc1, 0x463f16e9,
+  0xda528a3f, 0xf2e16ccf, 0x5aeef157, 0xa157548f, 0xc35eb327, 0xbb2a0550, 0x55fad437, 0xbb2a0550,
+  0x55fad437, 0xbb2a0550, 0x55fad437, 0xbb2a0550, 0x55fad437, 0xbb2a0550, 0x55fad437, 0xbb2a0550,
+  0x55fad437, 0xbb2a0550, 0x55fad437, 0xbb2a0550, 0xbb2a0550, 0x3f0ffe10, 0x5f6d08ac, 0xe3e92856,
+  0x22f9e2c4, 0x3fa36970, 0x265fc958, 0xf9f8f9d0, 0x2deeb798, 0x0f7be770, 0x4b5d30ad, 0x17c893f9,
+  0x4eabd444, 0x16013d74, 0x25583894, 0xd4623f0a, 0x4eadb065, 0xd4623f0a, 0x4eadb065, 0xd4623f0a,
+  0x4eadb065, 0xd4623f0a, 0x4eadb065, 0xd4623f0a, 0x4eadb065, 0xd4623f0a, 0x4eadb065, 0xd4623f0a,
+  0xd4623f0a, 0x3f0ffe10, 0xae0613d0, 0xff08c3f8, 0x8794d6e8, 0x85b79caa, 0xa45c1184, 0x9750f264,
+  0x929829bc, 0xfae21db4, 0x2114ecc2, 0x44206c35, 0xf0ec9d73, 0x5b4d9f61, 0xdc50deaf, 0x1f9edd19,
+  0xbf051902, 0xb1c60502, 0x00e5b550, 0xc4bb7097, 0x94001eeb, 0x5688b163, 0xeb99be03, 0x5e8cb283,
+  0x20b8f3dd, 0xc4a7f235, 0x19879966, 0x616d35a9, 0x19879966, 0x616d35a9, 0x19879966, 0x616d35a9,
+  0x19879966, 0x616d35a9, 0x19879966, 0x616d35a9, 0x19879966, 0x616d35a9, 0x19879966, 0x616d35a9,
+  0x616d35a9, 0x3f0ffe10, 0x00ac12b0, 0x2f7c460a, 0xe1c3b164, 0x4598a212, 0xebefd8b6, 0xc463ee58,
+  0xbab11ea2, 0xecfbca2a, 0x7fee3ec4, 0x857d9b22, 0x1c9a9980, 0xaa78470a, 0x492ce80c, 0xecb70cbc,
+  0xd8709b46, 0xf4d2447e, 0xf77fff00, 0xfadd0db6, 0x2dba71ae, 0xe3fd834c, 0xad8987f4, 0x46f1e7b8,
+  0xd2cfb0a2, 0x6259b8fa, 0x02d8f652, 0x3e700212, 0x6f3dd605, 0x064a4d82, 0x6f3dd605, 0x064a4d82,
+  0x6f3dd605, 0x064a4d82, 0x6f3dd605, 0x064a4d82, 0x6f3dd605, 0x064a4d82, 0x6f3dd605, 0x064a4d82,
+  0x6f3dd605, 0x064a4d82, 0x6f3dd605, 0x6f3dd605, 0x3f0ffe10, 0x8c1e1478, 0xec5ff850, 0xf363fef6,
+};
+
+static const uint32_t GOLDEN_14[] = {
+  0x63f08845, 0x3f0ffe10, 0x4f35f228, 0x2d2614b2, 0xdf9eee6a, 0xe3b1e6ea, 0x6ae1fd82, 0x2869ca5a,
+  0x78286fc2, 0xeca705f8, 0x2d66e5e0, 0x858bbbfa, 0xb4971cb2, 0x1de3283a, 0x46098408, 0xf45b66c9,
+  0x76dbe661, 0xcfb7b935, 0xa3d7a42f, 0x2f51da8f, 0x12096879, 0xd7d25111, 0x2ddd78bb, 0xdc9dd029,
+  0xe0838c41, 0x30553d0b, 0x7d0d6083, 0x520546f0, 0x3f4c2287, 0x520546f0, 0x3f4c2287, 0x520546f0,
+  0x3f4c2287, 0x520546f0, 0x3f4c2287, 0x520546f0, 0x3f4c2287, 0x520546f0, 0x3f4c2287, 0x520546f0,
+  0x3f4c2287, 0x520546f0, 0x520546f0, 0x3f0ffe10, 0xe7766604, 0x16afcef4, 0x9c0f0db8, 0x6e916ccc,
+  0xe5114eb0, 0x8f59d228, 0x5c62ec78, 0x78e8e4b8, 0x5f37d018, 0x586fd7d4, 0x5454e07c, 0x0d34f3b4,
+  0xd712141e, 0x116dcd8c, 0x6231658c, 0x31243bd8, 0xc6794aa2, 0x7982ecd4, 0xff1063ac, 0x82ddc664,
+  0xb7a97fc2, 0x53279c3a, 0xe764d432, 0xa3997cc4, 0x0d8a5394, 0x832a247b, 0x873e450c, 0x832a247b,
+  0x873e450c, 0x832a247b, 0x873e450c, 0x832a247b, 0x873e450c, 0x832a247b, 0x873e450c, 0x832a247b,
+  0x873e450c, 0x832a247b, 0x873e450c, 0x832a247b, 0x832a247b, 0x3f0ffe10, 0x5f6d08ac, 0xf29f4588,
+  0x50ed8598, 0xd7add7f0, 0xd07af59a, 0x38975a52, 0xd785de42, 0x728dbb22, 0xef215116, 0xac77942e,
+  0xa6a6b112, 0x32e84fea, 0x288ba70a, 0xec5db591, 0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591,
+  0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591, 0x4c61d3de, 0xec5db591,
+  0xec5db591, 0x3f0ffe10, 0xae0613d0, 0x30987258, 0x1fec9d00, 0xfe207e50, 0x63db0b2a, 0xbb66c628,
+  0xd3012417, 0x5eaea951, 0xd11a2b4f, 0x92849b90, 0xf4c40a82, 0x8dbcec8c, 0x2ba6e8c2, 0xc7bb612c,
+  0x4be85707, 0xa8fe344f, 0x1f04e731, 0x28bfbee0, 0x087a873e, 0xb00880b2, 0xfd35fb16, 0xfd91b51e,
+  0x8393e278, 0xdf71b65e, 0xff1d040f, 0x8785cb00, 0xff1d040f, 0x8785cb00, 0xff1d040f, 0x8785cb00,
+  0xff1d040f, 0x8785cb00, 0xff1d040f, 0x8785cb00, 0xff1d040f, 0x8785cb00, 0xff1d040f, 0x8785cb00,
+  0x8785cb00, 0x3f0ffe10, 0x00ac12b0, 0x92fd761c, 0xe7d251ac, 0x4f3db76c, 0x6f095a76, 0xab0dfe6c,
+  0x54c512b6, 0x6eaedb6e, 0x74ad35b6, 0xa91aec14, 0x908515d4, 0x836c0d5e, 0x1c78246e, 0x71a0edd6,
+  0xd39650ee, 0xba8dbc30, 0xce8a4838, 0x7b3f6570, 0x48456e18, 0xa486c1b6, 0x0e9f4692, 0xbd63018e,
+  0x427aa646, 0xfe435066, 0xd4e2a5b4, 0xe27d68fa, 0x9e18c8ed, 0x7543d29a, 0x9e18c8ed, 0x7543d29a,
+  0x9e18c8ed, 0x7543d29a, 0x9e18c8ed, 0x7543d29a, 0x9e18c8ed, 0x7543d29a, 0x9e18c8ed, 0x7543d29a,
+  0x9e18c8ed, 0x7543d29a, 0x9e18c8ed, 0x9e18c8ed, 0x3f0ffe10, 0x8c1e1478, 0x796269d0, 0x12fe76e0,
+};
+
+static const uint32_t GOLDEN_15[] = {
+  0x63f08845, 0x3f0ffe10, 0x965a29b4, 0xf2376a3e, 0x3e1b5dda, 0xcb8cf7e2, 0x7d015e12, 0x755e9daa,
+  0x78bd96b2, 0x69712770, 0x82d43654, 0x54ef906e, 0x544ef68e, 0xd2d00046, 0x6f8e5214, 0xe8098101,
+  0xb6e65de9, 0x405dd675, 0xfa8b3f6f, 0x9ae23fd3, 0x5144e2cf, 0x43978757, 0xf44140f1, 0x75d7c25f,
+  0x28d5b647, 0xf520ff08, 0xf8ba6060, 0xb42fc258, 0xd61b291f, 0xb42fc258, 0xd61b291f, 0xb42fc258,
+  0x25d2dc2f, 0x63415b48, 0x25d2dc2f, 0x63415b48, 0x25d2dc2f, 0x18f875a0, 0xdef85dd7, 0x18f875a0,
+  0xdef85dd7, 0x18f875a0, 0x18f875a0, 0x3f0ffe10, 0x1697402b, 0x8a9aaafa, 0xaaa49eb3, 0xfa4cd7ec,
+  0x373a2964, 0xfda6c23c, 0xe9afd6d2, 0x79a5d706, 0xd1599582, 0xc26c5bea, 0x33d1295a, 0x74ec62be,
+  0x0dc4d26c, 0xb2cce1da, 0xbdeaedba, 0x6b05b27e, 0xfb956148, 0x3b40047f, 0xe4ef50e9, 0xdf5c8257,
+  0x461e31df, 0xe72aaf4b, 0x1b10e915, 0xbe318731, 0x4364221d, 0xd76c0464, 0xe88a83a7, 0x980c87e0,
+  0xe88a83a7, 0x980c87e0, 0xe88a83a7, 0xba0175ca, 0x83e949bd, 0xba0175ca, 0x83e949bd, 0xba0175ca,
+  0xf844ab0f, 0x49d6f678, 0xf844ab0f, 0x49d6f678, 0x49d6f678, 0x3f0ffe10, 0x49283d4a, 0x7a1c55f0,
+  0xba811f58, 0xc670ecf7, 0x43811375, 0x92c93ccd, 0x4ff8eb0b, 0x11f78a19, 0xd5b777c5, 0xc20e7c1d,
+  0xca3e0685, 0xb7dadaad, 0x2599d893, 0xef75b389, 0xf32e13e6, 0xef75b389, 0x76ce30b8, 0xc74022b7,
+  0x76ce30b8, 0xc74022b7, 0x76ce30b8, 0x451a88b0, 0x7adbe8bf, 0x451a88b0, 0x7adbe8bf, 0x451a88b0,
+  0x451a88b0, 0x3f0ffe10, 0xcaa9aec6, 0x3067f7fe, 0x3ee4d07c, 0x84db8956, 0xa6216c30, 0x89467fb0,
+  0x9ddea96c, 0xd059d2f0, 0x65246ec4, 0xd5c7c614, 0xbc5b780e, 0xc5dae450, 0xd63f6596, 0x549bd200,
+  0x2661f229, 0x857c09e9, 0x8e1cac75, 0x55cd8f39, 0x851e83c7, 0x5fcec777, 0x9d7667ab, 0x7496604b,
+  0x77da33a5, 0x8677da95, 0x8c82674a, 0xd3b70a41, 0xb114d6ce, 0xd3b70a41, 0xb114d6ce, 0xd3b70a41,
+  0x74c9ab0b, 0xd2c69204, 0x74c9ab0b, 0xd2c69204, 0x74c9ab0b, 0x3a48d6ef, 0xed701e20, 0x3a48d6ef,
+  0x3a48d6ef, 0x3f0ffe10, 0xcb07c210, 0xeb30c4d3, 0xad2fc14b, 0x876c9771, 0x23e72ed1, 0x47e8d1af,
+  0x2d45c9f9, 0x907c7e3d, 0x163eb7ad, 0x5bc7a20b, 0xc80b18bf, 0x20ca5e49, 0x9ed46825, 0xb1f0fe15,
+  0x99de9a4b, 0xe675f845, 0x8dc4c7c9, 0x927fcd03, 0xdd9e4679, 0x0787fa17, 0x9cf7c00f, 0xf576a87b,
+  0xebf2f363, 0x8aed32ab, 0x422fec23, 0x0ac8a9c3, 0x597fdb7c, 0x460bcc0b, 0x461d6de8, 0x4349fd9f,
+  0x461d6de8, 0x4349fd9f, 0x461d6de8, 0xa79c6417, 0xdea81370, 0xa79c6417, 0xdea81370, 0xa79c6417,
+  0xf8b95665, 0x6c291322, 0xf8b95665, 0xf8b95665, 0x3f0ffe10, 0x17025e10, 0xf3783038, 0xffac3bba,
+};
+
+static const uint32_t GOLDEN_16[] = {
+  0x44c63e02, 0x89b44259, 0x9be3954d, 0x04729859, 0x1df1f770, 0x69a191e6, 0x78a3f057, 0x2d5df841,
+  0x7e1476a7, 0x9f718674, 0x8edce3a7, 0x03fda301, 0xb31c3879, 0x1cb91f47, 0x87967aa1, 0x8457ff60,
+  0x9f91afc3, 0xd381f57a, 0xddf30910, 0xf011f2a2, 0x0ef51992, 0xb1a57450, 0xb908e8cc, 0x86bff347,
+  0xa0de1bf0, 0x2ba7f272, 0x5392f339, 0x3938877d, 0xf188ee61, 0x9381625a, 0x6344acc1, 0xd9110f60,
+  0xeca52c18, 0x9d485878, 0x4de7b48f, 0x4461d52f, 0xe6f8ada7, 0x11647995, 0x82f2b661, 0x7aab208f,
+  0x4f410a6a, 0x01d31847, 0xe24cec9d, 0x2b01f128, 0x77dec44f, 0x668ef21c, 0x3d850b9b, 0x29850acb,
+  0x893fd1c1, 0xa6c3a780, 0x24e515b1, 0x2de50146, 0xea969e26, 0xb240ece1, 0x564cc771, 0xb4710d04,
+  0x8b29f4c8, 0x7980744f, 0xd4e2bbf8, 0x34e16643, 0xbeb27615, 0x000fd494, 0xbfd99ff2, 0x6a32cc91,
+  0xe1264a4c, 0x488ebd71, 0xf40344a1, 0xb5eca008, 0xd1e6467b, 0x18b4719f, 0xe4b93979, 0x49a8dd5a,
+  0x4839445c, 0x7e4c8706, 0xc71800de, 0x0d872152, 0xe4589f6c, 0xdf013747, 0x98af4784, 0xfde723ef,
+  0x8ffeaae0, 0xf6a38301, 0xfb9ef1cf, 0x86c21fc1, 0xffa9d11a, 0x8fa18d02, 0x680df8b0, 0xc3310768,
+  0x3dd21d8e, 0xd1b5f01e, 0x3a2e8aad, 0x016fba1f, 0x2a6c3eab, 0xbafdf4c8, 0x1950c84a, 0x05c3f8b2,
+  0xb189c495, 0x50ff2833, 0x81f91290, 0x2bfd1222, 0x4a665529, 0x480094a2, 0xb11cc690, 0x93f99ba7,
+  0x14080960, 0x69967994, 0x3affc2e0, 0x298f36e1, 0xb472422c, 0x5dfd50a9, 0x7ee614e3, 0x4b501a5f,
+  0xba9c01b4, 0x5601c566, 0x20be833f, 0xf51a1199, 0x007e0429, 0xf583299e, 0xc84a99c4, 0x47b28b49,
+  0xe6097cbc, 0xcd172669, 0x31e736ef, 0x60d37731, 0x714d208a, 0x188ebac6, 0x0c17ccc1, 0xc4c7f2ac,
+  0x9e3327cf, 0xf71f8be6, 0xd709aba6, 0x8dc7aaf4, 0xc425a4c6, 0xf40c7460, 0x919f11de, 0xdb1210c8,
+  0x3605da17, 0xf61725d2, 0x98ad0e48, 0x52b7f7aa, 0x8c43719d, 0x9927474f, 0xeea20bba, 0x2ee138a5,
+  0x7cbd9a24, 0x9bbf019f, 0x065c2d53, 0x78e134c3, 0x715d0fa3, 0xef5e52d0, 0xf244ad54, 0x158bc26e,
+  0x0fd28919, 0xe65d26a9, 0x58efa987, 0xe3d650f8, 0xe4c4c7e9, 0x11dd289a, 0x3dfc2272, 0xf21ef5bf,
+  0xc655ad55, 0x60ad94e8, 0x55ab5660, 0x6b7e325a, 0x5f0e3f1d, 0xd7591655, 0xee3a3d3f, 0x848ef407,
+  0xa2a3192c, 0xd3b3081c, 0x0f59ebbd, 0x86488ca8, 0xf0ed50c4, 0xf476a2b2, 0xbed87af8, 0x16a2c1dd,
+  0xa7271a62, 0xbbbdfd42, 0xe3a61038, 0x6205d2df, 0x93fee053, 0x2457724c, 0xb07926be, 0x23750c02,
+  0x0326a5f6, 0xba75b3b4, 0x0ccdf1d4, 0x71a5cb9a, 0x3298bd58, 0xa0c35a5b, 0xe1a02467, 0x8b95eacb,
+  0xaf2ca083, 0xe698ea6f, 0x057d31b6, 0x44812d95, 0xb19137a2, 0x37e74f42, 0xa9c81527, 0x823ab616,
+};
+
+static const GoldenCase GOLDEN_CASES[] = {
+  { "Smooth Scroll/Word-Based", GOLDEN_0, 200 },
+  { "Smooth Scroll/Rainbow Scroll", GOLDEN_1, 200 },
+  { "Smooth Scroll/Random Words", GOLDEN_2, 200 },
+  { "Smooth Scroll/Single Color", GOLDEN_3, 200 },
+  { "Character Scroll/Word-Based", GOLDEN_4, 200 },
+  { "Character Scroll/Rainbow Scroll", GOLDEN_5, 200 },
+  { "Character Scroll/Random Words", GOLDEN_6, 200 },
+  { "Character Scroll/Single Color", GOLDEN_7, 200 },
+  { "Line Slide/Word-Based", GOLDEN_8, 200 },
+  { "Line Slide/Rainbow Scroll", GOLDEN_9, 200 },
+  { "Line Slide/Random Words", GOLDEN_10, 200 },
+  { "Line Slide/Single Color", GOLDEN_11, 200 },
+  { "Cursor Wipe/Word-Based", GOLDEN_12, 200 },
+  { "Cursor Wipe/Rainbow Scroll", GOLDEN_13, 200 },
+  { "Cursor Wipe/Random Words", GOLDEN_14, 200 },
+  { "Cursor Wipe/Single Color", GOLDEN_15, 200 },
+  { "Space Animation", GOLDEN_16, 200 },
+  { nullptr, nullptr, 0 }
+};
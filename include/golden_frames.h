@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+#include "scenario_replay.h"
+
+// Golden frame configuration constants
+#define GOLDEN_FRAMES_COMMAND 'G'        // Serial command that checks against the golden hashes
+#define GOLDEN_FRAMES_RECORD_COMMAND 'g' // Serial command that prints a new golden table
+#define GOLDEN_FRAMES_AT_BOOT false      // Check once from setup()
+#define GOLDEN_FRAMES_PER_CASE 200       // Rendered frames hashed per case
+#define GOLDEN_MAX_MILLIS 600000UL       // Simulated time limit per case
+
+#if defined(ESP32)
+  #define GOLDEN_FRAMES_PLATFORM "esp32"
+#else
+  #define GOLDEN_FRAMES_PLATFORM "host"
+#endif
+
+// Stored hashes of one case, see golden_frame_table.h
+struct GoldenCase {
+  const char* name;
+  const uint32_t* hashes;
+  int count;
+};
+
+// Regression check for the rendered output. Every transition in every color
+// mode, and the space animation, is replayed from a fixed state on the
+// virtual clock (see scenario_replay.h), and each rendered frame is hashed.
+// verify() compares the hashes with the table in golden_frame_table.h and
+// prints one JSON line per case:
+//
+//   {"case":"Line Slide/Rainbow Scroll","frames":200,"status":"match"}
+//   {"case":"Cursor Wipe/Word-Based","frames":200,"status":"mismatch","first_divergent_frame":37}
+//
+// The first divergent frame of a case is dumped as a PPM image between
+// FRAME DUMP markers. record() prints a replacement golden_frame_table.h
+// between GOLDEN FRAMES markers; tools/golden_frames.py extracts both.
+//
+// Floating point and FastLED's math differ between the ESP32 and a host
+// build, so a table only applies to the platform it was recorded on.
+class GoldenFrameCheck {
+public:
+  explicit GoldenFrameCheck(DisplayController& controller);
+
+  // Returns false if any case diverged from its golden hashes
+  bool verify();
+  void record();
+
+  // Cases the last verify() found no hashes for
+  int getMissing() const { return missing; }
+
+private:
+  DisplayController& controller;
+  int missing;
+
+  int caseCount() const;
+  Scenario caseScenario(int index) const;
+  void caseName(int index, char* name, size_t length);
+  const GoldenCase* findGolden(const char* name) const;
+  void dumpFrame(const char* name, int frame);
+};
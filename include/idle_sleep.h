@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+// Idle time between frames. After each frame the loop asks the display
+// controller when the next visible change is due and sleeps until then, so a
+// sign holding a line no longer re-renders identical frames. A button edge
+// ends the sleep early so input latency does not depend on the deadline.
+class IdleSleeper {
+public:
+  IdleSleeper();
+
+  // Attach the wake-up interrupt to the button pin
+  void begin(uint8_t wakePin);
+
+  // Sleep until deadline (in millis()) or a button edge, whichever comes first.
+  // Light sleep is used for long waits when allowed. Returns microseconds slept.
+  unsigned long sleepUntil(unsigned long deadline, bool allowLightSleep);
+
+  unsigned long getLightSleepCount() const { return lightSleeps; }
+
+  // Milliseconds until deadline, 0 if already due, capped at MAX_IDLE_SLEEP
+  static unsigned long timeUntil(unsigned long deadline);
+
+private:
+  uint8_t wakePin;
+  bool started;
+  unsigned long lightSleeps;
+};
+
+// Deadline helpers that stay correct across the millis() wrap
+inline unsigned long earliestDeadline(unsigned long a, unsigned long b) {
+  return (long)(a - b) < 0 ? a : b;
+}
+
+inline unsigned long latestDeadline(unsigned long a, unsigned long b) {
+  return (int32_t)(a - b) > 0 ? a : b;
+}
+
+extern IdleSleeper g_idleSleeper;
+
+// Idle sleep configuration constants
+#define ENABLE_IDLE_SLEEP true
+#define ENABLE_LIGHT_SLEEP false     // UART and WiFi pause in light sleep; enable on standalone signs
+#define LIGHT_SLEEP_MIN_TIME 20      // milliseconds; shorter waits block the task instead
+#define MAX_IDLE_SLEEP 100           // milliseconds; keeps reports and clock sync running on a held display
@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "font.h"
+
+class ContentManager;
+
+// Forward declarations
+extern CRGB* leds;
+extern void set_led(int16_t x, int16_t y, CRGB color);
+extern void write_character(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset);
+extern void write_character_rows(const Font& font, uint8_t character, uint16_t pos, int y, CRGB color);
+extern void suspend_output(bool suspended); // show_frame() returns at once while suspended
+
+// Kernel benchmark configuration constants
+#define KERNEL_BENCHMARK_COMMAND 'B'          // Serial command that runs the suite
+#define KERNEL_BENCHMARK_AT_BOOT false        // Run once from setup()
+#define KERNEL_BENCHMARK_SAMPLES 7            // Timed samples per kernel
+#define KERNEL_BENCHMARK_SAMPLE_MICROS 20000  // Iterations double until one sample takes this long
+#define KERNEL_BENCHMARK_MAX_ITERATIONS (1UL << 24)
+#define KERNEL_BENCHMARK_SCALING_MIN 8        // Chain lengths, in characters, for the scaling runs;
+#define KERNEL_BENCHMARK_SCALING_MAX 512      // doubled from the first to the last
+
+// Times the rendering and text kernels one at a time, away from the frame
+// loop and the LED output. Each kernel's iteration count is scaled until a
+// sample is long enough to time with micros(), then the median and fastest
+// of several samples are printed as one JSON object per line:
+//
+//   {"kernel":"write_character","ns_per_op":2731,"min_ns_per_op":2702,"iterations":8192,"samples":7}
+//
+// between "=== KERNEL BENCHMARK BEGIN ===" and "=== KERNEL BENCHMARK END ===".
+// The glyph kernels are timed once compiled for the runtime geometry and once
+// for the loaded sign's fixed geometry, if it has one, as "<kernel>/runtime"
+// and "<kernel>/row32" and so on (see render_kernels.h).
+// The suite ends with scaling runs of a full-frame pass on chains from 8 to
+// 512 characters, named "newlineFrame/<characters>/<segments>": one segment
+// on the caller alone, then split across the segment workers where the
+// chain is wide enough.
+// tools/compare_benchmarks.py compares two captured runs.
+class KernelBenchmark {
+public:
+  // Stories are copied from the live content manager; its state is not touched
+  explicit KernelBenchmark(const ContentManager& stories);
+
+  // Run the whole suite; leds[] is restored afterwards
+  void run();
+
+private:
+  typedef void (*Kernel)(void* context, unsigned long iteration);
+
+  const ContentManager& stories;
+
+  unsigned long timeIterations(Kernel kernel, void* context, unsigned long iterations);
+  void measure(const char* name, Kernel kernel, void* context);
+  void measureKernelSets();
+  void measureScaling();
+};
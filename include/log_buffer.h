@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include "task_runner.h"
+
+// Deferred logging. log() copies the format pointer and its arguments into a
+// preallocated queue and returns; formatting and the UART write happen in
+// drain(), which the io task (or the single-context loop after a frame) calls.
+// drain() only writes what fits in the UART transmit buffer, so it never
+// blocks either. A full queue drops the message and counts it.
+//
+// Arguments are stored as machine words: formats may use integer, character
+// and %s conversions, and strings must outlive the entry (literals, or names
+// such as getColorModeName()). Floating-point arguments do not compile.
+
+// Logging configuration constants
+#define ENABLE_DEFERRED_LOGGING true  // false prints each message when it is logged
+#define LOG_BUFFER_ENTRIES 32
+#define LOG_MAX_ARGS 6
+#define LOG_LINE_LENGTH 128
+
+class LogArg {
+public:
+  LogArg(bool value) : word(value) {}
+  LogArg(char value) : word(value) {}
+  LogArg(int value) : word(value) {}
+  LogArg(unsigned int value) : word(value) {}
+  LogArg(long value) : word(value) {}
+  LogArg(unsigned long value) : word(value) {}
+  LogArg(const char* value) : word(reinterpret_cast<intptr_t>(value)) {}
+  LogArg(double value) = delete;
+
+  intptr_t word;
+};
+
+struct LogEntry {
+  unsigned long time;   // millis() when logged
+  const char* format;
+  intptr_t args[LOG_MAX_ARGS];
+};
+
+class LogBuffer {
+public:
+  LogBuffer();
+
+  // Safe to call from any task; never blocks
+  template <typename... Args>
+  void log(const char* format, Args... args) {
+    static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+    const LogArg packed[] = { LogArg(args)..., LogArg(0) }; // Trailing entry keeps the array non-empty
+    push(format, packed, sizeof...(Args));
+  }
+
+  // Write out queued messages while the UART has room; call from idle time
+  void drain();
+
+  unsigned long getDropped() const { return entries.getDropped(); }
+
+private:
+  BoundedQueue<LogEntry, LOG_BUFFER_ENTRIES> entries;
+  unsigned long reportedDropped;
+
+  // Line being written; kept across drains when the UART fills mid-line
+  char line[LOG_LINE_LENGTH];
+  size_t lineLength;
+  size_t lineWritten;
+
+  void push(const char* format, const LogArg* args, int count);
+  size_t formatEntry(const LogEntry& entry, char* out, size_t length);
+  bool writePending();
+};
+
+extern LogBuffer g_logBuffer;
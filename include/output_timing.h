@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+#include "topology.h"
+
+// Output timing configuration constants
+#define OUTPUT_TIMING_COMMAND 'O'        // Serial command that prints the predictions
+#define OUTPUT_TIMING_AT_BOOT false      // Print once from setup()
+#define OUTPUT_WIRE_MICROS_PER_LED 30    // WS2812 at 800kHz: 24 bits of 1.25us
+#define OUTPUT_LATCH_MICROS 300          // Reset time between frames
+#define OUTPUT_START_MICROS 30           // Estimate: starting one more output within FastLED.show()
+#define OUTPUT_TIMING_BLOCKS_MIN 8       // Chain lengths, in blocks, of the prediction table;
+#define OUTPUT_TIMING_BLOCKS_MAX 512     // doubled from the first to the last
+
+// Predicts how long FastLED.show() takes for a chain split across outputs.
+// The outputs send in parallel, so the longest share sets the wire time; each
+// output after the first adds the time to start it. With one output this is
+// the plain wire time of the chain.
+//
+// run() prints the prediction for the loaded sign, with the fewest outputs
+// that reach the smooth scroll rate, then a table for chains of 8 to 512
+// blocks on 1, 2, 4 and 8 outputs, one JSON object per line between
+// "=== OUTPUT TIMING BEGIN ===" and "=== OUTPUT TIMING END ===":
+//
+//   {"blocks":128,"leds":4480,"outputs":4,"longest_output":1120,"show_us":33990,"max_fps":29}
+class OutputTiming {
+public:
+  // The first count LEDs of a chain of blocks split across outputs
+  static unsigned long showMicros(int blocks, int outputs, int count);
+
+  // The whole of the loaded chain, or its first count LEDs
+  static unsigned long showMicros(const Topology& topology) { return showMicros(topology, topology.getLedCount()); }
+  static unsigned long showMicros(const Topology& topology, int count) {
+    return showMicros(topology.getBlockCount(), topology.getOutputCount(), count);
+  }
+
+  // Refreshes per second the output allows
+  static unsigned long maxFps(unsigned long showMicros) { return (1000000UL + showMicros / 2) / showMicros; }
+
+  static void run();
+};
@@ -1,31 +1,171 @@
 #pragma once
 #include <Arduino.h>
+#include "task_runner.h"
+#include "trace_buffer.h"
+#include "telemetry.h"
+#include "allocation_tracker.h"
+
+// Fixed-memory latency histogram. Values below 16us get a bucket each; above
+// that every power of two is split into 8 buckets, so a percentile read back
+// at the bucket midpoint is within ~6% of the true value.
+#define HISTOGRAM_LINEAR_BUCKETS 16
+#define HISTOGRAM_SUB_BUCKET_BITS 3
+#define HISTOGRAM_SUB_BUCKETS (1 << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_MAX_OCTAVE 24   // Values from 2^24us (~16.8s) share the last bucket
+#define HISTOGRAM_BUCKETS (HISTOGRAM_LINEAR_BUCKETS + (HISTOGRAM_MAX_OCTAVE - 4) * HISTOGRAM_SUB_BUCKETS)
+
+struct LatencyHistogram {
+  uint16_t counts[HISTOGRAM_BUCKETS];
+  unsigned long max;
+
+  LatencyHistogram() { clear(); }
+  void clear();
+  void record(unsigned long micros);
+  unsigned long count() const;
+  unsigned long percentile(float fraction) const; // microseconds, 0 when empty
+
+  static int bucketFor(unsigned long micros);
+  static unsigned long bucketMidpoint(int bucket);
+};
+
+#define MAX_TIMER_METRICS 24
+
+// A named timing point. Timers are defined at namespace scope (DEFINE_TIMER)
+// so they join the registry during static initialization, and the report
+// lists every registered timer - a new timing point needs no new field.
+// Counters only grow so that timers used on other tasks can be differenced.
+class TimerMetric {
+public:
+  TimerMetric(const char* name);
+  
+  void add(unsigned long micros);
+  const char* getName() const { return name; }
+  int getIndex() const { return index; }
+  unsigned long getTotalMicros() const { return totalMicros; }
+  unsigned long getCalls() const { return calls; }
+  unsigned long takeMaxMicros(); // Reset by the reporter each window
+  
+  static int getCount() { return count; }
+  static TimerMetric* get(int index) { return registry[index]; }
+  
+private:
+  const char* name;
+  int index;  // -1 when the registry was full
+  unsigned long totalMicros;
+  unsigned long calls;
+  unsigned long maxMicros;
+  
+  static TimerMetric* registry[MAX_TIMER_METRICS];
+  static int count;
+};
+
+// Times the enclosing scope into a TimerMetric, and into the trace buffer
+// when tracing is on. Every return path is covered by the destructor.
+class ScopedTimer {
+public:
+  explicit ScopedTimer(TimerMetric& metric) : metric(metric), start(micros()) {}
+  ~ScopedTimer();
+  
+private:
+  TimerMetric& metric;
+  unsigned long start;
+  
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+// One timer's share of a report window
+struct TimerSample {
+  unsigned long totalMicros = 0;
+  unsigned long calls = 0;
+  unsigned long maxMicros = 0;
+};
+
+// Heap allocations made by mode frames for one mode/transition pair
+struct AllocationSite {
+  const char* mode = "";
+  const char* transition = "";  // Empty outside text content
+  unsigned long frames = 0;
+  unsigned long allocations = 0;
+  unsigned long bytes = 0;
+};
 
 // Performance benchmarking structures and utilities
 struct PerformanceMetrics {
-  unsigned long totalFrameTime = 0;
-  unsigned long fastLEDShowTime = 0;
-  unsigned long characterWriteTime = 0;
-  unsigned long scrollTime = 0;
-  unsigned long calculationTime = 0;
   unsigned long frameCount = 0;
-  unsigned long visualUpdateCount = 0; // Track actual FastLED.show() calls
+  unsigned long visualUpdateCount = 0; // Track frames handed to the LED output
   unsigned long charactersScrolled = 0; // Track character position changes for CPS
+  unsigned long idleTime = 0; // Microseconds the frame loop slept waiting for a deadline
   unsigned long lastReportTime = 0;
   unsigned long maxFrameTime = 0;
   unsigned long minFrameTime = ULONG_MAX;
+  unsigned long framesOverBudget = 0;
+  int qualityLevel = 0;                 // Adaptive quality level in effect (0 = full)
+  unsigned long qualityChanges = 0;     // Level changes this window
+  
+  // Per-window distributions that averages hide
+  LatencyHistogram frameTimes;  // Whole update() call
+  LatencyHistogram renderTimes; // Active mode's frame, including the show hand-off
+  LatencyHistogram showTimes;   // FastLED.show() itself
+  
+  // Allocations made by mode frames, by the mode and transition that made them
+  AllocationSite allocationSites[MAX_ALLOCATION_SITES];
+  int allocationSiteCount = 0;
+  unsigned long allocatingFrames = 0;
+};
+
+#define MAX_MONITORED_TASKS 4
+
+// Metrics for one report window, handed from the render context to the reporter
+struct PerformanceSnapshot {
+  PerformanceMetrics metrics;
+  unsigned long interval = 0; // milliseconds covered by the snapshot
+  TimerSample timers[MAX_TIMER_METRICS]; // Indexed like the timer registry
+  TaskStats tasks[MAX_MONITORED_TASKS];  // Per-task totals for this window only
+  int taskCount = 0;
+  AllocationCount allocations;           // Every task, this window only
+  unsigned long frees = 0;
+  unsigned long freeHeap = 0;
+  unsigned long largestFreeBlock = 0;
 };
 
 class PerformanceMonitor {
 public:
   PerformanceMonitor(bool enabled = true);
   
-  void startTimer(unsigned long* startTime);
-  void endTimer(unsigned long startTime, unsigned long& accumulator);
-  void endFastLEDTimer(unsigned long startTime, unsigned long& accumulator);
   void reportPerformance();
+  bool isReportDue() const;
+  
+  // Split reporting: take (and reset) the window where the metrics are written,
+  // send wherever slow serial output cannot delay a frame. sendReport() writes
+  // a binary telemetry record or the text report, per ENABLE_BINARY_TELEMETRY.
+  bool takeSnapshot(PerformanceSnapshot& snapshot);
+  void sendReport(const PerformanceSnapshot& snapshot);
+  void printReport(const PerformanceSnapshot& snapshot);
+  void writeTelemetry(const PerformanceSnapshot& snapshot);
+  
+  // Per-task timing shown in the report
+  void registerTask(TaskStats* stats);
   void incrementFrame();
+  void incrementVisualUpdate() { metrics.visualUpdateCount++; }
   void incrementCharactersScrolled(int count = 1);
+  void addIdleTime(unsigned long micros);
+  void setQualityLevel(int level);
+  
+  // Distribution samples. recordShowTime() may be called from the LED output
+  // context; its histogram only grows and is differenced at each snapshot.
+  void setFrameBudget(unsigned long micros) { frameBudget = micros; }
+  void recordFrameTime(unsigned long micros);
+  void recordRenderTime(unsigned long micros);
+  void recordShowTime(unsigned long micros);
+  unsigned long getShowCount() const { return showCount; }   // Grow-only, for callers timing their own windows
+  unsigned long getShowMicros() const { return showMicros; }
+  
+  // Heap allocations made by one mode frame. A frame that allocates once the
+  // mode and transition have warmed up is counted, and with ALLOCATION_CHECK
+  // set also reported as an error.
+  void recordAllocations(const char* mode, const char* transition, const AllocationCount& frame);
+  unsigned long getSteadyAllocatingFrames() const { return steadyAllocatingFrames; } // Grow-only
   
   PerformanceMetrics& getMetrics() { return metrics; }
   bool isEnabled() const { return enabled; }
@@ -33,19 +173,51 @@ public:
 private:
   PerformanceMetrics metrics;
   bool enabled;
+  unsigned long frameBudget;
+  
+  // Show times arrive from the output task. It records into one window while
+  // the reporter takes the other; the lock covers a record and the swap.
+  LatencyHistogram showWindows[2];
+  int showWindow;
+  SpinLock showLock;
+  volatile unsigned long showCount;
+  volatile unsigned long showMicros;
+  TimerSample lastTimers[MAX_TIMER_METRICS]; // Timer totals at the previous snapshot
+  
+  AllocationCount lastAllocations; // Allocation totals at the previous snapshot
+  unsigned long lastFrees;
+  const char* steadyMode;          // Mode and transition of the running steady state
+  const char* steadyTransition;
+  unsigned long steadyFrames;
+  unsigned long steadyAllocatingFrames;
+  
+  TaskStats* tasks[MAX_MONITORED_TASKS];
+  TaskStats lastTaskStats[MAX_MONITORED_TASKS]; // Totals at the previous report
+  int taskCount;
+  
+  TelemetryEncoder telemetry;
+  
+  void printTaskReport(const PerformanceSnapshot& snapshot);
+  void printHistogram(const char* label, const LatencyHistogram& histogram);
+  void printTimerReport(const PerformanceSnapshot& snapshot);
+  void printAllocationReport(const PerformanceSnapshot& snapshot);
 };
 
-// Macro definitions for easy timing
 extern PerformanceMonitor* g_perfMonitor;
 
+// Timers the report derives its summary from; defined in performance_monitor.cpp
+extern TimerMetric frame_timer; // One update() of the frame loop
+extern TimerMetric show_timer;  // One show_frame() - the LED write or the hand-off to the output task
+
 #define ENABLE_BENCHMARKING true  // Global setting
 
+// DEFINE_TIMER(name) at namespace scope declares name_timer; TIME_SCOPE(name)
+// times the rest of the enclosing block. Both compile to nothing when
+// benchmarking is disabled.
 #if ENABLE_BENCHMARKING
-  #define START_TIMER(var) unsigned long var##_start = 0; if(g_perfMonitor) g_perfMonitor->startTimer(&var##_start)
-  #define END_TIMER(var, accumulator) if(g_perfMonitor) g_perfMonitor->endTimer(var##_start, accumulator)
-  #define END_FASTLED_TIMER(var, accumulator) if(g_perfMonitor) g_perfMonitor->endFastLEDTimer(var##_start, accumulator)
+  #define DEFINE_TIMER(name) static TimerMetric name##_timer(#name)
+  #define TIME_SCOPE(name) ScopedTimer name##_scope(name##_timer)
 #else
-  #define START_TIMER(var) 
-  #define END_TIMER(var, accumulator)
-  #define END_FASTLED_TIMER(var, accumulator) if(g_perfMonitor) g_perfMonitor->getMetrics().visualUpdateCount++
-#endif 
\ No newline at end of file
+  #define DEFINE_TIMER(name)
+  #define TIME_SCOPE(name)
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+
+// What one quality level keeps. Each level sheds load on top of the one before.
+struct QualitySettings {
+  const char* name;
+  uint8_t starPercent;      // Share of the starfield that is simulated and drawn
+  bool nebula;              // Background nebula behind the space animation
+  uint8_t scrollStride;     // Fewest smooth scroll sub-steps between frames
+  uint8_t intervalScale;    // Multiplier on the cadence of paced modes
+};
+
+#define NUM_QUALITY_LEVELS 4
+
+// Adaptive quality. The controller watches what each mode frame costs against
+// the frame budget, one window of frames at a time. A window where too many
+// frames overran drops one level; only several quiet windows in a row - no
+// overruns and well under budget - raise it again, so a level that barely
+// fits does not flap. The window after a change is discarded while the new
+// level settles.
+class QualityController {
+public:
+  explicit QualityController(unsigned long targetMicros);
+
+  // One mode frame; returns true when the level changed
+  bool recordFrame(unsigned long micros);
+
+  // Back to full quality with a fresh window
+  void reset();
+
+  // While disabled the level stays where it is
+  void setAdaptive(bool enabled) { adaptive = enabled; }
+  bool isAdaptive() const { return adaptive; }
+
+  int getLevel() const { return level; }
+  const QualitySettings& getSettings() const { return getSettings(level); }
+  unsigned long getLastWindowAverage() const { return lastWindowAverage; }
+
+  static const QualitySettings& getSettings(int level);
+
+private:
+  unsigned long targetMicros;
+  bool adaptive;
+  int level;
+
+  // Current window
+  int windowFrames;
+  int windowOverruns;
+  unsigned long windowMicros;
+
+  int quietWindows;   // Consecutive windows that would allow a higher level
+  bool settling;      // Discard the first window after a change
+  unsigned long lastWindowAverage;
+
+  void startWindow();
+};
+
+// Quality configuration constants
+#define ENABLE_ADAPTIVE_QUALITY true
+#define QUALITY_WINDOW_FRAMES 25          // Mode frames per decision (~1s at 25 FPS)
+#define QUALITY_SHED_PERCENT 20           // Overrunning frames in a window that drop a level
+#define QUALITY_RESTORE_PERCENT 60        // Average cost, as a share of the budget, that allows a higher level
+#define QUALITY_RESTORE_WINDOWS 4         // Quiet windows in a row before raising the level
@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "font.h"
+#include "topology.h"
+
+// Render kernel configuration constants
+#define ENABLE_FIXED_GEOMETRY true   // Use kernels compiled for the sign's size when there are some
+
+// The glyph kernels behind write_character(), write_character_rows() and
+// draw_glyph(). Each set is one template compiled for one display geometry.
+// The runtime set looks every pixel up in the topology's map and works on
+// any sign. The fixed sets are compiled for one row of 8, 16, 32 or 64
+// blocks, chained left to right and mounted normally. On those, a block's
+// LEDs follow each other in the chain, so pixel positions are constant
+// arithmetic and a glyph that lies wholly on the display is written
+// without any bounds checks.
+struct RenderKernels {
+  const char* name;
+  void (*writeCharacter)(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset);
+  void (*writeCharacterRows)(const Font& font, uint8_t character, uint16_t pos, int y, CRGB color);
+  int (*drawGlyph)(const Font& font, uint8_t character, int x, int y, CRGB color);
+
+  // Works with any topology
+  static const RenderKernels& runtime();
+
+  // The fixed set compiled for this topology, or runtime() if there is none
+  static const RenderKernels& select(const Topology& topology);
+};
+
+// The set in use; chosen in setup() once the topology is loaded
+extern const RenderKernels* g_renderKernels;
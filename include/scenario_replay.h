@@ -0,0 +1,97 @@
+#pragma once
+#include <Arduino.h>
+#include "display_controller.h"
+#include "topology.h"
+#include "output_timing.h"
+
+// Forward declarations
+extern void suspend_output(bool suspended); // show_frame() returns at once while suspended
+
+// Scenario replay configuration constants
+#define SCENARIO_REPLAY_COMMAND 'R'           // Serial command that runs the scenarios
+#define SCENARIO_REPLAY_AT_BOOT false         // Run once from setup()
+#define SCENARIO_SEED 12345UL                 // random() and random8() seed at the start of every scenario
+#define SCENARIO_CLOCK_START_MICROS 1000000ULL // Simulated time at the start of every scenario
+#define SCENARIO_DURATION_MILLIS 60000UL      // Simulated time per scenario
+#define FRAME_HASH_SEED 2166136261UL          // FNV-1a offset basis
+#define SCENARIO_FRAME_MICROS OutputTiming::showMicros(g_topology) // LED output time per frame
+
+// A button gesture at a fixed point in simulated time
+struct ScenarioEvent {
+  unsigned long atMillis;  // From the start of the scenario
+  InputEvent input;
+};
+
+// Fixed starting state plus a script of button presses
+struct Scenario {
+  const char* name;
+  DisplayMode mode;
+  TransitionType transition;
+  ColorMode colorMode;
+  int story;
+  const ScenarioEvent* events;
+  int eventCount;
+};
+
+// Replays the built-in scenarios on a virtual clock (see virtual_clock.h)
+// with seeded random numbers and scripted button presses, so each run does
+// exactly the same work. Simulated time only moves between frames: by the
+// LED output time after a frame that rendered, otherwise straight to the
+// controller's next wake time. Each scenario prints one JSON line between
+// "=== SCENARIO REPLAY BEGIN ===" and "=== SCENARIO REPLAY END ===", e.g.
+//
+//   {"scenario":"space_animation","unit":"cycles","frames":1770,"per_frame_p50":512000,
+//    "per_frame_p90":540000,"per_frame_max":610000,"per_minute":906240000,"frame_hash":"9c1d03aa"}
+//
+// Work is counted in CPU cycles on the ESP32 and in retired instructions on
+// a host build (nanoseconds if the host has no performance counters). It
+// covers every update() call, idle frames included; the percentiles cover the
+// frames where the mode ran. frame_hash folds every rendered frame, so two
+// runs that drew the same pixels report the same hash.
+//
+// The controller's mode, transition, story and color mode are restored
+// afterwards. Clock sync must be off for runs to be reproducible.
+class ScenarioReplay {
+public:
+  explicit ScenarioReplay(DisplayController& controller);
+
+  // Run every built-in scenario; false in builds without the virtual clock
+  bool run();
+
+  // The built-in scenarios, in the order run() replays them
+  static int getScenarioCount();
+  static const Scenario& getScenario(int index);
+
+  // Steps of a replay, for other deterministic runs (see golden_frames.h).
+  // open() takes the controller over - no button, reports or LED output -
+  // and close() gives it back as it was. open() fails, and takes nothing
+  // over, in builds without the virtual clock.
+  bool open();
+  void close();
+  void start(const Scenario& scenario, uint64_t clockMicros = SCENARIO_CLOCK_START_MICROS); // Virtual clock, seed and starting state
+  bool frame();                         // One update(); true if the mode ran
+  void stop();                          // Back to the real clock
+  unsigned long elapsed() const;        // Simulated milliseconds since start()
+  uint32_t getLastWork() const { return lastWork; }
+  static uint32_t hashFrame(uint32_t hash); // FNV-1a over leds[], chained frame to frame
+
+private:
+  DisplayController& controller;
+
+  // Saved by open()
+  DisplayMode savedMode;
+  TransitionType savedTransition;
+  int savedStory;
+  ColorMode savedColorMode;
+  bool savedInlineInput;
+  bool savedInlineReporting;
+  std::vector<FontId> savedFonts; // Per story; scenarios always use DEFAULT_FONT
+
+  // Scenario being replayed
+  const Scenario* scenario;
+  int nextEvent;
+  unsigned long startMillis;
+  uint32_t lastWork;
+
+  void replay(const Scenario& scenario);
+};
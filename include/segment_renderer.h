@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+#include "task_runner.h"
+
+// Segment renderer configuration constants
+#define ENABLE_SEGMENT_RENDERING true     // Split wide full-frame passes across worker tasks
+#define SEGMENT_WORKERS 1                 // Workers besides the caller; the ESP32 has one other core
+#define SEGMENT_MIN_COLUMNS 160           // Pixels per segment at least; the 32-cell sign stays on the caller
+#define SEGMENT_WORKER_PRIORITY RENDER_TASK_PRIORITY
+#define SEGMENT_WORKER_CORE OUTPUT_TASK_CORE
+
+// Runs a full-frame pass as column segments in parallel. The caller draws
+// the first segment while each worker task draws one of the others, then
+// waits for them all, so the frame is complete when render() returns.
+//
+// A kernel must draw each pixel from its coordinates and the context alone:
+// it may only write pixels in columns [xBegin, xEnd) and must not touch
+// shared state such as random() or the timing points. Segments start on
+// block boundaries, so no two segments write the same block of LEDs. The
+// output is then the same however many segments there are.
+class SegmentRenderer {
+public:
+  typedef void (*Kernel)(void* context, int xBegin, int xEnd);
+
+  SegmentRenderer();
+
+  // Starts the workers; until then, and while disabled, passes run on the caller
+  bool begin();
+
+  void render(Kernel kernel, void* context, int width);
+
+  // Segments a pass over this many columns would be split into
+  int segmentsFor(int width) const;
+
+  // The kernel benchmarks compare both ways on the same display
+  void setEnabled(bool enabled) { this->enabled = enabled; }
+  bool isEnabled() const { return enabled; }
+
+  TaskStats& getWorkerStats(int worker) { return workers[worker].task.getStats(); }
+
+private:
+  struct Job {
+    Kernel kernel;
+    void* context;
+    int xBegin;
+    int xEnd;
+  };
+
+  struct Worker {
+    Worker();
+    BoundedQueue<Job, 1> jobs;
+    BoundedQueue<uint8_t, 1> done;
+    Task task;
+  };
+
+  Worker* workers;  // Created by begin() and kept for good, like the other tasks
+  bool started;
+  bool enabled;
+
+  static void workerStep(Task& task);
+};
+
+extern SegmentRenderer g_segmentRenderer;
@@ -0,0 +1,135 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+// Shared time base for several controllers that together form one long sign.
+//
+// One controller is the master; every other controller periodically sends a
+// sync request and estimates its offset to the master clock NTP-style:
+//   offset = ((t1 - t0) + (t2 - t3)) / 2,  delay = (t3 - t0) - (t2 - t1)
+// The sample with the lowest round trip in a small window wins, since queueing
+// delay is what skews an estimate.
+//
+// Packet layout (little endian):
+//   magic 'R' 'C' | type | sequence | t0:u64 | t1:u64 | t2:u64
+
+#define CLOCK_SYNC_MAGIC_0 'R'
+#define CLOCK_SYNC_MAGIC_1 'C'
+#define CLOCK_SYNC_PACKET_SIZE 28
+#define CLOCK_SYNC_REQUEST 1
+#define CLOCK_SYNC_RESPONSE 2
+#define CLOCK_SYNC_WINDOW 8
+#define CLOCK_SYNC_UNANSWERED_LIMIT 3  // Requests a follower sends to the master unanswered before it broadcasts again
+
+// Moves sync packets between controllers
+class ClockTransport {
+public:
+  virtual ~ClockTransport() = default;
+  virtual bool send(const uint8_t* data, size_t length) = 0;
+  virtual int receive(uint8_t* data, size_t capacity) = 0; // Returns bytes read, 0 if none
+};
+
+// In-memory transport pair standing in for the network on a single machine.
+// Packets become visible to the peer after a configurable one-way delay.
+class LoopbackClockTransport : public ClockTransport {
+public:
+  LoopbackClockTransport(unsigned long delayMicros = 0) : peer(nullptr), delayMicros(delayMicros) {}
+
+  static void connect(LoopbackClockTransport& a, LoopbackClockTransport& b) { a.peer = &b; b.peer = &a; }
+
+  bool send(const uint8_t* data, size_t length) override;
+  int receive(uint8_t* data, size_t capacity) override;
+
+private:
+  struct Packet {
+    unsigned long deliverAt;
+    std::vector<uint8_t> data;
+  };
+
+  LoopbackClockTransport* peer;
+  unsigned long delayMicros;
+  std::vector<Packet> inbox;
+};
+
+#if defined(ESP32)
+#include <WiFiUdp.h>
+
+// UDP transport. The master answers each request at the address it came
+// from. A follower broadcasts its requests until the master answers, then
+// sends them to the master alone, and broadcasts again if the master stops
+// answering. Requests followers broadcast are seen by the other followers
+// too, so only the master takes its peer from a request.
+// WiFi must be connected by the application before packets will flow.
+class UdpClockTransport : public ClockTransport {
+public:
+  UdpClockTransport(uint16_t port, bool master)
+    : port(port), master(master), started(false), hasPeer(false), unanswered(0) {}
+
+  bool send(const uint8_t* data, size_t length) override;
+  int receive(uint8_t* data, size_t capacity) override;
+
+private:
+  WiFiUDP udp;
+  uint16_t port;
+  bool master;
+  bool started;
+  bool hasPeer;
+  IPAddress lastPeer;
+  int unanswered;  // Follower: requests sent to lastPeer since its last response
+
+  bool ensureStarted();
+};
+#endif
+
+class SharedClock {
+public:
+  SharedClock(ClockTransport* transport, bool master);
+
+  // Service the protocol; call once per loop
+  void update();
+
+  // Shared time in microseconds (64-bit, does not wrap)
+  uint64_t nowMicros() const;
+  unsigned long nowMillis() const { return (unsigned long)(nowMicros() / 1000); }
+
+  bool isMaster() const { return master; }
+  bool isSynced() const { return master || synced; }
+  int64_t getOffsetMicros() const { return offsetMicros; }
+  unsigned long getRoundTripMicros() const { return roundTripMicros; }
+
+  // Local monotonic microseconds, extended past the 32-bit micros() wrap
+  static uint64_t localMicros();
+
+private:
+  struct Sample {
+    int64_t offset;
+    unsigned long roundTrip;
+  };
+
+  ClockTransport* transport;
+  bool master;
+  bool synced;
+  uint8_t sequence;
+  int64_t offsetMicros;
+  unsigned long roundTripMicros;
+  unsigned long lastRequestTime;
+
+  Sample samples[CLOCK_SYNC_WINDOW];
+  int sampleCount;
+  int sampleIndex;
+
+  void sendRequest();
+  void handlePacket(const uint8_t* packet, uint64_t receivedAt);
+  void addSample(int64_t offset, unsigned long roundTrip);
+};
+
+extern SharedClock* g_sharedClock;
+
+// Clock sync configuration constants
+#define CLOCK_SYNC_ENABLED false          // Synchronize scrolling with other controllers
+#define CLOCK_SYNC_MASTER true            // Exactly one controller on the sign is master
+#define CLOCK_SYNC_PORT 4210              // UDP port for sync packets
+#define CLOCK_SYNC_INTERVAL 1000          // milliseconds between sync requests
+#define CLOCK_SYNC_COLUMN_OFFSET 0        // First virtual display column driven by this controller
+#define CLOCK_SYNC_WIFI_SSID ""
+#define CLOCK_SYNC_WIFI_PASSWORD ""
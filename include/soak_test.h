@@ -0,0 +1,56 @@
+#pragma once
+#include <Arduino.h>
+#include "scenario_replay.h"
+#include "performance_monitor.h"  // For LatencyHistogram
+
+// Soak test configuration constants
+#define SOAK_TEST_COMMAND 'S'                  // Serial command that runs the soak test
+#define SOAK_TEST_AT_BOOT false                // Run once from setup()
+#define SOAK_DURATION_HOURS 168                // Simulated time - one week
+#define SOAK_CHECKPOINT_HOURS 6                // Simulated time between checkpoints
+#define SOAK_WRAP_LEAD_MILLIS 3600000UL        // Start this long before millis() wraps
+#define SOAK_MODE_INTERVAL_MILLIS 1800000UL    // Long press - every mode once per 3 hours
+#define SOAK_PRESS_INTERVAL_MILLIS 300000UL    // Short press in text mode - next transition
+#define SOAK_MAX_FRAME_GAP_MILLIS 30000UL      // Longest a mode may go without rendering
+#define SOAK_MAX_ALLOCATION_GROWTH 16          // Live allocations gained from the first to the last checkpoint
+#define SOAK_MAX_HEAP_LOSS 4096                // Bytes of free heap or largest block lost, where measurable
+#define SOAK_MAX_COST_DRIFT_PERCENT 50         // Cheapest window median of the second half against the first
+
+// Long-running stability check on the virtual clock (see scenario_replay.h).
+// The controller runs for simulated weeks, starting shortly before the 49.7
+// day millis() wraparound, with a long press every half hour so every mode
+// keeps coming round, and a short press every few minutes in text mode so
+// every transition does too. Each checkpoint prints one JSON line:
+//
+//   {"soak_hours":6,"millis":12345678,"frames":612000,"live_allocations":41,"free_heap":180000,
+//    "min_free_heap":171000,"largest_block":110000,"per_frame_p50":512000,"max_frame_gap_ms":10200}
+//
+// and the run ends with a summary line whose "status" is "pass" or "fail".
+// It fails if live allocations or free heap keep dropping, if any mode stops
+// rendering for longer than SOAK_MAX_FRAME_GAP_MILLIS (a timer broken by the
+// wraparound), if the median cost of a frame drifts, or if millis() never
+// wrapped. Hosts cannot measure free heap, so there "heap_checks" reads
+// "skipped" rather than passing them. Frames render as
+// fast as the CPU allows, so a simulated week takes minutes on a host build
+// and hours on the ESP32.
+class SoakTest {
+public:
+  explicit SoakTest(DisplayController& controller);
+
+  // Returns false if any check failed
+  bool run();
+
+private:
+  DisplayController& controller;
+
+  // Values at one checkpoint
+  struct Checkpoint {
+    unsigned long liveAllocations;
+    unsigned long freeHeap;
+    unsigned long largestBlock;
+    unsigned long perFrameMedian;
+  };
+
+  void pressButtons(unsigned long elapsed, unsigned long& nextMode, unsigned long& nextPress);
+  Checkpoint takeCheckpoint(int hours, unsigned long frames, const LatencyHistogram& perFrame, unsigned long maxGap);
+};
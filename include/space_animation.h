@@ -2,10 +2,13 @@
 #include <Arduino.h>
 #include <FastLED.h>
 #include <vector>
+#include "topology.h"
 
 // Forward declarations
-extern CRGB leds[];
-extern void set_led(uint8_t x, uint8_t y, CRGB color);
+extern CRGB* leds;
+extern void set_led(int16_t x, int16_t y, CRGB color);
+extern void show_frame();
+extern void clear_frame();
 
 // Space object types
 struct Star {
@@ -50,6 +53,7 @@ public:
   
   // Main update and render
   void update();
+  void advance(); // One simulation step, without update()'s frame rate limit
   void render();
   void reset();
   
@@ -59,6 +63,10 @@ public:
   void setPlanetCount(int count) { maxPlanets = count; }
   void setSpaceshipCount(int count) { maxSpaceships = count; }
   
+  // Level of detail under load: the share of stars simulated and drawn, and
+  // whether the nebula is drawn. Stars left out keep their state.
+  void setDetail(int starPercent, bool nebula);
+  
   void setParallaxSpeed(float speed) { parallaxSpeed = speed; }
   void setStarSpeedRange(float min, float max) { starSpeedMin = min; starSpeedMax = max; }
   
@@ -79,6 +87,8 @@ private:
   int maxComets;
   int maxPlanets;
   int maxSpaceships;
+  int activeStars;      // Level of detail, see setDetail()
+  bool nebulaEnabled;
   
   float parallaxSpeed;
   float starSpeedMin, starSpeedMax;
@@ -94,9 +104,9 @@ private:
   uint8_t nebularPhase;
   unsigned long nebulaTimer;
   
-  // Display dimensions
-  static const int DISPLAY_WIDTH = 160; // 32 chars * 5 pixels
-  static const int DISPLAY_HEIGHT = 7;
+  // Display dimensions, from the topology
+  static int displayWidth() { return g_topology.getWidth(); }
+  static int displayHeight() { return g_topology.getHeight(); }
   
   // Object management
   void initializeStars();
@@ -116,6 +126,7 @@ private:
   void renderPlanets();
   void renderSpaceships();
   void renderNebula();
+  static void renderNebulaSegment(void* context, int xBegin, int xEnd);
   
   // Utility functions
   CRGB getStarColor(uint8_t brightness);
@@ -0,0 +1,214 @@
+#pragma once
+#include <Arduino.h>
+
+// Portable execution contexts: FreeRTOS tasks on the ESP32, threads elsewhere.
+//
+// A Task repeatedly calls its step function. Steps may block on a BoundedQueue;
+// the part of a step that does real work is bracketed with beginWork()/endWork()
+// so the per-task timing in the performance report excludes time spent waiting.
+
+#if defined(ESP32)
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/task.h>
+  #include <freertos/queue.h>
+#else
+  #include <mutex>
+  #include <condition_variable>
+  #include <thread>
+  #include <chrono>
+#endif
+
+// Task layer configuration constants
+#define ENABLE_TASK_LAYER true           // Split render, LED output and I/O into separate tasks
+#define TASK_DEFAULT_STACK_SIZE 4096
+#define RENDER_TASK_PRIORITY 2
+#define OUTPUT_TASK_PRIORITY 3           // Output runs ahead of render so frames never pile up
+#define IO_TASK_PRIORITY 1
+#define RENDER_TASK_CORE 1
+#define OUTPUT_TASK_CORE 0
+#define IO_TASK_CORE 0
+#define IO_TASK_INTERVAL 10              // milliseconds between button samples
+
+#define TASK_WAIT_FOREVER ULONG_MAX
+#define TASK_ANY_CORE -1
+
+// Cumulative timing for one task. Counters only grow so that a reporter in
+// another context can compute deltas without writing to them.
+struct TaskStats {
+  const char* name = "";
+  unsigned long busyMicros = 0;
+  unsigned long iterations = 0;
+  unsigned long maxIterationMicros = 0; // Reset by the reporter each window
+};
+
+// Fixed-capacity queue connecting two tasks. Items are copied, so T must be
+// trivially copyable. A full queue counts the rejected item as dropped.
+template <typename T, size_t N>
+class BoundedQueue {
+public:
+  BoundedQueue();
+  ~BoundedQueue();
+
+  bool push(const T& item, unsigned long timeoutMs = 0);
+  bool pop(T& item, unsigned long timeoutMs = 0);
+  size_t size();
+  unsigned long getDropped() const { return dropped; }
+
+private:
+#if defined(ESP32)
+  QueueHandle_t handle;
+#else
+  std::mutex mutex;
+  std::condition_variable notEmpty;
+  std::condition_variable notFull;
+  T items[N];
+  size_t head;
+  size_t count;
+#endif
+  unsigned long dropped;
+};
+
+// Guards a few lines shared by tasks that may run on different cores: a
+// FreeRTOS spinlock on the ESP32, a mutex elsewhere. Hold it only briefly -
+// on the ESP32 it masks interrupts on the holding core.
+class SpinLock {
+public:
+  SpinLock();
+  void lock();
+  void unlock();
+
+private:
+#if defined(ESP32)
+  portMUX_TYPE mux;
+#else
+  std::mutex mutex;
+#endif
+};
+
+class Task {
+public:
+  typedef void (*Step)(Task& task);
+
+  Task(const char* name, Step step, void* arg = nullptr);
+
+  bool start(uint32_t stackSize = TASK_DEFAULT_STACK_SIZE, int priority = 1, int core = TASK_ANY_CORE);
+
+  void* getArg() const { return arg; }
+  TaskStats& getStats() { return stats; }
+
+  // Bracket the work done in one step
+  void beginWork() { workStart = micros(); }
+  void endWork();
+
+  static void sleep(unsigned long ms);
+
+  // Name of the task the caller runs on; the same pointer on every call
+  static const char* currentName();
+
+private:
+  Step step;
+  void* arg;
+  TaskStats stats;
+  unsigned long workStart;
+
+  static void entry(void* self);
+};
+
+//=============================================================================
+// SpinLock Implementation
+//=============================================================================
+
+#if defined(ESP32)
+inline SpinLock::SpinLock() { portMUX_INITIALIZE(&mux); }
+inline void SpinLock::lock() { portENTER_CRITICAL(&mux); }
+inline void SpinLock::unlock() { portEXIT_CRITICAL(&mux); }
+#else
+inline SpinLock::SpinLock() {}
+inline void SpinLock::lock() { mutex.lock(); }
+inline void SpinLock::unlock() { mutex.unlock(); }
+#endif
+
+//=============================================================================
+// BoundedQueue Implementation
+//=============================================================================
+
+#if defined(ESP32)
+
+template <typename T, size_t N>
+BoundedQueue<T, N>::BoundedQueue() : dropped(0) {
+  handle = xQueueCreate(N, sizeof(T));
+}
+
+template <typename T, size_t N>
+BoundedQueue<T, N>::~BoundedQueue() {
+  vQueueDelete(handle);
+}
+
+template <typename T, size_t N>
+bool BoundedQueue<T, N>::push(const T& item, unsigned long timeoutMs) {
+  TickType_t ticks = timeoutMs == TASK_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+  if (xQueueSend(handle, &item, ticks) == pdTRUE) return true;
+  dropped++;
+  return false;
+}
+
+template <typename T, size_t N>
+bool BoundedQueue<T, N>::pop(T& item, unsigned long timeoutMs) {
+  TickType_t ticks = timeoutMs == TASK_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+  return xQueueReceive(handle, &item, ticks) == pdTRUE;
+}
+
+template <typename T, size_t N>
+size_t BoundedQueue<T, N>::size() {
+  return uxQueueMessagesWaiting(handle);
+}
+
+#else
+
+template <typename T, size_t N>
+BoundedQueue<T, N>::BoundedQueue() : head(0), count(0), dropped(0) {
+}
+
+template <typename T, size_t N>
+BoundedQueue<T, N>::~BoundedQueue() {
+}
+
+template <typename T, size_t N>
+bool BoundedQueue<T, N>::push(const T& item, unsigned long timeoutMs) {
+  std::unique_lock<std::mutex> lock(mutex);
+  auto hasRoom = [this] { return count < N; };
+  if (timeoutMs == TASK_WAIT_FOREVER) {
+    notFull.wait(lock, hasRoom);
+  } else if (!notFull.wait_for(lock, std::chrono::milliseconds(timeoutMs), hasRoom)) {
+    dropped++;
+    return false;
+  }
+  items[(head + count) % N] = item;
+  count++;
+  notEmpty.notify_one();
+  return true;
+}
+
+template <typename T, size_t N>
+bool BoundedQueue<T, N>::pop(T& item, unsigned long timeoutMs) {
+  std::unique_lock<std::mutex> lock(mutex);
+  auto hasItem = [this] { return count > 0; };
+  if (timeoutMs == TASK_WAIT_FOREVER) {
+    notEmpty.wait(lock, hasItem);
+  } else if (!notEmpty.wait_for(lock, std::chrono::milliseconds(timeoutMs), hasItem)) {
+    return false;
+  }
+  item = items[head];
+  head = (head + 1) % N;
+  count--;
+  notFull.notify_one();
+  return true;
+}
+
+template <typename T, size_t N>
+size_t BoundedQueue<T, N>::size() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return count;
+}
+
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Binary performance telemetry. Each report window becomes one record of
+// integer fields, with no float formatting on the device. Text logs may share
+// the serial port; tools/decode_telemetry.py prints the text and decodes the
+// records.
+//
+// Record:  'R' 'T' | version | sequence (u16) | payload length (u16) | sections | xor checksum
+// Section: type (u8) | length (u16) | payload
+//
+// All integers are little-endian. The checksum is the xor of every byte
+// before it. Decoders skip section types they do not know, so a section or a
+// trailing field can be added without bumping the version. Changing an
+// existing field's meaning requires a new version.
+
+#define TELEMETRY_MAGIC_0 'R'
+#define TELEMETRY_MAGIC_1 'T'
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_HEADER_SIZE 7
+#define TELEMETRY_SECTION_HEADER_SIZE 3
+#define TELEMETRY_MAX_NAME_LENGTH 32
+#define TELEMETRY_MAX_RECORD_SIZE 3584     // Worst case: every histogram bucket, timer and site slot in use
+
+// Section types
+#define TELEMETRY_SECTION_COUNTERS 1   // u32 interval ms, frames, visual updates, characters,
+                                       // idle us, frames over budget, min frame us, max frame us
+#define TELEMETRY_SECTION_HISTOGRAM 2  // u8 id, u8 linear buckets, u8 sub-bucket bits, u32 max us,
+                                       // then (u8 bucket, u16 count) for every non-empty bucket
+#define TELEMETRY_SECTION_TIMER 3      // u8 name length, name, u32 total us, u32 calls, u32 max us
+#define TELEMETRY_SECTION_TASK 4       // u8 name length, name, u32 busy us, u32 steps, u32 max step us
+#define TELEMETRY_SECTION_HEAP 5       // u32 allocations, bytes, frees, allocating frames, free heap, largest block
+#define TELEMETRY_SECTION_ALLOCATION_SITE 6 // u8 name length, "mode/transition", u32 frames, allocations, bytes
+#define TELEMETRY_SECTION_QUALITY 7    // u8 level, u8 lowest level, u32 level changes
+
+// Histogram ids
+#define TELEMETRY_HISTOGRAM_FRAME 0
+#define TELEMETRY_HISTOGRAM_RENDER 1
+#define TELEMETRY_HISTOGRAM_SHOW 2
+
+struct PerformanceSnapshot;
+struct LatencyHistogram;
+
+class TelemetryEncoder {
+public:
+  TelemetryEncoder();
+
+  // Encode one report window; returns the record length, or 0 if it does not fit
+  size_t encode(const PerformanceSnapshot& snapshot, uint8_t* out, size_t capacity);
+
+private:
+  uint16_t sequence;
+
+  size_t beginSection(uint8_t type, uint8_t* out, size_t pos, size_t capacity, size_t length);
+  size_t writeHistogram(uint8_t id, const LatencyHistogram& histogram, uint8_t* out, size_t pos, size_t capacity);
+  size_t writeNamed(uint8_t type, const char* name, uint32_t a, uint32_t b, uint32_t c, uint8_t* out, size_t pos, size_t capacity);
+};
+
+// Telemetry configuration constants
+#define ENABLE_BINARY_TELEMETRY true   // false restores the text performance report
@@ -0,0 +1,102 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+// Physical block: 5x7 LEDs wired row by row, 5 LEDs to a row
+#define BLOCK_WIDTH 5
+#define BLOCK_HEIGHT 7
+#define BLOCK_LEDS (BLOCK_WIDTH * BLOCK_HEIGHT)
+
+// Topology configuration constants
+#define TOPOLOGY_DEFAULT "32x1"            // Used when nothing is stored
+#define TOPOLOGY_COMMAND 'L'               // Serial: L<description><newline> stores a topology for the next boot
+#define TOPOLOGY_DESCRIPTION_LENGTH 96     // Longest stored description, including the terminator
+#define TOPOLOGY_MAX_LEDS 17920            // 512 blocks; two frame buffers and the map take 8 bytes per LED (140 KB)
+#define TOPOLOGY_MAX_WIDTH 2560            // 512 blocks across; set_led() takes 16-bit coordinates
+#define TOPOLOGY_MAX_HEIGHT 2560
+#define TOPOLOGY_MAX_OUTPUTS 8             // Data outputs; FastLED drives up to 8 in parallel on the ESP32's RMT
+
+// Data pins of the outputs, in chain order: output 0 drives the first share of the chain
+#define LED_OUTPUT_PIN_0 5
+#define LED_OUTPUT_PIN_1 18
+#define LED_OUTPUT_PIN_2 19
+#define LED_OUTPUT_PIN_3 21
+#define LED_OUTPUT_PIN_4 22
+#define LED_OUTPUT_PIN_5 23
+#define LED_OUTPUT_PIN_6 25
+#define LED_OUTPUT_PIN_7 26
+
+// How a block is mounted, seen from the front
+enum class BlockOrientation : uint8_t {
+  NORMAL = 0,       // First LED top left, rows left to right
+  ROTATED_180 = 1,  // Upside down: first LED bottom right
+  MIRRORED = 2,     // Rows right to left
+  FLIPPED = 3       // First row at the bottom
+};
+
+// Layout of the sign: rows of blocks, chained row after row. The description
+// is "<blocks per row>x<rows>", optionally followed by 's' when every other
+// row is chained right to left (serpentine), and ':' with one orientation
+// letter per block in chain order - N normal, R rotated 180, M mirrored,
+// F flipped - where the last letter carries on to the remaining blocks -
+// and '/' with the number of data outputs the chain is split across:
+//
+//   32x1           one row of 32 blocks, the original sign
+//   16x2s:N        two rows of 16, the second chained back right to left
+//   16x2:NR        second and later blocks upside down
+//   64x1/4         four outputs of 16 blocks, on LED_OUTPUT_PIN_0 to _3
+//
+// The topology is loaded once at boot, which builds the map from display
+// pixels to chain positions; the frame buffers are sized from it. Text is
+// laid out in the top row of blocks; pixel modes use the whole sign.
+//
+// Outputs split the chain into consecutive shares of whole blocks, the first
+// outputs taking the shorter ones. The frame buffer stays in chain order and
+// each output sends its own slice of it, so the map is the same however the
+// chain is split.
+class Topology {
+public:
+  Topology();
+
+  // Parses a description; on error returns false and leaves the topology as it was
+  bool load(const char* description);
+
+  // The stored description, or TOPOLOGY_DEFAULT if none is stored or it does not parse
+  void loadAtBoot();
+
+  // Checks a description and stores it for the next boot
+  static bool save(const char* description);
+
+  const char* getDescription() const { return description; }
+  int getWidth() const { return width; }              // Pixels
+  int getHeight() const { return height; }
+  int getColumns() const { return blocksPerRow; }     // Character cells across
+  int getBlockRows() const { return blockRows; }
+  int getBlockCount() const { return blocksPerRow * blockRows; }
+  int getLedCount() const { return getBlockCount() * BLOCK_LEDS; }
+
+  int getOutputCount() const { return outputs; }
+  // First chain position and length of one output's slice of the frame buffer
+  int getOutputStart(int output) const { return outputStart(getBlockCount(), outputs, output); }
+  int getOutputLength(int output) const { return getOutputStart(output + 1) - getOutputStart(output); }
+
+  // Where output starts when blocks are split across outputs; output == outputs gives the end
+  static int outputStart(int blocks, int outputs, int output) { return blocks * output / outputs * BLOCK_LEDS; }
+
+  // Chain position of a display pixel; callers check the bounds
+  int index(int x, int y) const { return map[y * width + x]; }
+  // Chain positions of one display row, indexed by x
+  const uint16_t* mapRow(int y) const { return &map[y * width]; }
+
+private:
+  char description[TOPOLOGY_DESCRIPTION_LENGTH];
+  int blocksPerRow;
+  int blockRows;
+  int width;
+  int height;
+  int outputs;
+  std::vector<uint16_t> map;
+};
+
+// Defined in main.cpp ahead of the objects that size themselves from it
+extern Topology g_topology;
@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Fixed-size ring of timed spans recorded at the existing timer points. Unlike
+// the accumulated totals in PerformanceMetrics it keeps when each span ran and
+// on which task, so blocking work can be lined up against FastLED.show().
+// The buffer is written out in Chrome trace-event JSON (chrome://tracing,
+// Perfetto): over serial on the device, or to a file in a host build.
+
+// Tracing configuration constants
+#define ENABLE_TRACING false
+#define TRACE_BUFFER_EVENTS 8192     // ~1 minute of text frames at 30 FPS (96KB on the ESP32)
+#define TRACE_MIN_SPAN_MICROS 50     // Shorter spans (per-character writes) would flood the ring
+#define TRACE_MAX_TRACKS 8
+#define TRACE_DUMP_COMMAND 'T'       // Serial command that writes the buffer out
+
+struct TraceEvent {
+  uint32_t start;       // micros()
+  uint32_t duration;    // microseconds
+  const char* name;     // Must outlive the buffer - timer names are literals
+  uint8_t track;        // Index into the track (task) table
+};
+
+class TraceBuffer {
+public:
+  TraceBuffer(size_t capacity);
+  ~TraceBuffer();
+
+  // Safe to call from any task; the oldest span is overwritten when full
+  void record(const char* name, unsigned long start, unsigned long end);
+
+  void setRecording(bool on) { recording = on; }
+  bool isRecording() const { return recording; }
+  size_t size() const;
+  unsigned long getOverwritten() const;
+  void clear();
+
+  // Recording pauses while the buffer is written out and resumes afterwards
+  void dumpToSerial();
+#if !defined(ESP32)
+  bool dumpToFile(const char* path);
+#endif
+
+private:
+  TraceEvent* events;
+  size_t capacity;
+  std::atomic<uint32_t> next;
+  volatile bool recording;
+
+  std::atomic<const char*> tracks[TRACE_MAX_TRACKS];
+
+  typedef void (*LineWriter)(const char* line, void* context);
+
+  uint8_t trackForCurrentTask();
+  void writeJson(LineWriter write, void* context);
+  size_t oldestIndex() const;
+  int formatEvent(char* out, size_t length, const TraceEvent& event, uint32_t origin) const;
+  int formatTrackName(char* out, size_t length, int track) const;
+};
+
+extern TraceBuffer* g_traceBuffer;
@@ -3,11 +3,16 @@
 #include <FastLED.h>
 #include <vector>
 #include "content_manager.h"
+#include "shared_clock.h"
 
 // Forward declarations
-extern CRGB leds[];
-extern void set_led(uint8_t x, uint8_t y, CRGB color);
-extern void write_character(uint8_t character, uint8_t pos, CRGB color, int offset);
+extern CRGB* leds;
+extern void set_led(int16_t x, int16_t y, CRGB color);
+extern void write_character(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset);
+extern void write_character_rows(const Font& font, uint8_t character, uint16_t pos, int y, CRGB color);
+extern int draw_glyph(const Font& font, uint8_t character, int x, int y, CRGB color);
+extern void show_frame();
+extern void clear_frame();
 
 // Transition effect types
 enum class TransitionType {
@@ -18,6 +23,7 @@ enum class TransitionType {
   FADE_IN_OUT = 4,
   RAINBOW_CYCLE = 5
 };
+#define NUM_TRANSITION_TYPES 6
 
 // Base class for all transition effects
 class TransitionEffect {
@@ -29,6 +35,13 @@ public:
   virtual bool update(ContentManager& content) = 0; // Returns true if content advanced
   virtual TransitionType getType() const = 0;
   
+  // millis() deadline of the next visible change; the frame loop sleeps until then
+  virtual unsigned long getNextUpdateTime(const ContentManager& content) const { return millis(); }
+  
+  // Draw and show one frame of the effect at an arbitrary step, ignoring its
+  // timing and leaving its state alone; the kernel benchmarks time this
+  virtual void renderStep(ContentManager& content, int step) = 0;
+  
   void setSmoothTransitions(bool smooth) { smoothTransitions = smooth; }
   bool getSmoothTransitions() const { return smoothTransitions; }
   
@@ -36,22 +49,50 @@ protected:
   bool smoothTransitions;
 };
 
-// Smooth scroll transition (6-step character transitions)  
+// Smooth scroll transition - one column per step; fixed-width text takes
+// SMOOTH_SCROLL_STEPS steps per character, proportional text its advance
 class SmoothScrollTransition : public TransitionEffect {
 public:
   SmoothScrollTransition();
   void reset() override;
   bool update(ContentManager& content) override;
   TransitionType getType() const override { return TransitionType::SMOOTH_SCROLL; }
+  unsigned long getNextUpdateTime(const ContentManager& content) const override;
+  void renderStep(ContentManager& content, int step) override;
+  
+  // Synchronized scrolling: scroll position becomes a function of shared time,
+  // and this controller shows the virtual display starting at columnOffset.
+  // Text is laid out as a standalone sign lays it out (PROPORTIONAL_TEXT).
+  // Until the clock has synced, the scroll runs on local time as without one.
+  void setSharedClock(SharedClock* clock, int columnOffset);
+  
+  // Fewest sub-steps between frames. The scroll position follows elapsed
+  // time, so under load it keeps its speed in fewer, coarser frames.
+  void setStepStride(int stride) { stepStride = stride > 0 ? stride : 1; }
+  
+  // One frame of the matrix effect between paragraphs into leds[], split into
+  // segments on wide displays; the same step and seed give the same frame
+  static void drawNewlineFrame(int step, uint32_t seed);
   
 private:
   int scrollPosition;
   bool startPause;
   unsigned long lastUpdateTime;
+  unsigned long lastStepTime;  // Last smooth sub-step
   
-  void renderScrollMessage(ContentManager& content, int position, bool scroll, int smoothSteps);
+  // Non-blocking animation state: one sub-step or matrix frame per update
+  int smoothStep;
+  int newlineStep;
+  int stepStride;
+  
+  SharedClock* sharedClock;
+  int columnOffset;
+  uint64_t lastSyncedColumn;
+  
+  void renderScrollMessage(ContentManager& content, int position, int step);
+  bool renderSynchronized(ContentManager& content);
   void showStartPauseEffect();
-  void showNewlineTransition();
+  void showNewlineStep(int step);
 };
 
 // Character scroll transition (fast 1-step transitions)
@@ -61,13 +102,20 @@ public:
   void reset() override;
   bool update(ContentManager& content) override;
   TransitionType getType() const override { return TransitionType::CHARACTER_SCROLL; }
+  unsigned long getNextUpdateTime(const ContentManager& content) const override;
+  void renderStep(ContentManager& content, int step) override;
   
 private:
   int scrollPosition;
   bool startPause;
   unsigned long lastCharacterTime;
   
+  // What is on the display, so unchanged frames are not rendered again
+  int renderedPosition;
+  unsigned long renderedEpoch;
+  
   void renderScrollMessage(ContentManager& content, int position);
+  void showScrollPosition(ContentManager& content);
   void showStartPauseEffect();
 };
 
@@ -78,13 +126,25 @@ public:
   void reset() override;
   bool update(ContentManager& content) override;
   TransitionType getType() const override { return TransitionType::LINE_SLIDE; }
+  unsigned long getNextUpdateTime(const ContentManager& content) const override;
+  void renderStep(ContentManager& content, int step) override;
   
 private:
   int currentLineIndex;
   unsigned long lastLineTime;
   String previousLine;
   
-  void displayLineSlide(const String& prevLine, const String& newLine, ContentManager& content);
+  // Held line state - the line is drawn once and redrawn only when colors change
+  int heldLineIndex;    // -2 when nothing is held yet, -1 for the blank first hold
+  unsigned long heldEpoch;
+  unsigned long holdUntil;
+  
+  // Non-blocking slide state
+  int slideStep;        // -1 when no slide is running
+  unsigned long lastSlideTime;
+  String slideLine;
+  
+  void displaySlideStep(const String& prevLine, const String& newLine, int step, ContentManager& content);
   void maintainCurrentLine(const String& line, ContentManager& content);
 };
 
@@ -95,6 +155,8 @@ public:
   void reset() override;
   bool update(ContentManager& content) override;
   TransitionType getType() const override { return TransitionType::CURSOR_WIPE; }
+  unsigned long getNextUpdateTime(const ContentManager& content) const override;
+  void renderStep(ContentManager& content, int step) override;
   
 private:
   int currentLineIndex;
@@ -108,7 +170,6 @@ private:
   unsigned long lastStateTime = 0;
   String currentWipeLine = "";
   
-  void displayLineCursorWipe(const String& line, ContentManager& content);
   void maintainCurrentLine(const String& line, ContentManager& content);
   void displayWipeStep(const String& line, int step, ContentManager& content);
   void displayFlashStep(const String& line, bool showCursor, ContentManager& content);
@@ -119,9 +180,16 @@ class TransitionFactory {
 public:
   static TransitionEffect* createTransition(TransitionType type, bool smoothTransitions = true);
   static const char* getTransitionName(TransitionType type);
-  static int getTransitionCount() { return 6; } // Update as we add more transitions
+  static int getTransitionCount() { return NUM_TRANSITION_TYPES; } // Update as we add more transitions
+  static int getImplementedCount() { return 4; } // Transitions that can be cycled through
 };
 
 // Configuration constants
 #define LINE_TRANSITION_SMOOTH true
-#define NUM_LEDS (5*7*NUM_CHARS) 
\ No newline at end of file
+#define SMOOTH_SCROLL_STEPS 6         // Sub-steps per character in smooth scroll
+#define SMOOTH_SCROLL_INTERVAL ((unsigned long)(1000 / (CPS_TARGET * SMOOTH_SCROLL_STEPS))) // Shortest milliseconds between sub-steps
+#define NEWLINE_TRANSITION_STEPS 30   // Frames in the matrix effect between paragraphs
+#define NEWLINE_TRANSITION_INTERVAL 20 // milliseconds between matrix frames
+#define LINE_SLIDE_INTERVAL 40        // milliseconds between line slide steps
+#define SYNC_SCROLL_CHAR_PITCH 6      // Columns per fixed-width character; also sets the synchronized pixel rate
+#define SYNC_SCROLL_STORY_GAP 32      // Blank characters between stories in synchronized mode
@@ -0,0 +1,22 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include "diagnostic_hooks.h"
+
+// Simulated time for deterministic runs. In diagnostic builds every millis()
+// and micros() call in the firmware is routed here by the linker (see
+// diagnostic_hooks.h), so nothing needs to be passed a clock. While the virtual clock runs, all
+// callers see simulated time, which only moves when advance() is called; the
+// rest of the time the hardware clock is passed through.
+//
+// Only the context that started the clock may advance it.
+class VirtualClock {
+public:
+  static void start(uint64_t startMicros);
+  static void advance(unsigned long micros);
+  static void stop();
+  static bool running();
+
+  // False in production builds, where the clock hooks are not linked in
+  static bool available() { return DIAGNOSTIC_HOOKS; }
+};
@@ -0,0 +1,150 @@
+#include "allocation_tracker.h"
+#include "task_runner.h"
+#include <atomic>
+#include <stdlib.h>
+#if defined(ESP32)
+  #include <esp_heap_caps.h>
+#endif
+
+// Zero-initialized before any constructor can allocate
+static std::atomic<uint32_t> totalAllocations;
+static std::atomic<uint32_t> totalBytes;
+static std::atomic<uint32_t> totalFrees;
+static std::atomic<const char*> watchedTask;
+
+// Written only by the watched task
+static volatile unsigned long watchedAllocations = 0;
+static volatile unsigned long watchedBytes = 0;
+
+void AllocationTracker::watchCurrentTask() {
+  watchedTask = Task::currentName();
+}
+
+AllocationCount AllocationTracker::watched() {
+  AllocationCount count;
+  count.allocations = watchedAllocations;
+  count.bytes = watchedBytes;
+  return count;
+}
+
+AllocationCount AllocationTracker::watchedSince(const AllocationCount& start) {
+  AllocationCount count = watched();
+  count.allocations -= start.allocations;
+  count.bytes -= start.bytes;
+  return count;
+}
+
+AllocationCount AllocationTracker::total() {
+  AllocationCount count;
+  count.allocations = totalAllocations.load();
+  count.bytes = totalBytes.load();
+  return count;
+}
+
+unsigned long AllocationTracker::frees() {
+  return totalFrees.load();
+}
+
+unsigned long AllocationTracker::freeHeap() {
+#if defined(ESP32)
+  return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+#else
+  return 0;
+#endif
+}
+
+unsigned long AllocationTracker::minimumFreeHeap() {
+#if defined(ESP32)
+  return heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+#else
+  return 0;
+#endif
+}
+
+unsigned long AllocationTracker::largestFreeBlock() {
+#if defined(ESP32)
+  return heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+#else
+  return 0;
+#endif
+}
+
+void AllocationTracker::onAllocate(size_t bytes) {
+  if (!ENABLE_ALLOCATION_TRACKING) return;
+  totalAllocations.fetch_add(1);
+  totalBytes.fetch_add(bytes);
+
+  // No task name is asked for until something is watched - static
+  // constructors allocate before the scheduler has a current task
+  const char* watching = watchedTask.load();
+  if (watching && Task::currentName() == watching) {
+    watchedAllocations = watchedAllocations + 1;
+    watchedBytes = watchedBytes + bytes;
+  }
+}
+
+void AllocationTracker::onFree() {
+  if (ENABLE_ALLOCATION_TRACKING) totalFrees.fetch_add(1);
+}
+
+//=============================================================================
+// Allocator Hooks
+//=============================================================================
+
+// The wrappers must exist whenever the --wrap flags are set, so only the
+// counting above is switched off by ENABLE_ALLOCATION_TRACKING
+#if DIAGNOSTIC_HOOKS
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(size_t size) {
+  void* ptr = __real_malloc(size);
+  if (ptr) AllocationTracker::onAllocate(size);
+  return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  void* ptr = __real_calloc(count, size);
+  if (ptr) AllocationTracker::onAllocate(count * size);
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  // Counted as a fresh allocation plus a free - growing a String is the churn we are after
+  void* moved = __real_realloc(ptr, size);
+  if (moved && size > 0) AllocationTracker::onAllocate(size);
+  if (ptr && (moved || size == 0)) AllocationTracker::onFree();
+  return moved;
+}
+
+void __wrap_free(void* ptr) {
+  if (ptr) AllocationTracker::onFree();
+  __real_free(ptr);
+}
+}
+
+#if !defined(ESP32)
+// libstdc++ is a shared library on the host, so its operator new never reaches
+// the wrapped malloc; route new and delete through it here instead
+void* operator new(size_t size) {
+  void* ptr = malloc(size);
+  if (!ptr) abort();
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
+#endif
+#endif
@@ -1,38 +1,53 @@
 #include "content_manager.h"
 #include <FastLED.h>
+#include "log_buffer.h"
 
 ContentManager::ContentManager() 
-  : currentStoryIndex(0), linesNeedRefresh(true), currentColorMode(ColorMode::WORD_BASED) {
+  : currentStoryIndex(0), currentColorMode(ColorMode::WORD_BASED) {
 }
 
-void ContentManager::addStory(const String& story) {
+void ContentManager::addStory(const String& story, FontId font) {
   stories.push_back(story);
-  linesNeedRefresh = true;
+  storyLines.push_back(extractLines(story, getFont(font)));
+  storyFonts.push_back(font);
+}
+
+void ContentManager::setStoryFont(int index, FontId font) {
+  if (index >= 0 && index < stories.size()) {
+    storyFonts[index] = font;
+    storyLines[index] = extractLines(stories[index], getFont(font)); // Proportional wrap depends on the font
+  }
+}
+
+const Font& ContentManager::getCurrentFont() const {
+  if (currentStoryIndex >= 0 && currentStoryIndex < stories.size()) {
+    return getFont(storyFonts[currentStoryIndex]);
+  }
+  return getFont(DEFAULT_FONT);
 }
 
 void ContentManager::selectRandomStory() {
   if (!stories.empty()) {
     currentStoryIndex = random(stories.size());
-    linesNeedRefresh = true;
   }
 }
 
 void ContentManager::selectStory(int index) {
   if (index >= 0 && index < stories.size()) {
     currentStoryIndex = index;
-    linesNeedRefresh = true;
   }
 }
 
-String ContentManager::getCurrentStory() const {
+const String& ContentManager::getCurrentStory() const {
+  static const String noStory;
   if (currentStoryIndex >= 0 && currentStoryIndex < stories.size()) {
     return stories[currentStoryIndex];
   }
-  return "";
+  return noStory;
 }
 
 char ContentManager::getCharacterAt(int position) const {
-  String story = getCurrentStory();
+  const String& story = getCurrentStory();
   if (position >= 0 && position < story.length()) {
     return story.c_str()[position];
   }
@@ -40,15 +55,27 @@ char ContentManager::getCharacterAt(int position) const {
 }
 
 bool ContentManager::isAtStoryEnd(int position) const {
-  String story = getCurrentStory();
-  return position >= story.length();
+  return position >= getCurrentStory().length();
 }
 
 int ContentManager::getStoryLength() const {
   return getCurrentStory().length();
 }
 
-std::vector<String> ContentManager::extractLines(const String& story) const {
+int ContentManager::charsThatFit(const String& line, const Font& font) const {
+  int columns = g_topology.getColumns();
+  if (!PROPORTIONAL_TEXT) return (int)line.length() < columns ? line.length() : columns;
+  int x = 0;
+  int count = 0;
+  while (count < line.length()) {
+    x += font.advance(line.c_str()[count], FONT_GLYPH_GAP);
+    if (x - FONT_GLYPH_GAP > g_topology.getWidth()) break; // The last gap may fall off the edge
+    count++;
+  }
+  return count > 0 ? count : 1;
+}
+
+std::vector<String> ContentManager::extractLines(const String& story, const Font& font) const {
   std::vector<String> lines;
   int start = 0;
   
@@ -61,37 +88,38 @@ std::vector<String> ContentManager::extractLines(const String& story) const {
     
     if (line.length() > 0) {
       // Handle lines that are too long with smart word wrapping
-      while (line.length() > NUM_CHARS) {
+      int fit;
+      while ((fit = charsThatFit(line, font)) < line.length()) {
         String currentLine;
         int lastSpace = -1;
         
         // Find the best break point (last space within display width)
-        for (int i = 0; i < NUM_CHARS && i < line.length(); i++) {
+        for (int i = 0; i < fit; i++) {
           if (line.c_str()[i] == ' ') {
             lastSpace = i;
           }
         }
         
-        if (lastSpace > 0 && lastSpace < NUM_CHARS) {
+        if (lastSpace > 0) {
           // Break at the last space within display width
           currentLine = line.substring(0, lastSpace);
-          // Pad with spaces to full width for clean display
-          while (currentLine.length() < NUM_CHARS) {
+          // Pad fixed-width lines with spaces to full width for clean display
+          while (!PROPORTIONAL_TEXT && currentLine.length() < g_topology.getColumns()) {
             currentLine += " ";
           }
           lines.push_back(currentLine);
           line = line.substring(lastSpace + 1); // Skip the space
         } else {
           // No good break point found, force break (rare case)
-          currentLine = line.substring(0, NUM_CHARS);
+          currentLine = line.substring(0, fit);
           lines.push_back(currentLine);
-          line = line.substring(NUM_CHARS);
+          line = line.substring(fit);
         }
       }
       
       if (line.length() > 0) {
-        // Pad short lines with spaces for consistent display
-        while (line.length() < NUM_CHARS) {
+        // Pad short fixed-width lines with spaces for consistent display
+        while (!PROPORTIONAL_TEXT && line.length() < g_topology.getColumns()) {
           line += " ";
         }
         lines.push_back(line);
@@ -104,16 +132,12 @@ std::vector<String> ContentManager::extractLines(const String& story) const {
   return lines;
 }
 
-std::vector<String> ContentManager::getCurrentLines() {
-  if (linesNeedRefresh) {
-    refreshCurrentLines();
+const std::vector<String>& ContentManager::getCurrentLines() const {
+  static const std::vector<String> noLines;
+  if (currentStoryIndex >= 0 && currentStoryIndex < storyLines.size()) {
+    return storyLines[currentStoryIndex];
   }
-  return currentLines;
-}
-
-void ContentManager::refreshCurrentLines() {
-  currentLines = extractLines(getCurrentStory());
-  linesNeedRefresh = false;
+  return noLines;
 }
 
 CRGB ContentManager::getWordColor(const String& text, int position) const {
@@ -131,16 +155,12 @@ CRGB ContentManager::getWordColor(const String& text, int position) const {
   return color;
 }
 
-void ContentManager::reset() {
-  linesNeedRefresh = true;
-}
-
 bool ContentManager::hasNewlineAt(int position) const {
   return getCharacterAt(position) == '\n';
 }
 
 int ContentManager::findNextPrintableChar(int startPos) const {
-  String story = getCurrentStory();
+  const String& story = getCurrentStory();
   bool printable = false;
   int pos = startPos;
   
@@ -173,7 +193,7 @@ String ContentManager::padToWidth(const String& line, int width) const {
 void ContentManager::randomizeColorMode() {
   int modeCount = 4; // Number of ColorMode enum values
   currentColorMode = static_cast<ColorMode>(random(modeCount));
-  Serial.printf("Color mode changed to: %s\n", getColorModeName());
+  g_logBuffer.log("Color mode changed to: %s\n", getColorModeName());
 }
 
 const char* ContentManager::getColorModeName() const {
@@ -186,6 +206,16 @@ const char* ContentManager::getColorModeName() const {
   }
 }
 
+unsigned long ContentManager::getColorEpoch() const {
+  // Offset by one so the second after boot or a millis() wraparound is not 0
+  return currentColorMode == ColorMode::SINGLE_COLOR ? millis() / 1000 + 1 : 0;
+}
+
+unsigned long ContentManager::getNextColorChange() const {
+  // Only Single Color changes here; an extra wake-up per second is harmless otherwise
+  return (millis() / 1000 + 1) * 1000;
+}
+
 CRGB ContentManager::getCharacterColor(const String& text, int position, int scrollPosition) const {
   switch (currentColorMode) {
     case ColorMode::WORD_BASED:
@@ -0,0 +1,125 @@
+#include "display_benchmark.h"
+#include "topology.h"
+#include "performance_monitor.h"
+#include "log_buffer.h"
+#include "output_timing.h"
+
+static const char* const PATTERN_NAMES[BENCHMARK_PATTERNS] = { "Blank", "Solid", "Text", "Noise" };
+
+// Chain lengths in whole character blocks: a quarter, half and all of the chain
+static const int CHAIN_QUARTERS[BENCHMARK_LENGTHS] = { 1, 2, 4 };
+
+static int chainLength(int length) {
+  int blocks = g_topology.getBlockCount() * CHAIN_QUARTERS[length] / 4;
+  return (blocks > 0 ? blocks : 1) * BLOCK_LEDS;
+}
+
+DisplayBenchmark::DisplayBenchmark()
+  : config(0), outputLength(g_topology.getLedCount()), frame(0), measureStart(0), showCountStart(0), showMicrosStart(0) {
+}
+
+void DisplayBenchmark::reset() {
+  config = 0;
+  frame = 0;
+  setOutputLength(g_topology.getLedCount());
+}
+
+void DisplayBenchmark::setOutputLength(int count) {
+  // Changing the length waits for the output to go idle, so only when it changes
+  if (count == outputLength) return;
+  set_output_length(count);
+  outputLength = count;
+}
+
+void DisplayBenchmark::update() {
+  if (frame == 0) {
+    beginConfig();
+  }
+
+  BenchmarkResult& result = results[config];
+  unsigned long renderStart = micros();
+  renderPattern(config % BENCHMARK_PATTERNS);
+  unsigned long renderEnd = micros();
+  force_next_frame(); // Repeated patterns are the point here; skipping them would time nothing
+  show_frame();
+
+  // Warm-up frames flush the previous configuration out of the output pipeline
+  frame++;
+  if (frame <= BENCHMARK_WARMUP_FRAMES) {
+    if (frame == BENCHMARK_WARMUP_FRAMES) {
+      measureStart = micros();
+      showCountStart = g_perfMonitor->getShowCount();
+      showMicrosStart = g_perfMonitor->getShowMicros();
+    }
+    return;
+  }
+  result.renderMicros += renderEnd - renderStart;
+  result.frames++;
+
+  if (result.frames >= BENCHMARK_FRAMES) {
+    endConfig();
+    frame = 0;
+    if (++config >= BENCHMARK_CONFIGS) {
+      logResults();
+      reset();
+    }
+  }
+}
+
+void DisplayBenchmark::beginConfig() {
+  BenchmarkResult& result = results[config];
+  result.pattern = PATTERN_NAMES[config % BENCHMARK_PATTERNS];
+  result.ledCount = chainLength(config / BENCHMARK_PATTERNS);
+  result.frames = 0;
+  result.elapsedMicros = 0;
+  result.renderMicros = 0;
+  result.shows = 0;
+  result.showMicros = 0;
+  setOutputLength(result.ledCount);
+}
+
+void DisplayBenchmark::endConfig() {
+  BenchmarkResult& result = results[config];
+  result.elapsedMicros = micros() - measureStart;
+  result.shows = g_perfMonitor->getShowCount() - showCountStart;
+  result.showMicros = g_perfMonitor->getShowMicros() - showMicrosStart;
+}
+
+void DisplayBenchmark::renderPattern(int pattern) {
+  switch (pattern) {
+    case 0: // Blank
+      clear_frame();
+      break;
+
+    case 1: // Solid - one color, changing every frame
+      fill_solid(leds, g_topology.getLedCount(), CHSV(frame * 4, 255, 180));
+      break;
+
+    case 2: // Text - every character position drawn through the glyph path
+      for (int pos = 0; pos < g_topology.getColumns(); pos++) {
+        write_character(getFont(DEFAULT_FONT), 'A' + (pos + frame) % 26, pos, CHSV(pos * 8, 255, 180), 0);
+      }
+      break;
+
+    case 3: // Noise - every pixel different, every frame
+      for (int i = 0; i < g_topology.getLedCount(); i++) {
+        leds[i] = CRGB(random8(), random8(), random8());
+      }
+      break;
+  }
+}
+
+void DisplayBenchmark::logResults() {
+  // Integer columns - log arguments cannot be floating point
+  g_logBuffer.log("=== THROUGHPUT BENCHMARK (%d frames per row) ===\n", BENCHMARK_FRAMES);
+  g_logBuffer.log("Pattern  LEDs  Render us  Show us Model us  FPS\n");
+  for (int i = 0; i < BENCHMARK_CONFIGS; i++) {
+    const BenchmarkResult& result = results[i];
+    unsigned long predicted = OutputTiming::showMicros(g_topology, result.ledCount);
+    unsigned long fps = result.elapsedMicros > 0 ? (result.frames * 1000000UL + result.elapsedMicros / 2) / result.elapsedMicros : 0;
+    g_logBuffer.log("%-7s %5d %10lu %8lu %8lu %4lu\n", result.pattern, result.ledCount,
+                    result.renderMicros / result.frames, result.shows > 0 ? result.showMicros / result.shows : 0UL,
+                    predicted, fps);
+  }
+  g_logBuffer.log("==============================================\n");
+}
@@ -0,0 +1,532 @@
+#include "display_controller.h"
+#include "performance_monitor.h"
+#include "shared_clock.h"
+#include "idle_sleep.h"
+#include "log_buffer.h"
+#include "led_art.h"
+#include "led_history.h"
+
+// External references from main.cpp
+extern CRGB* leds;
+extern PerformanceMonitor* g_perfMonitor;
+
+// Declared cadence and expected cost per mode, indexed by DisplayMode.
+// Costs start from the FastLED.show() time of the full chain and are refined
+// from measured frames at runtime.
+static const ModeSchedule DEFAULT_MODE_SCHEDULES[NUM_DISPLAY_MODES] = {
+  { 0,  36000 }, // TEXT_CONTENT - transitions pace themselves
+  { 16, 38000 }, // SPACE_ANIMATION - ~60 FPS cap
+  { 20, 35000 }, // COLOR_SHOW - one LED per frame while filling
+  { 0,  35000 }, // TEST_PATTERNS - pixel on/off timing is internal
+  { 0,  35000 }, // BENCHMARK - back to back, as fast as the output allows
+  { 0,  35000 }  // STREAM_RECEIVER - frames arrive at the host's rate
+};
+
+DisplayController::DisplayController()
+  : currentTransition(nullptr), quality(FRAME_BUDGET_MICROS), currentMode(DisplayMode::TEXT_CONTENT), currentTransitionType(TransitionType::SMOOTH_SCROLL),
+    smoothTransitions(LINE_TRANSITION_SMOOTH), lastTransitionChange(0),
+    transitionChangeInterval(AUTO_TRANSITION_CYCLE_INTERVAL), autoTransitionCycling(ENABLE_AUTO_TRANSITION_CYCLING),
+    lastModeFrame(0), deferredReports(0), inlineInput(true), inlineReporting(true), feedbackUntil(0), buttonPressTime(0), longPressActive(false),
+    colorPhase(COLOR_FILL), colorIndex(0), colorHue(0), colorPhaseTime(0),
+    testX(0), testY(0), testPixelOn(false), testStepTime(0) {
+  for (int i = 0; i < NUM_DISPLAY_MODES; i++) {
+    schedules[i] = DEFAULT_MODE_SCHEDULES[i];
+  }
+}
+
+DisplayController::~DisplayController() {
+}
+
+void DisplayController::initialize() {
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+
+  // Decoder writes streamed frames straight into the LED buffer
+  streamDecoder.reset(new FrameStreamDecoder(reinterpret_cast<uint8_t*>(leds), g_topology.getLedCount()));
+
+  // Initialize content manager with stories
+  contentManager.addStory(led_art_story);
+  contentManager.addStory(led_history_story);
+  contentManager.selectRandomStory();
+
+  // Initialize first transition and randomize color mode
+  contentManager.randomizeColorMode();
+  createTransition(TransitionType::SMOOTH_SCROLL);
+  lastTransitionChange = millis();
+
+  if (FRAME_STREAM_RECEIVER_AT_BOOT) {
+    setDisplayMode(DisplayMode::STREAM_RECEIVER);
+  }
+}
+
+//=============================================================================
+// Frame Loop
+//=============================================================================
+
+bool DisplayController::update() {
+  TIME_SCOPE(frame);
+  unsigned long frameStart = micros();
+  bool modeRan = false;
+
+  // Input is polled every frame regardless of what the mode costs
+  if (inlineInput) {
+    handleInput(sampleButton());
+  }
+
+  // Keep the shared time base fresh before anything renders from it
+  if (g_sharedClock) {
+    g_sharedClock->update();
+  }
+
+  unsigned long now = millis();
+  if (feedbackUntil != 0) {
+    // Hold the button feedback flash, then hand the display back to the mode
+    if ((int32_t)(now - feedbackUntil) >= 0) {
+      feedbackUntil = 0;
+      clear_frame();
+      FastLED.setBrightness(MAX_BRIGHTNESS);
+    }
+  } else if (isModeDue(now)) {
+    // Background work goes first only if it fits alongside the mode's expected cost
+    runBackgroundWork(frameStart, true);
+    runModeFrame();
+    lastModeFrame = now;
+    modeRan = true;
+  }
+
+  runBackgroundWork(frameStart, false);
+
+  // Performance tracking
+  g_perfMonitor->recordFrameTime((uint32_t)(micros() - frameStart));
+  g_perfMonitor->incrementFrame();
+  return modeRan;
+}
+
+bool DisplayController::isModeDue(unsigned long now) const {
+  unsigned long interval = getFrameInterval();
+  return interval == 0 || (uint32_t)(now - lastModeFrame) >= interval;
+}
+
+unsigned long DisplayController::getFrameInterval() const {
+  return schedules[static_cast<int>(currentMode)].frameInterval * quality.getSettings().intervalScale;
+}
+
+unsigned long DisplayController::getNextWakeTime() const {
+  unsigned long now = millis();
+
+  // Button feedback and a held button keep their own pace
+  if (feedbackUntil != 0) {
+    return feedbackUntil;
+  }
+  if (inlineInput && buttonPressTime != 0) {
+    return now + BUTTON_POLL_INTERVAL;
+  }
+
+  // When the active mode next changes what is on the display
+  unsigned long deadline = now;
+  switch (currentMode) {
+    case DisplayMode::TEXT_CONTENT:
+      if (currentTransition) deadline = currentTransition->getNextUpdateTime(contentManager);
+      break;
+    case DisplayMode::COLOR_SHOW:
+      if (colorPhase == COLOR_HOLD) deadline = colorPhaseTime + 1000;
+      else if (colorPhase == COLOR_FADE) deadline = colorPhaseTime + 50;
+      break;
+    case DisplayMode::TEST_PATTERNS:
+      deadline = testStepTime + (testPixelOn ? 30UL : 2UL);
+      break;
+    case DisplayMode::STREAM_RECEIVER:
+      if (Serial.available() == 0) deadline = now + STREAM_POLL_INTERVAL;
+      break;
+    default:
+      break;
+  }
+
+  // Never earlier than the declared cadence allows
+  unsigned long interval = getFrameInterval();
+  if (interval > 0) {
+    deadline = latestDeadline(deadline, lastModeFrame + interval);
+  }
+
+  // Reports, auto cycling and clock sync rely on the sleeper's MAX_IDLE_SLEEP cap
+  return deadline;
+}
+
+bool DisplayController::canLightSleep() const {
+  return currentMode != DisplayMode::STREAM_RECEIVER && !g_sharedClock && feedbackUntil == 0;
+}
+
+void DisplayController::runModeFrame() {
+  unsigned long start = micros();
+  AllocationTracker::watchCurrentTask();
+  AllocationCount allocatedBefore = AllocationTracker::watched();
+
+  switch (currentMode) {
+    case DisplayMode::TEXT_CONTENT:
+      updateTextContent();
+      break;
+    case DisplayMode::SPACE_ANIMATION:
+      updateSpaceAnimation();
+      break;
+    case DisplayMode::COLOR_SHOW:
+      updateColorShow();
+      break;
+    case DisplayMode::TEST_PATTERNS:
+      updateTestPatterns();
+      break;
+    case DisplayMode::BENCHMARK:
+      benchmark.update();
+      break;
+    case DisplayMode::STREAM_RECEIVER:
+      updateStreamReceiver();
+      break;
+  }
+
+  // Refine the expected cost with a moving average (1/8 weight per frame)
+  ModeSchedule& schedule = schedules[static_cast<int>(currentMode)];
+  unsigned long cost = (uint32_t)(micros() - start);
+  schedule.frameCostMicros = (schedule.frameCostMicros * 7 + cost) / 8;
+  g_perfMonitor->recordRenderTime(cost);
+  g_perfMonitor->recordAllocations(getDisplayModeName(),
+                                   currentMode == DisplayMode::TEXT_CONTENT ? getTransitionName() : "",
+                                   AllocationTracker::watchedSince(allocatedBefore));
+
+  // Shed or restore effect detail when frames keep overrunning or fit easily
+  if (quality.recordFrame(cost)) {
+    applyQuality();
+    g_logBuffer.log("Quality level %d (%s) - %luus per frame\n",
+                    quality.getLevel(), quality.getSettings().name, quality.getLastWindowAverage());
+  }
+}
+
+void DisplayController::runBackgroundWork(unsigned long frameStart, bool beforeMode) {
+  unsigned long now = millis();
+
+  // Auto-cycle transitions (optional)
+  if (autoTransitionCycling && currentMode == DisplayMode::TEXT_CONTENT &&
+      (uint32_t)(now - lastTransitionChange) > transitionChangeInterval) {
+    cycleThroughTransitions();
+  }
+
+  if (!inlineReporting || !g_perfMonitor || !g_perfMonitor->isReportDue()) return;
+
+  unsigned long elapsed = (uint32_t)(micros() - frameStart);
+  unsigned long reserved = beforeMode ? schedules[static_cast<int>(currentMode)].frameCostMicros : 0;
+  bool fits = elapsed + reserved + BACKGROUND_COST_MICROS <= FRAME_BUDGET_MICROS;
+
+  // A report that keeps missing the budget is forced through eventually
+  if (fits || deferredReports >= MAX_DEFERRED_REPORTS) {
+    g_perfMonitor->reportPerformance();
+    deferredReports = 0;
+  } else if (!beforeMode) {
+    deferredReports++;
+  }
+}
+
+//=============================================================================
+// Button Handling
+//=============================================================================
+
+InputEvent DisplayController::sampleButton() {
+  InputEvent event = InputEvent::NONE;
+
+  if (digitalRead(BUTTON_PIN) == LOW) {
+    if (buttonPressTime == 0) {
+      buttonPressTime = millis(); // Mark the time button was first pressed
+    }
+
+    if ((uint32_t)(millis() - buttonPressTime) > LONG_PRESS_TIME && !longPressActive) {
+      event = InputEvent::LONG_PRESS;
+      longPressActive = true;
+    }
+  } else {
+    if (buttonPressTime > 0) {
+      if (!longPressActive) {
+        event = InputEvent::SHORT_PRESS;
+      }
+      buttonPressTime = 0;
+      longPressActive = false;
+    }
+  }
+
+  return event;
+}
+
+void DisplayController::handleInput(InputEvent event) {
+  switch (event) {
+    case InputEvent::SHORT_PRESS:
+      handleShortPress();
+      break;
+    case InputEvent::LONG_PRESS:
+      handleLongPress();
+      break;
+    default:
+      break;
+  }
+}
+
+void DisplayController::handleShortPress() {
+  if (currentMode == DisplayMode::TEXT_CONTENT) {
+    // Always cycle through transitions in text mode
+    cycleThroughTransitions();
+  } else {
+    // In other modes, short press switches back to text mode
+    setDisplayMode(DisplayMode::TEXT_CONTENT);
+    g_logBuffer.log("Switched back to Text Content mode\n");
+  }
+}
+
+void DisplayController::handleLongPress() {
+  // Long press cycles through display modes
+  int nextMode = (static_cast<int>(currentMode) + 1) % getDisplayModeCount();
+  setDisplayMode(static_cast<DisplayMode>(nextMode));
+
+  g_logBuffer.log("Long press - Mode changed to: %s\n", getDisplayModeName());
+
+  // Visual feedback - held by the frame loop instead of blocking
+  FastLED.setBrightness(MAX_BRIGHTNESS/2);
+  fill_solid(leds, g_topology.getLedCount(), CRGB::Blue);
+  show_frame();
+  feedbackUntil = millis() + BUTTON_FEEDBACK_TIME;
+  if (feedbackUntil == 0) feedbackUntil = 1; // Zero means no feedback pending
+}
+
+//=============================================================================
+// Mode Management
+//=============================================================================
+
+void DisplayController::setDisplayMode(DisplayMode mode) {
+  currentMode = mode;
+  resetModeState();
+}
+
+const char* DisplayController::getDisplayModeName() const {
+  return getDisplayModeNameFor(currentMode);
+}
+
+const char* DisplayController::getDisplayModeNameFor(DisplayMode mode) const {
+  switch (mode) {
+    case DisplayMode::TEXT_CONTENT: return "Text Content";
+    case DisplayMode::SPACE_ANIMATION: return "Space Animation";
+    case DisplayMode::COLOR_SHOW: return "Color Show";
+    case DisplayMode::TEST_PATTERNS: return "Test Patterns";
+    case DisplayMode::BENCHMARK: return "Benchmark";
+    case DisplayMode::STREAM_RECEIVER: return "Stream Receiver";
+    default: return "Unknown";
+  }
+}
+
+void DisplayController::reset() {
+  resetModeState();
+  if (feedbackUntil != 0) {
+    // Drop pending button feedback along with the mode state
+    feedbackUntil = 0;
+    FastLED.setBrightness(MAX_BRIGHTNESS);
+  }
+  if (currentTransition) {
+    currentTransition->reset();
+  }
+  spaceAnimation.reset();
+  quality.reset();
+  applyQuality();
+}
+
+void DisplayController::resetModeState() {
+  // The first frame is due at once. A zero timestamp would not do: just
+  // before millis() wraps, it reads as a deadline in the future.
+  unsigned long now = millis();
+  lastModeFrame = now - getFrameInterval();
+  colorPhase = COLOR_FILL;
+  colorIndex = 0;
+  colorHue = random(1, 255);
+  colorPhaseTime = now;
+  testX = 0;
+  testY = 0;
+  testPixelOn = false;
+  testStepTime = now - 30UL;
+  benchmark.reset();
+  if (streamDecoder) {
+    streamDecoder->reset();
+  }
+}
+
+//=============================================================================
+// Transition Management
+//=============================================================================
+
+void DisplayController::createTransition(TransitionType type) {
+  // Each transition is built once; switching back to it only resets it
+  std::unique_ptr<TransitionEffect>& slot = transitions[static_cast<int>(type)];
+  if (!slot) {
+    slot.reset(TransitionFactory::createTransition(type, smoothTransitions));
+  }
+  currentTransition = slot.get();
+  currentTransitionType = type;
+  if (currentTransition) {
+    currentTransition->setSmoothTransitions(smoothTransitions);
+    currentTransition->reset();
+    // Chained controllers scroll off the shared time base
+    if (g_sharedClock && type == TransitionType::SMOOTH_SCROLL) {
+      static_cast<SmoothScrollTransition*>(currentTransition)->setSharedClock(g_sharedClock, CLOCK_SYNC_COLUMN_OFFSET);
+    }
+  }
+  applyQuality();
+  g_logBuffer.log("Switched to transition: %s\n", TransitionFactory::getTransitionName(type));
+}
+
+void DisplayController::applyQuality() {
+  const QualitySettings& settings = quality.getSettings();
+  spaceAnimation.setDetail(settings.starPercent, settings.nebula);
+  TransitionEffect* scroll = transitions[static_cast<int>(TransitionType::SMOOTH_SCROLL)].get();
+  if (scroll) {
+    static_cast<SmoothScrollTransition*>(scroll)->setStepStride(settings.scrollStride);
+  }
+  if (g_perfMonitor) g_perfMonitor->setQualityLevel(quality.getLevel());
+}
+
+void DisplayController::setTransitionType(TransitionType type) {
+  createTransition(type);
+}
+
+TransitionType DisplayController::getTransitionType() const {
+  return currentTransitionType;
+}
+
+const char* DisplayController::getTransitionName() const {
+  return TransitionFactory::getTransitionName(currentTransitionType);
+}
+
+int DisplayController::getTransitionCount() const {
+  return TransitionFactory::getImplementedCount();
+}
+
+void DisplayController::cycleThroughTransitions() {
+  int nextType = (static_cast<int>(currentTransitionType) + 1) % getTransitionCount();
+  createTransition(static_cast<TransitionType>(nextType));
+
+  // Randomize color mode when switching transitions
+  contentManager.randomizeColorMode();
+
+  lastTransitionChange = millis();
+  g_logBuffer.log("Cycled to transition %d of %d total\n", nextType + 1, getTransitionCount());
+}
+
+void DisplayController::cycleStoryFont() {
+  int story = contentManager.getCurrentStoryIndex();
+  if (story < 0 || story >= contentManager.getStoryCount()) return;
+
+  int next = (static_cast<int>(contentManager.getStoryFontId(story)) + 1) % NUM_FONTS;
+  contentManager.setStoryFont(story, static_cast<FontId>(next));
+  if (currentTransition) {
+    currentTransition->reset(); // Held frames were drawn in the old font
+  }
+  g_logBuffer.log("Story %d font: %s\n", story, getFont(static_cast<FontId>(next)).name);
+}
+
+void DisplayController::setSmoothTransitions(bool smooth) {
+  smoothTransitions = smooth;
+  if (currentTransition) {
+    currentTransition->setSmoothTransitions(smooth);
+  }
+}
+
+//=============================================================================
+// Mode Updates
+//=============================================================================
+
+void DisplayController::updateTextContent() {
+  if (currentTransition) {
+    currentTransition->update(contentManager);
+  }
+}
+
+void DisplayController::updateSpaceAnimation() {
+  spaceAnimation.update();
+  spaceAnimation.render();
+}
+
+void DisplayController::updateColorShow() {
+  // Original color show, one step per frame: fill the chain one LED at a time,
+  // hold for a second, then fade out over 50 steps and start over
+  unsigned long now = millis();
+
+  switch (colorPhase) {
+    case COLOR_FILL: {
+      CRGB color;
+      color.setHSV(colorHue + colorIndex/2, 255 - (colorIndex%2==0 ? 50 : 0), 70);
+      leds[colorIndex] = color;
+      show_frame();
+
+      if (++colorIndex >= g_topology.getLedCount()) {
+        colorPhase = COLOR_HOLD;
+        colorPhaseTime = now;
+      }
+      break;
+    }
+
+    case COLOR_HOLD:
+      if ((uint32_t)(now - colorPhaseTime) >= 1000) {
+        colorPhase = COLOR_FADE;
+        colorIndex = 0;
+        colorPhaseTime = now;
+      }
+      break;
+
+    case COLOR_FADE:
+      if ((uint32_t)(now - colorPhaseTime) < 50) break;
+      colorPhaseTime = now;
+
+      for (int i = 0; i < g_topology.getLedCount(); i++) {
+        leds[i].fadeToBlackBy(3+random(5));
+      }
+      show_frame();
+
+      if (++colorIndex >= 50) {
+        colorPhase = COLOR_FILL;
+        colorIndex = 0;
+        colorHue = random(1, 255);
+      }
+      break;
+  }
+}
+
+void DisplayController::updateTestPatterns() {
+  // Walk a single white pixel across the display: on for 30ms, off for 2ms
+  unsigned long now = millis();
+  if ((uint32_t)(now - testStepTime) < (testPixelOn ? 30UL : 2UL)) return;
+  testStepTime = now;
+
+  if (!testPixelOn) {
+    set_led(testX, testY, CRGB::White);
+    show_frame();
+    testPixelOn = true;
+    return;
+  }
+
+  set_led(testX, testY, CRGB::Black);
+  show_frame();
+  testPixelOn = false;
+
+  testX++;
+  if (testX >= g_topology.getWidth()){
+    testX = 0;
+    testY++;
+    if (testY >= g_topology.getHeight()){
+      testY = 0;
+    }
+  }
+}
+
+void DisplayController::updateStreamReceiver() {
+  // Thin display mode - apply frames rendered and streamed by a host over serial.
+  // Only the newest complete frame is shown if several arrived since the last frame.
+  bool frameReady = false;
+  while (Serial.available() > 0) {
+    if (streamDecoder->feed(Serial.read())) {
+      frameReady = true;
+    }
+  }
+
+  if (frameReady) {
+    show_frame();
+  }
+}
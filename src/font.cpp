@@ -0,0 +1,1050 @@
+#include "font.h"
+
+/*
+ * 5 x 7 ASCII fonts.
+ *
+ * Each byte here has one "column" of the character
+ * This minimizes the number of wasted bits (rather
+ * than 7 bytes of 5 bit 'lines' it is 5 bytes of
+ * 7 bit 'columns'.
+ */
+
+// from https://www.eevblog.com/forum/projects/5x7-or-7x9-dot-matrix-font-files-in-cc/
+
+
+// Matrix orbital
+static constexpr uint8_t font_mo[240][5] = {
+	{ 0x44, 0x44, 0x5F, 0x44, 0x44 },  // 10  16
+	{ 0x2A, 0x2A, 0x2A, 0x2A, 0x2A },  // 11  17
+	{ 0x07, 0x39, 0xC1, 0x01, 0x0F },  // 12  18
+	{ 0x80, 0x70, 0x0E, 0x01, 0xC0 },  // 13  19
+	{ 0x00, 0x00, 0xF8, 0x06, 0x01 },  // 14  20
+	{ 0x00, 0x00, 0x7F, 0x80, 0x00 },  // 15  21
+	{ 0x01, 0x06, 0xF8, 0x00, 0x00 },  // 16  22
+	{ 0x00, 0x80, 0x7F, 0x00, 0x00 },  // 17  23
+	{ 0x00, 0x00, 0xFC, 0x02, 0x01 },  // 18  24
+	{ 0x01, 0x02, 0xFC, 0x00, 0x00 },  // 19  25
+	{ 0x24, 0x12, 0x24, 0x12, 0x00 },  // 1A  26
+	{ 0x00, 0x00, 0xFE, 0x01, 0x03 },  // 1B  27
+	{ 0x50, 0x50, 0x50, 0x50, 0x50 },  // 1C  28
+	{ 0x18, 0x04, 0x18, 0x20, 0x18 },  // 1D  29
+	{ 0x1D, 0x15, 0x17, 0x00, 0x00 },  // 1E  30
+	{ 0x15, 0x15, 0x1F, 0x00, 0x00 },  // 1F  31
+	{ 0x00, 0x00, 0x00, 0x00, 0x00 },  // 20  32
+	{ 0x00, 0x00, 0x4F, 0x00, 0x00 },  // 21  33  !
+	{ 0x00, 0x07, 0x00, 0x07, 0x00 },  // 22  34  "
+	{ 0x14, 0x7F, 0x14, 0x7F, 0x14 },  // 23  35  #
+	{ 0x24, 0x2A, 0x7F, 0x2A, 0x12 },  // 24  36  $
+	{ 0x23, 0x13, 0x08, 0x64, 0x62 },  // 25  37  %
+	{ 0x36, 0x49, 0x56, 0x20, 0x58 },  // 26  38  &
+	{ 0x00, 0x05, 0x03, 0x00, 0x00 },  // 27  39  '
+	{ 0x00, 0x1C, 0x22, 0x41, 0x00 },  // 28  40  (
+	{ 0x00, 0x41, 0x22, 0x1C, 0x00 },  // 29  41  )
+	{ 0x22, 0x14, 0x7F, 0x14, 0x22 },  // 2A  42  *
+	{ 0x08, 0x08, 0x3E, 0x08, 0x08 },  // 2B  43  +
+	{ 0x00, 0x50, 0x30, 0x00, 0x00 },  // 2C  44  ,
+	{ 0x08, 0x08, 0x08, 0x08, 0x08 },  // 2D  45  -
+	{ 0x00, 0x60, 0x60, 0x00, 0x00 },  // 2E  46  .
+	{ 0x20, 0x10, 0x08, 0x04, 0x02 },  // 2F  47  /
+	{ 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 30  48  0
+	{ 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 31  49  1
+	{ 0x42, 0x61, 0x51, 0x49, 0x46 },  // 32  50  2
+	{ 0x21, 0x41, 0x45, 0x4B, 0x31 },  // 33  51  3
+	{ 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 34  52  4
+	{ 0x27, 0x45, 0x45, 0x45, 0x39 },  // 35  53  5
+	{ 0x3C, 0x4A, 0x49, 0x49, 0x30 },  // 36  54  6
+	{ 0x01, 0x01, 0x71, 0x0D, 0x03 },  // 37  55  7
+	{ 0x36, 0x49, 0x49, 0x49, 0x36 },  // 38  56  8
+	{ 0x06, 0x49, 0x49, 0x29, 0x1E },  // 39  57  9
+	{ 0x00, 0x36, 0x36, 0x00, 0x00 },  // 3A  58  :
+	{ 0x00, 0x56, 0x36, 0x00, 0x00 },  // 3B  59  ;
+	{ 0x08, 0x14, 0x22, 0x41, 0x00 },  // 3C  60  <
+	{ 0x14, 0x14, 0x14, 0x14, 0x14 },  // 3D  61  =
+	{ 0x00, 0x41, 0x22, 0x14, 0x08 },  // 3E  62  >
+	{ 0x02, 0x01, 0x51, 0x09, 0x06 },  // 3F  63  ?
+	{ 0x3E, 0x41, 0x5D, 0x55, 0x1E },  // 40  64  @
+	{ 0x7C, 0x12, 0x11, 0x12, 0x7C },  // 41  65  A
+	{ 0x7F, 0x49, 0x49, 0x49, 0x36 },  // 42  66  B
+	{ 0x3E, 0x41, 0x41, 0x41, 0x22 },  // 43  67  C
+	{ 0x7F, 0x41, 0x41, 0x22, 0x1C },  // 44  68  D
+	{ 0x7F, 0x49, 0x49, 0x49, 0x41 },  // 45  69  E
+	{ 0x7F, 0x09, 0x09, 0x09, 0x01 },  // 46  70  F
+	{ 0x3E, 0x41, 0x49, 0x49, 0x7A },  // 47  71  G
+	{ 0x7F, 0x08, 0x08, 0x08, 0x7F },  // 48  72  H
+	{ 0x00, 0x41, 0x7F, 0x41, 0x00 },  // 49  73  I
+	{ 0x20, 0x41, 0x41, 0x3F, 0x01 },  // 4A  74  J
+	{ 0x7F, 0x08, 0x14, 0x22, 0x41 },  // 4B  75  K
+	{ 0x7F, 0x40, 0x40, 0x40, 0x40 },  // 4C  76  L
+	{ 0x7F, 0x02, 0x0C, 0x02, 0x7F },  // 4D  77  M
+	{ 0x7F, 0x04, 0x08, 0x10, 0x7F },  // 4E  78  N
+	{ 0x3E, 0x41, 0x41, 0x41, 0x3E },  // 4F  79  O
+	{ 0x7F, 0x09, 0x09, 0x09, 0x06 },  // 50  80  P
+	{ 0x3E, 0x41, 0x51, 0x21, 0x5E },  // 51  81  Q
+	{ 0x7F, 0x09, 0x19, 0x29, 0x46 },  // 52  82  R
+	{ 0x26, 0x49, 0x49, 0x49, 0x32 },  // 53  83  S
+	{ 0x01, 0x01, 0x7F, 0x01, 0x01 },  // 54  84  T
+	{ 0x3F, 0x40, 0x40, 0x40, 0x3F },  // 55  85  U
+	{ 0x1F, 0x20, 0x40, 0x20, 0x1F },  // 56  86  V
+	{ 0x3F, 0x40, 0x38, 0x40, 0x3F },  // 57  87  W
+	{ 0x63, 0x14, 0x08, 0x14, 0x63 },  // 58  88  X
+	{ 0x03, 0x04, 0x78, 0x04, 0x03 },  // 59  89  Y
+	{ 0x61, 0x51, 0x49, 0x45, 0x43 },  // 5A  90  Z
+	{ 0x00, 0x7F, 0x41, 0x41, 0x00 },  // 5B  91  [
+	{ 0x02, 0x04, 0x08, 0x10, 0x20 },  // 5C  92  '\'
+	{ 0x00, 0x41, 0x41, 0x7F, 0x00 },  // 5D  93  ]
+	{ 0x04, 0x02, 0x01, 0x02, 0x04 },  // 5E  94  ^
+	{ 0x40, 0x40, 0x40, 0x40, 0x40 },  // 5F  95  _
+	{ 0x00, 0x00, 0x03, 0x05, 0x00 },  // 60  96  `
+	{ 0x20, 0x54, 0x54, 0x54, 0x78 },  // 61  97  a
+	{ 0x7F, 0x44, 0x44, 0x44, 0x38 },  // 62  98  b
+	{ 0x38, 0x44, 0x44, 0x44, 0x44 },  // 63  99  c
+	{ 0x38, 0x44, 0x44, 0x44, 0x7F },  // 64 100  d
+	{ 0x38, 0x54, 0x54, 0x54, 0x18 },  // 65 101  e
+	{ 0x04, 0x04, 0x7E, 0x05, 0x05 },  // 66 102  f
+	{ 0x08, 0x54, 0x54, 0x54, 0x3C },  // 67 103  g
+	{ 0x7F, 0x08, 0x04, 0x04, 0x78 },  // 68 104  h
+	{ 0x00, 0x44, 0x7D, 0x40, 0x00 },  // 69 105  i
+	{ 0x20, 0x40, 0x44, 0x3D, 0x00 },  // 6A 106  j
+	{ 0x00, 0x7F, 0x10, 0x28, 0x44 },  // 6B 107  k
+	{ 0x00, 0x41, 0x7F, 0x40, 0x00 },  // 6C 108  l
+	{ 0x7C, 0x04, 0x78, 0x04, 0x78 },  // 6D 109  m
+	{ 0x7C, 0x08, 0x04, 0x04, 0x78 },  // 6E 110  n
+	{ 0x38, 0x44, 0x44, 0x44, 0x38 },  // 6F 111  o
+	{ 0x7C, 0x14, 0x14, 0x14, 0x08 },  // 70 112  p
+	{ 0x08, 0x14, 0x14, 0x14, 0x7C },  // 71 113  q
+	{ 0x00, 0x7C, 0x08, 0x04, 0x04 },  // 72 114  r
+	{ 0x48, 0x54, 0x54, 0x54, 0x20 },  // 73 115  s
+	{ 0x04, 0x04, 0x3F, 0x44, 0x44 },  // 74 116  t
+	{ 0x3C, 0x40, 0x40, 0x20, 0x7C },  // 75 117  u
+	{ 0x1C, 0x20, 0x40, 0x20, 0x1C },  // 76 118  v
+	{ 0x3C, 0x40, 0x30, 0x40, 0x3C },  // 77 119  w
+	{ 0x44, 0x28, 0x10, 0x28, 0x44 },  // 78 120  x
+	{ 0x0C, 0x50, 0x50, 0x50, 0x3C },  // 79 121  y
+	{ 0x44, 0x64, 0x54, 0x4C, 0x44 },  // 7A 122  z
+	{ 0x00, 0x08, 0x36, 0x41, 0x41 },  // 7B 123  {
+	{ 0x00, 0x00, 0x7F, 0x00, 0x00 },  // 7C 124  |
+	{ 0x41, 0x41, 0x36, 0x08, 0x00 },  // 7D 125  }
+	{ 0x02, 0x01, 0x02, 0x04, 0x02 },  // 7E 126  ~
+	{ 0x60, 0x58, 0x46, 0x58, 0x60 },  // 7F 127
+	{ 0x0E, 0x51, 0x51, 0x71, 0x11 },  // 80 128
+	{ 0x38, 0x42, 0x40, 0x22, 0x78 },  // 81 129
+	{ 0x38, 0x54, 0x56, 0x55, 0x18 },  // 82 130
+	{ 0x20, 0x56, 0x55, 0x56, 0x78 },  // 83 131
+	{ 0x20, 0x55, 0x54, 0x55, 0x78 },  // 84 132
+	{ 0x20, 0x55, 0x56, 0x54, 0x78 },  // 85 133
+	{ 0x20, 0x54, 0x55, 0x54, 0x78 },  // 86 134
+	{ 0x0C, 0x52, 0x52, 0x72, 0x12 },  // 87 135
+	{ 0x38, 0x56, 0x55, 0x56, 0x18 },  // 88 136
+	{ 0x38, 0x55, 0x54, 0x55, 0x18 },  // 89 137
+	{ 0x38, 0x55, 0x56, 0x54, 0x18 },  // 8A 138
+	{ 0x00, 0x45, 0x7C, 0x41, 0x00 },  // 8B 139
+	{ 0x00, 0x4A, 0x79, 0x42, 0x00 },  // 8C 140
+	{ 0x00, 0x49, 0x7A, 0x40, 0x00 },  // 8D 141
+	{ 0x70, 0x29, 0x24, 0x29, 0x70 },  // 8E 142
+	{ 0x70, 0x2A, 0x2D, 0x2A, 0x70 },  // 8F 143
+	{ 0x7C, 0x54, 0x56, 0x55, 0x44 },  // 90 144
+	{ 0x24, 0x54, 0x78, 0x54, 0x58 },  // 91 145
+	{ 0x7E, 0x09, 0x7F, 0x49, 0x49 },  // 92 146
+	{ 0x30, 0x4A, 0x49, 0x4A, 0x30 },  // 93 147
+	{ 0x30, 0x4A, 0x48, 0x4A, 0x30 },  // 94 148
+	{ 0x30, 0x49, 0x4A, 0x48, 0x30 },  // 95 149
+	{ 0x38, 0x42, 0x41, 0x22, 0x78 },  // 96 150
+	{ 0x38, 0x41, 0x42, 0x20, 0x78 },  // 97 151
+	{ 0x0C, 0x51, 0x50, 0x51, 0x3C },  // 98 152
+	{ 0x3D, 0x42, 0x42, 0x42, 0x3D },  // 99 153
+	{ 0x3C, 0x41, 0x40, 0x41, 0x3C },  // 9A 154
+	{ 0x7A, 0x11, 0x09, 0x0A, 0x71 },  // 9B 155
+	{ 0x7A, 0x09, 0x11, 0x22, 0x79 },  // 9C 156
+	{ 0x48, 0x55, 0x55, 0x55, 0x5E },  // 9D 157
+	{ 0x4E, 0x51, 0x51, 0x51, 0x4E },  // 9E 158
+	{ 0x30, 0x48, 0x45, 0x40, 0x20 },  // 9F 159
+	{ 0x20, 0x54, 0x56, 0x55, 0x78 },  // A0 160
+	{ 0x00, 0x48, 0x7A, 0x41, 0x00 },  // A1 161
+	{ 0x30, 0x48, 0x4A, 0x49, 0x30 },  // A2 162
+	{ 0x38, 0x40, 0x42, 0x21, 0x78 },  // A3 163
+	{ 0x1C, 0x22, 0x7F, 0x22, 0x22 },  // A4 164
+	{ 0x48, 0x7E, 0x49, 0x49, 0x42 },  // A5 165
+	{ 0x15, 0x16, 0x7C, 0x16, 0x15 },  // A6 166
+	{ 0x7F, 0x05, 0x15, 0x7A, 0x50 },  // A7 167
+	{ 0x20, 0x48, 0x3E, 0x09, 0x02 },  // A8 168
+	{ 0x00, 0x00, 0x79, 0x00, 0x00 },  // A9 169
+	{ 0x72, 0x29, 0x29, 0x2A, 0x71 },  // AA 170
+	{ 0x22, 0x51, 0x55, 0x56, 0x79 },  // AB 171
+	{ 0x3A, 0x45, 0x45, 0x46, 0x39 },  // AC 172
+	{ 0x32, 0x49, 0x49, 0x4A, 0x31 },  // AD 173
+	{ 0x5C, 0x32, 0x2A, 0x26, 0x1D },  // AE 174
+	{ 0x18, 0x64, 0x3C, 0x26, 0x18 },  // AF 175
+	{ 0x00, 0x00, 0x01, 0x00, 0x00 },  // B0 176
+	{ 0x00, 0x01, 0x00, 0x01, 0x00 },  // B1 177
+	{ 0x00, 0x02, 0x05, 0x02, 0x00 },  // B2 178
+	{ 0x00, 0x01, 0x02, 0x00, 0x00 },  // B3 179
+	{ 0x00, 0x00, 0x02, 0x01, 0x00 },  // B4 180
+	{ 0x0F, 0x00, 0x48, 0x64, 0x58 },  // B5 181
+	{ 0x0F, 0x00, 0x3C, 0x20, 0x78 },  // B6 182
+	{ 0x22, 0x14, 0x08, 0x14, 0x22 },  // B7 183
+	{ 0x08, 0x08, 0x2A, 0x08, 0x08 },  // B8 184
+	{ 0x40, 0x44, 0x4A, 0x51, 0x40 },  // B9 185
+	{ 0x40, 0x51, 0x4A, 0x44, 0x40 },  // BA 186
+	{ 0x08, 0x14, 0x2A, 0x14, 0x22 },  // BB 187
+	{ 0x22, 0x14, 0x2A, 0x14, 0x08 },  // BC 188
+	{ 0x14, 0x74, 0x1C, 0x17, 0x14 },  // BD 189
+	{ 0x10, 0x20, 0x7F, 0x01, 0x01 },  // BE 190
+	{ 0x01, 0x01, 0x01, 0x01, 0x01 },  // BF 191
+	{ 0x00, 0x00, 0x7E, 0x01, 0x02 },  // C0 192
+	{ 0x20, 0x40, 0x3F, 0x00, 0x00 },  // C1 193
+	{ 0x18, 0x24, 0x18, 0x24, 0x18 },  // C2 194
+	{ 0x3F, 0x11, 0x09, 0x05, 0x03 },  // C3 195
+	{ 0x10, 0x38, 0x54, 0x10, 0x1F },  // C4 196
+	{ 0x04, 0x02, 0x7F, 0x02, 0x04 },  // C5 197
+	{ 0x10, 0x20, 0x7F, 0x20, 0x10 },  // C6 198
+	{ 0x08, 0x08, 0x2A, 0x1C, 0x08 },  // C7 199
+	{ 0x08, 0x1C, 0x2A, 0x08, 0x08 },  // C8 200
+	{ 0x7F, 0x01, 0x01, 0x01, 0x01 },  // C9 201
+	{ 0x01, 0x01, 0x01, 0x01, 0x7F },  // CA 202
+	{ 0x7F, 0x40, 0x40, 0x40, 0x40 },  // CB 203
+	{ 0x40, 0x40, 0x40, 0x40, 0x7F },  // CC 204
+	{ 0x00, 0x18, 0x18, 0x00, 0x00 },  // CD 205
+	{ 0x3E, 0x41, 0x75, 0x4B, 0x3E },  // CE 206
+	{ 0x3E, 0x63, 0x5D, 0x6B, 0x3E },  // CF 207
+	{ 0x79, 0x11, 0x27, 0x11, 0x79 },  // D0 208
+	{ 0x04, 0x04, 0x7F, 0x04, 0x04 },  // D1 209
+	{ 0x0A, 0x55, 0x55, 0x55, 0x28 },  // D2 210
+	{ 0x06, 0x0F, 0x7F, 0x01, 0x7F },  // D3 211
+	{ 0x7F, 0x01, 0x01, 0x01, 0x07 },  // D4 212
+	{ 0x60, 0x50, 0x48, 0x44, 0x7E },  // D5 213
+	{ 0x3E, 0x49, 0x49, 0x49, 0x3E },  // D6 214
+	{ 0x70, 0x0C, 0x03, 0x0C, 0x70 },  // D7 215
+	{ 0x63, 0x49, 0x49, 0x49, 0x63 },  // D8 216
+	{ 0x01, 0x7F, 0x01, 0x7F, 0x01 },  // D9 217
+	{ 0x41, 0x63, 0x55, 0x49, 0x41 },  // DA 218
+	{ 0x06, 0x01, 0x7E, 0x01, 0x06 },  // DB 219
+	{ 0x18, 0xA5, 0xFF, 0xA5, 0x18 },  // DC 220
+	{ 0x0F, 0x10, 0x7F, 0x10, 0x0F },  // DD 221
+	{ 0x4E, 0x71, 0x01, 0x71, 0x4E },  // DE 222
+	{ 0x38, 0x44, 0x44, 0x38, 0x44 },  // DF 223
+	{ 0xFE, 0x01, 0x49, 0x4E, 0x30 },  // E0 224
+	{ 0x04, 0x98, 0x60, 0x18, 0x04 },  // E1 225
+	{ 0x30, 0x4A, 0x4D, 0x49, 0x32 },  // E2 226
+	{ 0x38, 0x54, 0x54, 0x54, 0x44 },  // E3 227
+	{ 0x31, 0x49, 0x45, 0x43, 0x81 },  // E4 228
+	{ 0x04, 0x78, 0x04, 0x04, 0xF8 },  // E5 229
+	{ 0x3E, 0x49, 0x49, 0x3E, 0x00 },  // E6 230
+	{ 0x00, 0x00, 0x3C, 0x40, 0x40 },  // E7 231
+	{ 0x00, 0x7C, 0x10, 0x28, 0x44 },  // E8 232
+	{ 0x40, 0x31, 0x0F, 0x30, 0x40 },  // E9 233
+	{ 0xFC, 0x40, 0x40, 0x3C, 0x40 },  // EA 234
+	{ 0x3C, 0x40, 0x20, 0x14, 0x0C },  // EB 235
+	{ 0x61, 0x95, 0x8B, 0x89, 0x09 },  // EC 236
+	{ 0x44, 0x3C, 0x04, 0x7C, 0x44 },  // ED 237
+	{ 0xF8, 0x44, 0x44, 0x44, 0x38 },  // EE 238
+	{ 0x38, 0x44, 0x44, 0x3C, 0x04 },  // EF 239
+	{ 0x04, 0x04, 0x3C, 0x44, 0x24 },  // F0 240
+	{ 0x3C, 0x40, 0x40, 0x24, 0x18 },  // F1 241
+	{ 0x04, 0xC4, 0xF8, 0x30, 0x0C },  // F2 242
+	{ 0x38, 0x40, 0xFC, 0x40, 0x38 },  // F3 243
+	{ 0x38, 0x44, 0x30, 0x44, 0x38 },  // F4 244
+	{ 0x06, 0x1E, 0x7E, 0x1E, 0x06 },  // F5 245
+	{ 0x3E, 0x1C, 0x1C, 0x08, 0x08 },  // F6 246
+	{ 0x08, 0x08, 0x1C, 0x1C, 0x3E },  // F7 247
+	{ 0x7F, 0x7F, 0x1B, 0x7F, 0x6E },  // F8 248
+	{ 0x08, 0x1C, 0x2A, 0x08, 0x7F },  // F9 249
+	{ 0x7F, 0x7F, 0x1B, 0x1B, 0x03 },  // FA 250
+	{ 0x08, 0x08, 0x2A, 0x1C, 0x7F },  // FB 251
+	{ 0xFF, 0x81, 0x81, 0x81, 0xFF },  // FC 252
+	{ 0x18, 0x18, 0x18, 0x18, 0x18 },  // FD 253
+	{ 0x7F, 0x53, 0x55, 0x65, 0x7F },  // FE 254
+	{ 0x7F, 0x41, 0x75, 0x71, 0x7F }   // FF 255
+};
+
+// Crystalfontz
+static constexpr uint8_t font_cf[240][5] = {
+	{ 0x00, 0x7F, 0x3E, 0x1C, 0x08 },  // 10  16
+	{ 0x08, 0x1C, 0x3E, 0x7F, 0x00 },  // 11  17
+	{ 0x44, 0x66, 0x77, 0x66, 0x44 },  // 12  18
+	{ 0x11, 0x33, 0x77, 0x33, 0x11 },  // 13  19
+	{ 0x08, 0x14, 0x2A, 0x14, 0x22 },  // 14  20
+	{ 0x22, 0x14, 0x2A, 0x14, 0x08 },  // 15  21
+	{ 0x07, 0x03, 0x05, 0x08, 0x10 },  // 16  22
+	{ 0x10, 0x08, 0x05, 0x03, 0x07 },  // 17  23
+	{ 0x70, 0x60, 0x50, 0x08, 0x04 },  // 18  24
+	{ 0x04, 0x08, 0x50, 0x60, 0x70 },  // 19  25
+	{ 0x20, 0x38, 0x3E, 0x38, 0x20 },  // 1A  26
+	{ 0x02, 0x0E, 0x3E, 0x0E, 0x02 },  // 1B  27
+	{ 0x10, 0x38, 0x54, 0x10, 0x1F },  // 1C  28
+	{ 0x04, 0x02, 0x01, 0x02, 0x04 },  // 1D  29
+	{ 0x01, 0x02, 0x04, 0x02, 0x01 },  // 1E  30
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },  // 1F  31
+	{ 0x00, 0x00, 0x00, 0x00, 0x00 },  // 20  32
+	{ 0x00, 0x00, 0x5F, 0x00, 0x00 },  // 21  33  !
+	{ 0x00, 0x07, 0x00, 0x07, 0x00 },  // 22  34  "
+	{ 0x14, 0x7F, 0x14, 0x7F, 0x14 },  // 23  35  #
+	{ 0x44, 0x38, 0x28, 0x38, 0x44 },  // 24  36  $
+	{ 0x23, 0x13, 0x08, 0x64, 0x62 },  // 25  37  %
+	{ 0x36, 0x49, 0x55, 0x22, 0x50 },  // 26  38  &
+	{ 0x00, 0x05, 0x03, 0x00, 0x00 },  // 27  39  '
+	{ 0x00, 0x1C, 0x22, 0x41, 0x00 },  // 28  40  (
+	{ 0x00, 0x41, 0x22, 0x1C, 0x00 },  // 29  41  )
+	{ 0x14, 0x08, 0x3E, 0x08, 0x14 },  // 2A  42  *
+	{ 0x08, 0x08, 0x3E, 0x08, 0x08 },  // 2B  43  +
+	{ 0x00, 0x50, 0x30, 0x00, 0x00 },  // 2C  44  ,
+	{ 0x08, 0x08, 0x08, 0x08, 0x08 },  // 2D  45  -
+	{ 0x00, 0x60, 0x60, 0x00, 0x00 },  // 2E  46  .
+	{ 0x20, 0x10, 0x08, 0x04, 0x02 },  // 2F  47  /
+	{ 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 30  48  0
+	{ 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 31  49  1
+	{ 0x42, 0x61, 0x51, 0x49, 0x46 },  // 32  50  2
+	{ 0x21, 0x41, 0x45, 0x4B, 0x31 },  // 33  51  3
+	{ 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 34  52  4
+	{ 0x27, 0x45, 0x45, 0x45, 0x39 },  // 35  53  5
+	{ 0x3C, 0x4A, 0x49, 0x49, 0x30 },  // 36  54  6
+	{ 0x01, 0x71, 0x09, 0x05, 0x03 },  // 37  55  7
+	{ 0x36, 0x49, 0x49, 0x49, 0x36 },  // 38  56  8
+	{ 0x06, 0x49, 0x49, 0x29, 0x1E },  // 39  57  9
+	{ 0x00, 0x36, 0x36, 0x00, 0x00 },  // 3A  58  :
+	{ 0x00, 0x56, 0x36, 0x00, 0x00 },  // 3B  59  ;
+	{ 0x08, 0x14, 0x22, 0x41, 0x00 },  // 3C  60  <
+	{ 0x14, 0x14, 0x14, 0x14, 0x14 },  // 3D  61  =
+	{ 0x00, 0x41, 0x22, 0x14, 0x08 },  // 3E  62  >
+	{ 0x02, 0x01, 0x51, 0x09, 0x06 },  // 3F  63  ?
+	{ 0x00, 0x00, 0x7D, 0x00, 0x00 },  // 40  64  @
+	{ 0x7E, 0x11, 0x11, 0x11, 0x7E },  // 41  65  A
+	{ 0x7F, 0x49, 0x49, 0x49, 0x36 },  // 42  66  B
+	{ 0x3E, 0x41, 0x41, 0x41, 0x22 },  // 43  67  C
+	{ 0x7F, 0x41, 0x41, 0x22, 0x1C },  // 44  68  D
+	{ 0x7F, 0x49, 0x49, 0x49, 0x41 },  // 45  69  E
+	{ 0x7F, 0x09, 0x09, 0x09, 0x01 },  // 46  70  F
+	{ 0x3E, 0x41, 0x49, 0x49, 0x7A },  // 47  71  G
+	{ 0x7F, 0x08, 0x08, 0x08, 0x7F },  // 48  72  H
+	{ 0x00, 0x41, 0x7F, 0x41, 0x00 },  // 49  73  I
+	{ 0x20, 0x40, 0x41, 0x3F, 0x01 },  // 4A  74  J
+	{ 0x7F, 0x08, 0x14, 0x22, 0x41 },  // 4B  75  K
+	{ 0x7F, 0x40, 0x40, 0x40, 0x40 },  // 4C  76  L
+	{ 0x7F, 0x02, 0x0C, 0x02, 0x7F },  // 4D  77  M
+	{ 0x7F, 0x04, 0x08, 0x10, 0x7F },  // 4E  78  N
+	{ 0x3E, 0x41, 0x41, 0x41, 0x3E },  // 4F  79  O
+	{ 0x7F, 0x09, 0x09, 0x09, 0x06 },  // 50  80  P
+	{ 0x3E, 0x41, 0x51, 0x21, 0x5E },  // 51  81  Q
+	{ 0x7F, 0x09, 0x19, 0x29, 0x46 },  // 52  82  R
+	{ 0x46, 0x49, 0x49, 0x49, 0x31 },  // 53  83  S
+	{ 0x01, 0x01, 0x7F, 0x01, 0x01 },  // 54  84  T
+	{ 0x3F, 0x40, 0x40, 0x40, 0x3F },  // 55  85  U
+	{ 0x1F, 0x20, 0x40, 0x20, 0x1F },  // 56  86  V
+	{ 0x3F, 0x40, 0x38, 0x40, 0x3F },  // 57  87  W
+	{ 0x63, 0x14, 0x08, 0x14, 0x63 },  // 58  88  X
+	{ 0x07, 0x08, 0x70, 0x08, 0x07 },  // 59  89  Y
+	{ 0x61, 0x59, 0x49, 0x4D, 0x43 },  // 5A  90  Z
+	{ 0x78, 0x15, 0x14, 0x15, 0x78 },  // 5B  91  [
+	{ 0x38, 0x45, 0x44, 0x45, 0x38 },  // 5C  92  '\'
+	{ 0x78, 0x12, 0x21, 0x42, 0x79 },  // 5D  93  ]
+	{ 0x3C, 0x41, 0x40, 0x41, 0x3C },  // 5E  94  ^
+	{ 0x00, 0x4E, 0x55, 0x39, 0x00 },  // 5F  95  _
+	{ 0x30, 0x48, 0x45, 0x40, 0x20 },  // 60  96  `
+	{ 0x20, 0x54, 0x54, 0x54, 0x78 },  // 61  97  a
+	{ 0x7F, 0x48, 0x44, 0x44, 0x38 },  // 62  98  b
+	{ 0x38, 0x44, 0x44, 0x44, 0x20 },  // 63  99  c
+	{ 0x38, 0x44, 0x44, 0x48, 0x7F },  // 64 100  d
+	{ 0x38, 0x54, 0x54, 0x54, 0x18 },  // 65 101  e
+	{ 0x08, 0x7E, 0x09, 0x01, 0x02 },  // 66 102  f
+	{ 0x0C, 0x52, 0x52, 0x52, 0x3E },  // 67 103  g
+	{ 0x7F, 0x08, 0x04, 0x04, 0x78 },  // 68 104  h
+	{ 0x00, 0x44, 0x7D, 0x40, 0x00 },  // 69 105  i
+	{ 0x20, 0x40, 0x44, 0x3D, 0x00 },  // 6A 106  j
+	{ 0x7F, 0x10, 0x28, 0x44, 0x00 },  // 6B 107  k
+	{ 0x00, 0x41, 0x7F, 0x40, 0x00 },  // 6C 108  l
+	{ 0x78, 0x04, 0x78, 0x04, 0x78 },  // 6D 109  m
+	{ 0x7C, 0x08, 0x04, 0x04, 0x78 },  // 6E 110  n
+	{ 0x38, 0x44, 0x44, 0x44, 0x38 },  // 6F 111  o
+	{ 0x7C, 0x14, 0x14, 0x14, 0x08 },  // 70 112  p
+	{ 0x08, 0x14, 0x14, 0x7C, 0x40 },  // 71 113  q
+	{ 0x7C, 0x08, 0x04, 0x04, 0x08 },  // 72 114  r
+	{ 0x48, 0x54, 0x54, 0x54, 0x20 },  // 73 115  s
+	{ 0x04, 0x3F, 0x44, 0x40, 0x20 },  // 74 116  t
+	{ 0x3C, 0x40, 0x40, 0x20, 0x7C },  // 75 117  u
+	{ 0x1C, 0x20, 0x40, 0x20, 0x1C },  // 76 118  v
+	{ 0x3C, 0x40, 0x30, 0x40, 0x3C },  // 77 119  w
+	{ 0x44, 0x28, 0x10, 0x28, 0x44 },  // 78 120  x
+	{ 0x0C, 0x50, 0x50, 0x50, 0x3C },  // 79 121  y
+	{ 0x44, 0x64, 0x54, 0x4C, 0x44 },  // 7A 122  z
+	{ 0x20, 0x55, 0x54, 0x55, 0x78 },  // 7B 123  {
+	{ 0x30, 0x4A, 0x48, 0x4A, 0x30 },  // 7C 124  |
+	{ 0x78, 0x12, 0x09, 0x0A, 0x71 },  // 7D 125  }
+	{ 0x3C, 0x41, 0x40, 0x21, 0x7C },  // 7E 126  ~
+	{ 0x20, 0x55, 0x56, 0x54, 0x78 },  // 7F 127
+	{ 0x0E, 0x11, 0x11, 0x0E, 0x00 },  // 80 128
+	{ 0x12, 0x1F, 0x10, 0x00, 0x00 },  // 81 129
+	{ 0x12, 0x19, 0x15, 0x12, 0x00 },  // 82 130
+	{ 0x11, 0x15, 0x15, 0x0A, 0x00 },  // 83 131
+	{ 0x0C, 0x0A, 0x1F, 0x08, 0x00 },  // 84 132
+	{ 0x17, 0x15, 0x15, 0x09, 0x00 },  // 85 133
+	{ 0x0E, 0x15, 0x15, 0x09, 0x00 },  // 86 134
+	{ 0x01, 0x19, 0x05, 0x03, 0x00 },  // 87 135
+	{ 0x0A, 0x15, 0x15, 0x0A, 0x00 },  // 88 136
+	{ 0x02, 0x15, 0x15, 0x0E, 0x00 },  // 89 137
+	{ 0x17, 0x08, 0x94, 0xCA, 0xB1 },  // 8A 138
+	{ 0x17, 0x68, 0x54, 0xFA, 0x41 },  // 8B 139
+	{ 0x44, 0x44, 0x5F, 0x44, 0x44 },  // 8C 140
+	{ 0x40, 0x51, 0x4A, 0x44, 0x40 },  // 8D 141
+	{ 0x40, 0x44, 0x4A, 0x51, 0x40 },  // 8E 142
+	{ 0x7F, 0x10, 0x10, 0x08, 0x1F },  // 8F 143
+	{ 0xC0, 0xC0, 0xFE, 0x04, 0x18 },  // 90 144
+	{ 0x60, 0x60, 0x3F, 0xC5, 0xFE },  // 91 145
+	{ 0x20, 0x3E, 0x7F, 0x3E, 0x20 },  // 92 146
+	{ 0x0C, 0x1E, 0x3C, 0x1E, 0x0C },  // 93 147
+	{ 0x08, 0x1C, 0x3E, 0x1C, 0x08 },  // 94 148
+	{ 0x01, 0x03, 0x7F, 0x03, 0x01 },  // 95 149
+	{ 0x07, 0x01, 0x01, 0x00, 0x00 },  // 96 150
+	{ 0x00, 0x00, 0x40, 0x40, 0x70 },  // 97 151
+	{ 0x06, 0x05, 0x00, 0x06, 0x05 },  // 98 152
+	{ 0x05, 0x03, 0x00, 0x05, 0x03 },  // 99 153
+	{ 0x00, 0x1C, 0x22, 0x41, 0x00 },  // 9A 154
+	{ 0x00, 0x41, 0x22, 0x1C, 0x00 },  // 9B 155
+	{ 0x38, 0x44, 0x48, 0x30, 0x4C },  // 9C 156
+	{ 0x28, 0x54, 0x54, 0x44, 0x20 },  // 9D 157
+	{ 0x30, 0x4A, 0x45, 0x49, 0x32 },  // 9E 158
+	{ 0x18, 0x14, 0x08, 0x14, 0x0C },  // 9F 159
+	{ 0x3E, 0x41, 0x59, 0x55, 0x1E },  // A0 160
+	{ 0x48, 0x3E, 0x49, 0x41, 0x20 },  // A1 161
+	{ 0x24, 0x2A, 0x7F, 0x2A, 0x12 },  // A2 162
+	{ 0x15, 0x16, 0x7C, 0x16, 0x15 },  // A3 163
+	{ 0x38, 0x55, 0x56, 0x54, 0x18 },  // A4 164
+	{ 0x38, 0x54, 0x56, 0x55, 0x18 },  // A5 165
+	{ 0x3C, 0x41, 0x42, 0x20, 0x7C },  // A6 166
+	{ 0x00, 0x49, 0x7A, 0x40, 0x00 },  // A7 167
+	{ 0x38, 0x45, 0x46, 0x44, 0x38 },  // A8 168
+	{ 0x0E, 0x51, 0x71, 0x11, 0x12 },  // A9 169
+	{ 0x0F, 0x05, 0x05, 0x02, 0x00 },  // AA 170
+	{ 0x3E, 0x61, 0x5D, 0x43, 0x3E },  // AB 171
+	{ 0x38, 0x64, 0x54, 0x4C, 0x38 },  // AC 172
+	{ 0x0F, 0x02, 0x01, 0x02, 0x00 },  // AD 173
+	{ 0x78, 0x14, 0x15, 0x14, 0x78 },  // AE 174
+	{ 0x20, 0x54, 0x55, 0x54, 0x78 },  // AF 175
+	{ 0x38, 0x24, 0x22, 0x24, 0x38 },  // B0 176
+	{ 0x1C, 0x22, 0x7F, 0x22, 0x10 },  // B1 177
+	{ 0x08, 0x55, 0x7F, 0x55, 0x08 },  // B2 178
+	{ 0x04, 0x04, 0x7C, 0x44, 0x04 },  // B3 179
+	{ 0x41, 0x32, 0x0C, 0x30, 0x40 },  // B4 180
+	{ 0x5C, 0x62, 0x02, 0x62, 0x5C },  // B5 181
+	{ 0x04, 0x7C, 0x04, 0x7C, 0x04 },  // B6 182
+	{ 0x07, 0x08, 0x7F, 0x08, 0x07 },  // B7 183
+	{ 0x63, 0x55, 0x49, 0x41, 0x41 },  // B8 184
+	{ 0x1C, 0x2A, 0x49, 0x2A, 0x1C },  // B9 185
+	{ 0x22, 0x2A, 0x2A, 0x2A, 0x22 },  // BA 186
+	{ 0x1C, 0x3E, 0x3E, 0x3E, 0x1C },  // BB 187
+	{ 0x7C, 0x0A, 0x09, 0x7F, 0x49 },  // BC 188
+	{ 0x64, 0x54, 0x78, 0x54, 0x58 },  // BD 189
+	{ 0x7E, 0x15, 0x25, 0x25, 0x1A },  // BE 190
+	{ 0x7C, 0x54, 0x56, 0x45, 0x00 },  // BF 191
+	{ 0x7F, 0x01, 0x01, 0x01, 0x03 },  // C0 192
+	{ 0x70, 0x0C, 0x03, 0x0C, 0x70 },  // C1 193
+	{ 0x7F, 0x01, 0x01, 0x01, 0x7F },  // C2 194
+	{ 0x06, 0x01, 0x7E, 0x01, 0x06 },  // C3 195
+	{ 0x40, 0x40, 0x40, 0x40, 0x40 },  // C4 196
+	{ 0x7C, 0x55, 0x56, 0x44, 0x00 },  // C5 197
+	{ 0x7C, 0x56, 0x55, 0x46, 0x00 },  // C6 198
+	{ 0x38, 0x56, 0x55, 0x56, 0x18 },  // C7 199
+	{ 0x0C, 0x52, 0x72, 0x12, 0x00 },  // C8 200
+	{ 0x08, 0x55, 0x56, 0x55, 0x3C },  // C9 201
+	{ 0x22, 0x25, 0x65, 0x25, 0x19 },  // CA 202
+	{ 0x24, 0x2A, 0x6A, 0x2A, 0x10 },  // CB 203
+	{ 0x00, 0x44, 0x7D, 0x44, 0x00 },  // CC 204
+	{ 0x00, 0x44, 0x7C, 0x40, 0x00 },  // CD 205
+	{ 0x04, 0x02, 0x04, 0x08, 0x04 },  // CE 206
+	{ 0x08, 0x14, 0x22, 0x14, 0x08 },  // CF 207
+	{ 0x3E, 0x3E, 0x3E, 0x3E, 0x3E },  // D0 208
+	{ 0x3E, 0x3E, 0x3E, 0x3E, 0x00 },  // D1 209
+	{ 0x3E, 0x3E, 0x3E, 0x00, 0x00 },  // D2 210
+	{ 0x3E, 0x3E, 0x00, 0x00, 0x00 },  // D3 211
+	{ 0x3E, 0x00, 0x00, 0x00, 0x00 },  // D4 212
+	{ 0x28, 0x48, 0x3E, 0x09, 0x0A },  // D5 213
+	{ 0x7F, 0x7F, 0x7F, 0x7F, 0x7F },  // D6 214
+	{ 0x7F, 0x7F, 0x7F, 0x7F, 0x00 },  // D7 215
+	{ 0x7F, 0x7F, 0x7F, 0x00, 0x00 },  // D8 216
+	{ 0x7F, 0x7F, 0x00, 0x00, 0x00 },  // D9 217
+	{ 0x7F, 0x00, 0x00, 0x00, 0x00 },  // DA 218
+	{ 0x7F, 0x05, 0x25, 0xF2, 0xA0 },  // DB 219
+	{ 0x3C, 0x24, 0x24, 0x3C, 0x00 },  // DC 220
+	{ 0x00, 0x18, 0x18, 0x00, 0x00 },  // DD 221
+	{ 0x04, 0x02, 0x7F, 0x02, 0x04 },  // DE 222
+	{ 0x08, 0x08, 0x2A, 0x1C, 0x08 },  // DF 223
+	{ 0x10, 0x20, 0x7F, 0x20, 0x10 },  // E0 224
+	{ 0x08, 0x1C, 0x2A, 0x08, 0x08 },  // E1 225
+	{ 0x78, 0x14, 0x16, 0x15, 0x78 },  // E2 226
+	{ 0x00, 0x44, 0x7E, 0x45, 0x00 },  // E3 227
+	{ 0x38, 0x44, 0x46, 0x45, 0x38 },  // E4 228
+	{ 0x3C, 0x40, 0x42, 0x41, 0x3C },  // E5 229
+	{ 0x04, 0x08, 0x72, 0x09, 0x04 },  // E6 230
+	{ 0x20, 0x54, 0x56, 0x55, 0x78 },  // E7 231
+	{ 0x00, 0x48, 0x7A, 0x41, 0x00 },  // E8 232
+	{ 0x30, 0x48, 0x4C, 0x4A, 0x30 },  // E9 233
+	{ 0x3C, 0x40, 0x42, 0x21, 0x7C },  // EA 234
+	{ 0x0C, 0x50, 0x52, 0x51, 0x3C },  // EB 235
+	{ 0x38, 0x46, 0x45, 0x46, 0x38 },  // EC 236
+	{ 0x30, 0x4C, 0x4A, 0x4C, 0x30 },  // ED 237
+	{ 0x3C, 0x40, 0x41, 0x40, 0x3C },  // EE 238
+	{ 0x3C, 0x40, 0x41, 0x20, 0x7C },  // EF 239
+	{ 0x38, 0x45, 0x46, 0x45, 0x28 },  // F0 240
+	{ 0x7C, 0x55, 0x56, 0x45, 0x44 },  // F1 241
+	{ 0x7C, 0x15, 0x16, 0x35, 0x48 },  // F2 242
+	{ 0x48, 0x55, 0x56, 0x55, 0x24 },  // F3 243
+	{ 0x64, 0x55, 0x56, 0x55, 0x4C },  // F4 244
+	{ 0x30, 0x4A, 0x4C, 0x4A, 0x00 },  // F5 245
+	{ 0x38, 0x55, 0x56, 0x55, 0x18 },  // F6 246
+	{ 0x7C, 0x09, 0x06, 0x05, 0x08 },  // F7 247
+	{ 0x48, 0x55, 0x56, 0x55, 0x20 },  // F8 248
+	{ 0x44, 0x65, 0x56, 0x4D, 0x44 },  // F9 249
+	{ 0x00, 0x7F, 0x41, 0x41, 0x00 },  // FA 250
+	{ 0x02, 0x04, 0x08, 0x10, 0x20 },  // FB 251
+	{ 0x00, 0x41, 0x41, 0x7F, 0x00 },  // FC 252
+	{ 0x00, 0x08, 0x36, 0x41, 0x00 },  // FD 253
+	{ 0x00, 0x00, 0x77, 0x00, 0x00 },  // FE 254
+	{ 0x00, 0x41, 0x36, 0x08, 0x00 }   // FF 255
+};
+
+// Hitachi HD44780A00 32 to 127
+static constexpr uint8_t font_A00[96][5] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00 },  // 20  32
+	{ 0x00, 0x00, 0x4F, 0x00, 0x00 },  // 21  33  !
+	{ 0x00, 0x07, 0x00, 0x07, 0x00 },  // 22  34  "
+	{ 0x14, 0x7F, 0x14, 0x7F, 0x14 },  // 23  35  #
+	{ 0x24, 0x2A, 0x7F, 0x2A, 0x12 },  // 24  36  $
+	{ 0x23, 0x13, 0x08, 0x64, 0x62 },  // 25  37  %
+	{ 0x36, 0x49, 0x55, 0x22, 0x50 },  // 26  38  &
+	{ 0x00, 0x05, 0x03, 0x00, 0x00 },  // 27  39  '
+	{ 0x00, 0x1C, 0x22, 0x41, 0x00 },  // 28  40  (
+	{ 0x00, 0x41, 0x22, 0x1C, 0x00 },  // 29  41  )
+	{ 0x14, 0x08, 0x3E, 0x08, 0x14 },  // 2A  42  *
+	{ 0x08, 0x08, 0x3E, 0x08, 0x08 },  // 2B  43  +
+	{ 0x00, 0x50, 0x30, 0x00, 0x00 },  // 2C  44  ,
+	{ 0x08, 0x08, 0x08, 0x08, 0x08 },  // 2D  45  -
+	{ 0x00, 0x60, 0x60, 0x00, 0x00 },  // 2E  46  .
+	{ 0x20, 0x10, 0x08, 0x04, 0x02 },  // 2F  47  /
+	{ 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 30  48  0
+	{ 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 31  49  1
+	{ 0x42, 0x61, 0x51, 0x49, 0x46 },  // 32  50  2
+	{ 0x21, 0x41, 0x45, 0x4B, 0x31 },  // 33  51  3
+	{ 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 34  52  4
+	{ 0x27, 0x45, 0x45, 0x45, 0x39 },  // 35  53  5
+	{ 0x3C, 0x4A, 0x49, 0x49, 0x30 },  // 36  54  6
+	{ 0x03, 0x01, 0x71, 0x09, 0x07 },  // 37  55  7
+	{ 0x36, 0x49, 0x49, 0x49, 0x36 },  // 38  56  8
+	{ 0x06, 0x49, 0x49, 0x29, 0x1E },  // 39  57  9
+	{ 0x00, 0x36, 0x36, 0x00, 0x00 },  // 3A  58  :
+	{ 0x00, 0x56, 0x36, 0x00, 0x00 },  // 3B  59  ;
+	{ 0x08, 0x14, 0x22, 0x41, 0x00 },  // 3C  60  <
+	{ 0x14, 0x14, 0x14, 0x14, 0x14 },  // 3D  61  =
+	{ 0x00, 0x41, 0x22, 0x14, 0x08 },  // 3E  62  >
+	{ 0x02, 0x01, 0x51, 0x09, 0x06 },  // 3F  63  ?
+	{ 0x32, 0x49, 0x79, 0x41, 0x3E },  // 40  64  @
+	{ 0x7E, 0x11, 0x11, 0x11, 0x7E },  // 41  65  A
+	{ 0x7F, 0x49, 0x49, 0x49, 0x36 },  // 42  66  B
+	{ 0x3E, 0x41, 0x41, 0x41, 0x22 },  // 43  67  C
+	{ 0x7F, 0x41, 0x41, 0x22, 0x1C },  // 44  68  D
+	{ 0x7F, 0x49, 0x49, 0x49, 0x41 },  // 45  69  E
+	{ 0x7F, 0x09, 0x09, 0x09, 0x01 },  // 46  70  F
+	{ 0x3E, 0x41, 0x49, 0x49, 0x7A },  // 47  71  G
+	{ 0x7F, 0x08, 0x08, 0x08, 0x7F },  // 48  72  H
+	{ 0x00, 0x41, 0x7F, 0x41, 0x00 },  // 49  73  I
+	{ 0x20, 0x40, 0x41, 0x3F, 0x01 },  // 4A  74  J
+	{ 0x7F, 0x08, 0x14, 0x22, 0x41 },  // 4B  75  K
+	{ 0x7F, 0x40, 0x40, 0x40, 0x40 },  // 4C  76  L
+	{ 0x7F, 0x02, 0x0C, 0x02, 0x7F },  // 4D  77  M
+	{ 0x7F, 0x04, 0x08, 0x10, 0x7F },  // 4E  78  N
+	{ 0x3E, 0x41, 0x41, 0x41, 0x3E },  // 4F  79  O
+	{ 0x7F, 0x09, 0x09, 0x09, 0x06 },  // 50  80  P
+	{ 0x3E, 0x41, 0x51, 0x21, 0x5E },  // 51  81  Q
+	{ 0x7F, 0x09, 0x19, 0x29, 0x46 },  // 52  82  R
+	{ 0x46, 0x49, 0x49, 0x49, 0x31 },  // 53  83  S
+	{ 0x01, 0x01, 0x7F, 0x01, 0x01 },  // 54  84  T
+	{ 0x3F, 0x40, 0x40, 0x40, 0x3F },  // 55  85  U
+	{ 0x1F, 0x20, 0x40, 0x20, 0x1F },  // 56  86  V
+	{ 0x3F, 0x40, 0x38, 0x40, 0x3F },  // 57  87  W
+	{ 0x63, 0x14, 0x08, 0x14, 0x63 },  // 58  88  X
+	{ 0x07, 0x08, 0x70, 0x08, 0x07 },  // 59  89  Y
+	{ 0x61, 0x51, 0x49, 0x45, 0x43 },  // 5A  90  Z
+	{ 0x7F, 0x41, 0x41, 0x00, 0x00 },  // 5B  91  [
+	{ 0x15, 0x16, 0x7C, 0x16, 0x15 },  // 5C  92  '\'
+	{ 0x00, 0x41, 0x41, 0x7F, 0x00 },  // 5D  93  ]
+	{ 0x04, 0x02, 0x01, 0x02, 0x04 },  // 5E  94  ^
+	{ 0x40, 0x40, 0x40, 0x40, 0x40 },  // 5F  95  _
+	{ 0x00, 0x01, 0x02, 0x04, 0x00 },  // 60  96  `
+	{ 0x20, 0x54, 0x54, 0x54, 0x78 },  // 61  97  a
+	{ 0x7F, 0x48, 0x44, 0x44, 0x38 },  // 62  98  b
+	{ 0x38, 0x44, 0x44, 0x44, 0x20 },  // 63  99  c
+	{ 0x38, 0x44, 0x44, 0x48, 0x7F },  // 64 100  d
+	{ 0x38, 0x54, 0x54, 0x54, 0x18 },  // 65 101  e
+	{ 0x08, 0x7E, 0x09, 0x01, 0x02 },  // 66 102  f
+	{ 0x0C, 0x52, 0x52, 0x52, 0x3E },  // 67 103  g
+	{ 0x7F, 0x08, 0x04, 0x04, 0x78 },  // 68 104  h
+	{ 0x00, 0x44, 0x7D, 0x40, 0x00 },  // 69 105  i
+	{ 0x20, 0x40, 0x44, 0x3D, 0x00 },  // 6A 106  j
+	{ 0x7F, 0x10, 0x28, 0x44, 0x00 },  // 6B 107  k
+	{ 0x00, 0x41, 0x7F, 0x40, 0x00 },  // 6C 108  l
+	{ 0x7C, 0x04, 0x18, 0x04, 0x78 },  // 6D 109  m
+	{ 0x7C, 0x08, 0x04, 0x04, 0x78 },  // 6E 110  n
+	{ 0x38, 0x44, 0x44, 0x44, 0x38 },  // 6F 111  o
+	{ 0x7C, 0x14, 0x14, 0x14, 0x08 },  // 70 112  p
+	{ 0x08, 0x14, 0x14, 0x18, 0x7C },  // 71 113  q
+	{ 0x7C, 0x08, 0x04, 0x04, 0x08 },  // 72 114  r
+	{ 0x48, 0x54, 0x54, 0x54, 0x20 },  // 73 115  s
+	{ 0x04, 0x3F, 0x44, 0x40, 0x20 },  // 74 116  t
+	{ 0x3C, 0x40, 0x40, 0x20, 0x7C },  // 75 117  u
+	{ 0x1C, 0x20, 0x40, 0x20, 0x1C },  // 76 118  v
+	{ 0x3C, 0x40, 0x38, 0x40, 0x3C },  // 77 119  w
+	{ 0x44, 0x28, 0x10, 0x28, 0x44 },  // 78 120  x
+	{ 0x0C, 0x50, 0x50, 0x50, 0x3C },  // 79 121  y
+	{ 0x44, 0x64, 0x54, 0x4C, 0x44 },  // 7A 122  z
+	{ 0x00, 0x08, 0x36, 0x41, 0x00 },  // 7B 123  {
+	{ 0x00, 0x00, 0x7F, 0x00, 0x00 },  // 7C 124  |
+	{ 0x00, 0x41, 0x36, 0x08, 0x00 },  // 7D 125  }
+	{ 0x08, 0x08, 0x2A, 0x1C, 0x08 },  // 7E 126  ~
+	{ 0x08, 0x1C, 0x2A, 0x08, 0x08 }   // 7F 127
+};
+
+// Hitachi HD44780A00 160 to 255
+static constexpr uint8_t font_A00h[96][5] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00 },  // A0 160
+	{ 0x70, 0x50, 0x70, 0x00, 0x00 },  // A1 161
+	{ 0x00, 0x00, 0x0F, 0x01, 0x01 },  // A2 162
+	{ 0x40, 0x40, 0x78, 0x00, 0x00 },  // A3 163
+	{ 0x10, 0x20, 0x40, 0x00, 0x00 },  // A4 164
+	{ 0x00, 0x18, 0x18, 0x00, 0x00 },  // A5 165
+	{ 0x0A, 0x0A, 0x4A, 0x2A, 0x1E },  // A6 166
+	{ 0x04, 0x44, 0x34, 0x14, 0x0C },  // A7 167
+	{ 0x20, 0x10, 0x78, 0x04, 0x00 },  // A8 168
+	{ 0x18, 0x08, 0x4C, 0x48, 0x38 },  // A9 169
+	{ 0x44, 0x44, 0x7C, 0x44, 0x44 },  // AA 170
+	{ 0x48, 0x28, 0x18, 0x7C, 0x08 },  // AB 171
+	{ 0x08, 0x7C, 0x08, 0x28, 0x18 },  // AC 172
+	{ 0x40, 0x48, 0x48, 0x78, 0x40 },  // AD 173
+	{ 0x54, 0x54, 0x54, 0x7C, 0x00 },  // AE 174
+	{ 0x18, 0x00, 0x58, 0x40, 0x38 },  // AF 175
+	{ 0x08, 0x08, 0x08, 0x08, 0x08 },  // B0 176
+	{ 0x01, 0x41, 0x3D, 0x09, 0x07 },  // B1 177
+	{ 0x10, 0x08, 0x7C, 0x02, 0x01 },  // B2 178
+	{ 0x0E, 0x02, 0x43, 0x22, 0x1E },  // B3 179
+	{ 0x42, 0x42, 0x7E, 0x42, 0x42 },  // B4 180
+	{ 0x22, 0x12, 0x0A, 0x7F, 0x02 },  // B5 181
+	{ 0x42, 0x3F, 0x02, 0x42, 0x3E },  // B6 182
+	{ 0x0A, 0x0A, 0x7F, 0x0A, 0x0A },  // B7 183
+	{ 0x08, 0x46, 0x42, 0x22, 0x1E },  // B8 184
+	{ 0x04, 0x03, 0x42, 0x3E, 0x02 },  // B9 185
+	{ 0x42, 0x42, 0x42, 0x42, 0x7E },  // BA 186
+	{ 0x02, 0x4F, 0x22, 0x1F, 0x02 },  // BB 187
+	{ 0x4A, 0x4A, 0x40, 0x20, 0x1C },  // BC 188
+	{ 0x42, 0x22, 0x12, 0x2A, 0x46 },  // BD 189
+	{ 0x02, 0x3F, 0x42, 0x4A, 0x46 },  // BE 190
+	{ 0x06, 0x48, 0x40, 0x20, 0x1E },  // BF 191
+	{ 0x08, 0x46, 0x4A, 0x32, 0x1E },  // C0 192
+	{ 0x0A, 0x4A, 0x3E, 0x09, 0x08 },  // C1 193
+	{ 0x0E, 0x00, 0x4E, 0x20, 0x1E },  // C2 194
+	{ 0x04, 0x45, 0x3D, 0x05, 0x04 },  // C3 195
+	{ 0x00, 0x7F, 0x08, 0x10, 0x00 },  // C4 196
+	{ 0x44, 0x24, 0x1F, 0x04, 0x04 },  // C5 197
+	{ 0x40, 0x42, 0x42, 0x42, 0x40 },  // C6 198
+	{ 0x42, 0x2A, 0x12, 0x2A, 0x06 },  // C7 199
+	{ 0x22, 0x12, 0x7B, 0x16, 0x22 },  // C8 200
+	{ 0x00, 0x40, 0x20, 0x1F, 0x00 },  // C9 201
+	{ 0x78, 0x00, 0x02, 0x04, 0x78 },  // CA 202
+	{ 0x3F, 0x44, 0x44, 0x44, 0x44 },  // CB 203
+	{ 0x02, 0x42, 0x42, 0x22, 0x1E },  // CC 204
+	{ 0x04, 0x02, 0x04, 0x08, 0x30 },  // CD 205
+	{ 0x32, 0x02, 0x7F, 0x02, 0x32 },  // CE 206
+	{ 0x02, 0x12, 0x22, 0x52, 0x0E },  // CF 207
+	{ 0x00, 0x2A, 0x2A, 0x2A, 0x40 },  // D0 208
+	{ 0x38, 0x24, 0x22, 0x20, 0x70 },  // D1 209
+	{ 0x40, 0x28, 0x10, 0x28, 0x06 },  // D2 210
+	{ 0x0A, 0x3E, 0x4A, 0x4A, 0x4A },  // D3 211
+	{ 0x04, 0x7F, 0x04, 0x14, 0x0C },  // D4 212
+	{ 0x40, 0x42, 0x42, 0x7E, 0x40 },  // D5 213
+	{ 0x4A, 0x4A, 0x4A, 0x4A, 0x7E },  // D6 214
+	{ 0x04, 0x05, 0x45, 0x25, 0x1C },  // D7 215
+	{ 0x0F, 0x40, 0x20, 0x1F, 0x00 },  // D8 216
+	{ 0x7C, 0x00, 0x7E, 0x40, 0x30 },  // D9 217
+	{ 0x7E, 0x40, 0x20, 0x10, 0x08 },  // DA 218
+	{ 0x7E, 0x42, 0x42, 0x42, 0x7E },  // DB 219
+	{ 0x0E, 0x02, 0x42, 0x22, 0x1E },  // DC 220
+	{ 0x42, 0x42, 0x40, 0x20, 0x18 },  // DD 221
+	{ 0x02, 0x04, 0x01, 0x02, 0x00 },  // DE 222
+	{ 0x07, 0x05, 0x07, 0x00, 0x00 },  // DF 223
+	{ 0x38, 0x44, 0x48, 0x30, 0x4C },  // E0 224
+	{ 0x20, 0x55, 0x54, 0x55, 0x78 },  // E1 225
+	{ 0xF8, 0x54, 0x54, 0x54, 0x28 },  // E2 226
+	{ 0x28, 0x54, 0x54, 0x44, 0x20 },  // E3 227
+	{ 0xFC, 0x40, 0x40, 0x20, 0x7C },  // E4 228
+	{ 0x38, 0x44, 0x4C, 0x54, 0x24 },  // E5 229
+	{ 0xF0, 0x48, 0x44, 0x44, 0x38 },  // E6 230
+	{ 0x38, 0x44, 0x44, 0x44, 0xFC },  // E7 231
+	{ 0x20, 0x40, 0x3C, 0x04, 0x04 },  // E8 232
+	{ 0x04, 0x04, 0x00, 0x0E, 0x00 },  // E9 233
+	{ 0x00, 0x00, 0x04, 0xFD, 0x00 },  // EA 234
+	{ 0x0A, 0x04, 0x0A, 0x00, 0x00 },  // EB 235
+	{ 0x18, 0x24, 0x7E, 0x24, 0x10 },  // EC 236
+	{ 0x14, 0x7F, 0x54, 0x40, 0x40 },  // ED 237
+	{ 0x7C, 0x09, 0x05, 0x05, 0x78 },  // EE 238
+	{ 0x38, 0x45, 0x44, 0x45, 0x38 },  // EF 239
+	{ 0xFC, 0x48, 0x44, 0x44, 0x38 },  // F0 240
+	{ 0x38, 0x44, 0x44, 0x48, 0xFC },  // F1 241
+	{ 0x3C, 0x4A, 0x4A, 0x4A, 0x3C },  // F2 242
+	{ 0x30, 0x28, 0x10, 0x28, 0x18 },  // F3 243
+	{ 0x58, 0x64, 0x04, 0x64, 0x58 },  // F4 244
+	{ 0x7C, 0x81, 0x80, 0x41, 0xFC },  // F5 245
+	{ 0x63, 0x55, 0x49, 0x41, 0x41 },  // F6 246
+	{ 0x44, 0x3C, 0x04, 0x7C, 0x44 },  // F7 247
+	{ 0x45, 0x29, 0x11, 0x29, 0x45 },  // F8 248
+	{ 0x3C, 0x40, 0x40, 0x40, 0xFC },  // F9 249
+	{ 0x14, 0x14, 0x7C, 0x14, 0x12 },  // FA 250
+	{ 0x44, 0x3C, 0x14, 0x14, 0x74 },  // FB 251
+	{ 0x7C, 0x14, 0x1C, 0x14, 0x7C },  // FC 252
+	{ 0x08, 0x08, 0x2A, 0x08, 0x08 },  // FD 253
+	{ 0x00, 0x00, 0x00, 0x00, 0x00 },  // FE 254
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },  // FF 255
+};
+
+// Hitachi HD44780A02
+static constexpr uint8_t font_A02[240][5] = {
+	{ 0x00, 0xFE, 0x7C, 0x38, 0x10 },  // 10  16
+	{ 0x10, 0x38, 0x7C, 0xFE, 0x00 },  // 11  17
+	{ 0x0C, 0x0A, 0x00, 0x0C, 0x0A },  // 12  18
+	{ 0x0A, 0x06, 0x00, 0x0A, 0x06 },  // 13  19
+	{ 0x88, 0xCC, 0xEE, 0xCC, 0x88 },  // 14  20
+	{ 0x22, 0x66, 0xEE, 0x66, 0x22 },  // 15  21
+	{ 0x38, 0x7C, 0x7C, 0x7C, 0x38 },  // 16  22
+	{ 0x20, 0x70, 0xA8, 0x20, 0x3E },  // 17  23
+	{ 0x08, 0x04, 0xFE, 0x04, 0x08 },  // 18  24
+	{ 0x20, 0x40, 0xFE, 0x40, 0x20 },  // 19  25
+	{ 0x10, 0x10, 0x54, 0x38, 0x10 },  // 1A  26
+	{ 0x10, 0x38, 0x54, 0x10, 0x10 },  // 1B  27
+	{ 0x80, 0x88, 0x94, 0xA2, 0x80 },  // 1C  28
+	{ 0x80, 0xA2, 0x94, 0x88, 0x80 },  // 1D  29
+	{ 0x40, 0x70, 0x7C, 0x70, 0x40 },  // 1E  30
+	{ 0x04, 0x1C, 0x7C, 0x1C, 0x04 },  // 1F  31
+	{ 0x00, 0x00, 0x00, 0x00, 0x00 },  // 20  32
+	{ 0x00, 0x00, 0x9E, 0x00, 0x00 },  // 21  33  !
+	{ 0x00, 0x0E, 0x00, 0x0E, 0x00 },  // 22  34  "
+	{ 0x28, 0xFE, 0x28, 0xFE, 0x28 },  // 23  35  #
+	{ 0x48, 0x54, 0xFE, 0x54, 0x24 },  // 24  36  $
+	{ 0x46, 0x26, 0x10, 0xC8, 0xC4 },  // 25  37  %
+	{ 0x6C, 0x92, 0xAA, 0x44, 0xA0 },  // 26  38  &
+	{ 0x00, 0x0A, 0x06, 0x00, 0x00 },  // 27  39  '
+	{ 0x00, 0x38, 0x44, 0x82, 0x00 },  // 28  40  (
+	{ 0x00, 0x82, 0x44, 0x38, 0x00 },  // 29  41  )
+	{ 0x28, 0x10, 0x7C, 0x10, 0x28 },  // 2A  42  *
+	{ 0x10, 0x10, 0x7C, 0x10, 0x10 },  // 2B  43  +
+	{ 0x00, 0xA0, 0x60, 0x00, 0x00 },  // 2C  44  ,
+	{ 0x10, 0x10, 0x10, 0x10, 0x10 },  // 2D  45  -
+	{ 0x00, 0xC0, 0xC0, 0x00, 0x00 },  // 2E  46  .
+	{ 0x40, 0x20, 0x10, 0x08, 0x04 },  // 2F  47  /
+	{ 0x7C, 0xA2, 0x92, 0x8A, 0x7C },  // 30  48  0
+	{ 0x00, 0x84, 0xFE, 0x80, 0x00 },  // 31  49  1
+	{ 0x84, 0xC2, 0xA2, 0x92, 0x8C },  // 32  50  2
+	{ 0x42, 0x82, 0x8A, 0x96, 0x62 },  // 33  51  3
+	{ 0x30, 0x28, 0x24, 0xFE, 0x20 },  // 34  52  4
+	{ 0x4E, 0x8A, 0x8A, 0x8A, 0x72 },  // 35  53  5
+	{ 0x78, 0x94, 0x92, 0x92, 0x60 },  // 36  54  6
+	{ 0x06, 0x02, 0xE2, 0x12, 0x0E },  // 37  55  7
+	{ 0x6C, 0x92, 0x92, 0x92, 0x6C },  // 38  56  8
+	{ 0x0C, 0x92, 0x92, 0x52, 0x3C },  // 39  57  9
+	{ 0x00, 0x6C, 0x6C, 0x00, 0x00 },  // 3A  58  :
+	{ 0x00, 0xAC, 0x6C, 0x00, 0x00 },  // 3B  59  ;
+	{ 0x10, 0x28, 0x44, 0x82, 0x00 },  // 3C  60  <
+	{ 0x28, 0x28, 0x28, 0x28, 0x28 },  // 3D  61  =
+	{ 0x00, 0x82, 0x44, 0x28, 0x10 },  // 3E  62  >
+	{ 0x04, 0x02, 0xA2, 0x12, 0x0C },  // 3F  63  ?
+	{ 0x64, 0x92, 0xF2, 0x82, 0x7C },  // 40  64  @
+	{ 0xF8, 0x24, 0x22, 0x24, 0xF8 },  // 41  65  A
+	{ 0xFE, 0x92, 0x92, 0x92, 0x6C },  // 42  66  B
+	{ 0x7C, 0x82, 0x82, 0x82, 0x44 },  // 43  67  C
+	{ 0xFE, 0x82, 0x82, 0x44, 0x38 },  // 44  68  D
+	{ 0xFE, 0x92, 0x92, 0x92, 0x82 },  // 45  69  E
+	{ 0xFE, 0x12, 0x12, 0x12, 0x02 },  // 46  70  F
+	{ 0x7C, 0x82, 0x92, 0x92, 0xF4 },  // 47  71  G
+	{ 0xFE, 0x10, 0x10, 0x10, 0xFE },  // 48  72  H
+	{ 0x00, 0x82, 0xFE, 0x82, 0x00 },  // 49  73  I
+	{ 0x40, 0x80, 0x82, 0x7E, 0x02 },  // 4A  74  J
+	{ 0xFE, 0x10, 0x28, 0x44, 0x82 },  // 4B  75  K
+	{ 0xFE, 0x80, 0x80, 0x80, 0x80 },  // 4C  76  L
+	{ 0xFE, 0x04, 0x18, 0x04, 0xFE },  // 4D  77  M
+	{ 0xFE, 0x08, 0x10, 0x20, 0xFE },  // 4E  78  N
+	{ 0x7C, 0x82, 0x82, 0x82, 0x7C },  // 4F  79  O
+	{ 0xFE, 0x12, 0x12, 0x12, 0x0C },  // 50  80  P
+	{ 0x7C, 0x82, 0xA2, 0x42, 0xBC },  // 51  81  Q
+	{ 0xFE, 0x12, 0x32, 0x52, 0x8C },  // 52  82  R
+	{ 0x4C, 0x92, 0x92, 0x92, 0x64 },  // 53  83  S
+	{ 0x02, 0x02, 0xFE, 0x02, 0x02 },  // 54  84  T
+	{ 0x7E, 0x80, 0x80, 0x80, 0x7E },  // 55  85  U
+	{ 0x3E, 0x40, 0x80, 0x40, 0x3E },  // 56  86  V
+	{ 0x7E, 0x80, 0x70, 0x80, 0x7E },  // 57  87  W
+	{ 0xC6, 0x28, 0x10, 0x28, 0xC6 },  // 58  88  X
+	{ 0x0E, 0x10, 0xE0, 0x10, 0x0E },  // 59  89  Y
+	{ 0xC2, 0xA2, 0x92, 0x8A, 0x86 },  // 5A  90  Z
+	{ 0x00, 0xFE, 0x82, 0x82, 0x00 },  // 5B  91  [
+	{ 0x04, 0x08, 0x10, 0x20, 0x40 },  // 5C  92  '\'
+	{ 0x00, 0x82, 0x82, 0xFE, 0x00 },  // 5D  93  ]
+	{ 0x08, 0x04, 0x02, 0x04, 0x08 },  // 5E  94  ^
+	{ 0x80, 0x80, 0x80, 0x80, 0x80 },  // 5F  95  _
+	{ 0x00, 0x02, 0x04, 0x08, 0x00 },  // 60  96  `
+	{ 0x40, 0xA8, 0xA8, 0xA8, 0xF0 },  // 61  97  a
+	{ 0xFE, 0x90, 0x88, 0x88, 0x70 },  // 62  98  b
+	{ 0x70, 0x88, 0x88, 0x88, 0x40 },  // 63  99  c
+	{ 0x70, 0x88, 0x88, 0x90, 0xFE },  // 64 100  d
+	{ 0x70, 0xA8, 0xA8, 0xA8, 0x30 },  // 65 101  e
+	{ 0x10, 0xFC, 0x12, 0x02, 0x04 },  // 66 102  f
+	{ 0x10, 0xA8, 0xA8, 0xA8, 0x78 },  // 67 103  g
+	{ 0xFE, 0x10, 0x08, 0x08, 0xF0 },  // 68 104  h
+	{ 0x00, 0x90, 0xFA, 0x80, 0x00 },  // 69 105  i
+	{ 0x40, 0x80, 0x88, 0x7A, 0x00 },  // 6A 106  j
+	{ 0xFE, 0x20, 0x50, 0x88, 0x00 },  // 6B 107  k
+	{ 0x00, 0x82, 0xFE, 0x80, 0x00 },  // 6C 108  l
+	{ 0xF8, 0x08, 0xF0, 0x08, 0xF0 },  // 6D 109  m
+	{ 0xF8, 0x10, 0x08, 0x08, 0xF0 },  // 6E 110  n
+	{ 0x70, 0x88, 0x88, 0x88, 0x70 },  // 6F 111  o
+	{ 0xF8, 0x28, 0x28, 0x28, 0x10 },  // 70 112  p
+	{ 0x10, 0x28, 0x28, 0x30, 0xF8 },  // 71 113  q
+	{ 0xF8, 0x10, 0x08, 0x08, 0x10 },  // 72 114  r
+	{ 0x90, 0xA8, 0xA8, 0xA8, 0x40 },  // 73 115  s
+	{ 0x08, 0x7E, 0x88, 0x80, 0x40 },  // 74 116  t
+	{ 0x78, 0x80, 0x80, 0x40, 0xF8 },  // 75 117  u
+	{ 0x38, 0x40, 0x80, 0x40, 0x38 },  // 76 118  v
+	{ 0x78, 0x80, 0x60, 0x80, 0x78 },  // 77 119  w
+	{ 0x88, 0x50, 0x20, 0x50, 0x88 },  // 78 120  x
+	{ 0x18, 0xA0, 0xA0, 0xA0, 0x78 },  // 79 121  y
+	{ 0x88, 0xC8, 0xA8, 0x98, 0x88 },  // 7A 122  z
+	{ 0x00, 0x10, 0x6C, 0x82, 0x00 },  // 7B 123  {
+	{ 0x00, 0x00, 0xFE, 0x00, 0x00 },  // 7C 124  |
+	{ 0x00, 0x82, 0x6C, 0x10, 0x00 },  // 7D 125  }
+	{ 0x20, 0x10, 0x10, 0x20, 0x10 },  // 7E 126  ~
+	{ 0x78, 0x44, 0x42, 0x44, 0x78 },  // 7F 127
+	{ 0xFE, 0x92, 0x92, 0x92, 0x66 },  // 80 128
+	{ 0xF0, 0x29, 0x27, 0x21, 0xFF },  // 81 129
+	{ 0xEE, 0x10, 0xFE, 0x10, 0xEE },  // 82 130
+	{ 0x82, 0x82, 0x92, 0x92, 0x6C },  // 83 131
+	{ 0xFE, 0x20, 0x10, 0x08, 0xFE },  // 84 132
+	{ 0xFC, 0x41, 0x22, 0x11, 0xFC },  // 85 133
+	{ 0x40, 0x82, 0x7E, 0x02, 0xFE },  // 86 134
+	{ 0xFE, 0x02, 0x02, 0x02, 0xFE },  // 87 135
+	{ 0x8E, 0x50, 0x20, 0x10, 0x0E },  // 88 136
+	{ 0x7E, 0x40, 0x40, 0x40, 0xFE },  // 89 137
+	{ 0x0E, 0x10, 0x10, 0x10, 0xFE },  // 8A 138
+	{ 0xFC, 0x80, 0xFC, 0x80, 0xFC },  // 8B 139
+	{ 0x7E, 0x40, 0x7E, 0x40, 0xFE },  // 8C 140
+	{ 0x02, 0xFE, 0x90, 0x90, 0x60 },  // 8D 141
+	{ 0xFE, 0x90, 0x60, 0x00, 0xFE },  // 8E 142
+	{ 0x44, 0x92, 0x8A, 0x92, 0x7C },  // 8F 143
+	{ 0x70, 0x88, 0x90, 0x60, 0x98 },  // 90 144
+	{ 0xC0, 0xC0, 0xFE, 0x04, 0x18 },  // 91 145
+	{ 0xFE, 0x02, 0x02, 0x02, 0x06 },  // 92 146
+	{ 0x88, 0x78, 0x08, 0xF8, 0x88 },  // 93 147
+	{ 0xC6, 0xAA, 0x92, 0x82, 0x82 },  // 94 148
+	{ 0x70, 0x88, 0x88, 0x78, 0x08 },  // 95 149
+	{ 0x60, 0x60, 0x3F, 0xC5, 0xFE },  // 96 150
+	{ 0x10, 0x08, 0x78, 0x88, 0x04 },  // 97 151
+	{ 0x20, 0x3C, 0x7E, 0x3C, 0x20 },  // 98 152
+	{ 0x7C, 0x92, 0x92, 0x92, 0x7C },  // 99 153
+	{ 0xB8, 0xC4, 0x04, 0xC4, 0xB8 },  // 9A 154
+	{ 0x60, 0x94, 0x8A, 0x92, 0x64 },  // 9B 155
+	{ 0x30, 0x28, 0x10, 0x28, 0x18 },  // 9C 156
+	{ 0x38, 0x7C, 0xF8, 0x7C, 0x38 },  // 9D 157
+	{ 0x50, 0xA8, 0xA8, 0x88, 0x40 },  // 9E 158
+	{ 0xFC, 0x02, 0x02, 0x02, 0xFC },  // 9F 159
+	{ 0xFE, 0xFE, 0x00, 0xFE, 0xFE },  // A0 160
+	{ 0x00, 0x00, 0xF2, 0x00, 0x00 },  // A1 161
+	{ 0x38, 0x44, 0xFE, 0x44, 0x20 },  // A2 162
+	{ 0x90, 0x7C, 0x92, 0x82, 0x40 },  // A3 163
+	{ 0x44, 0x38, 0x28, 0x38, 0x44 },  // A4 164
+	{ 0x2A, 0x2C, 0xF8, 0x2C, 0x2A },  // A5 165
+	{ 0x00, 0x00, 0xEE, 0x00, 0x00 },  // A6 166
+	{ 0x40, 0x94, 0xAA, 0x52, 0x04 },  // A7 167
+	{ 0x50, 0x90, 0x7C, 0x12, 0x14 },  // A8 168
+	{ 0xFE, 0x82, 0xBA, 0x92, 0xFE },  // A9 169
+	{ 0x90, 0xAA, 0xAA, 0xAA, 0xBC },  // AA 170
+	{ 0x10, 0x28, 0x54, 0x28, 0x44 },  // AB 171
+	{ 0xFE, 0x10, 0x7C, 0x82, 0x7C },  // AC 172
+	{ 0x8C, 0x52, 0x32, 0x12, 0xFE },  // AD 173
+	{ 0xFE, 0x82, 0xCA, 0xA2, 0xFE },  // AE 174
+	{ 0x00, 0x0C, 0x0A, 0x00, 0x00 },  // AF 175
+	{ 0x0E, 0x11, 0x11, 0x0E, 0x00 },  // B0 176
+	{ 0x88, 0x88, 0xBE, 0x88, 0x88 },  // B1 177
+	{ 0x12, 0x19, 0x15, 0x12, 0x00 },  // B2 178
+	{ 0x11, 0x15, 0x15, 0x0A, 0x00 },  // B3 179
+	{ 0x7F, 0x05, 0x25, 0xF2, 0xA0 },  // B4 180
+	{ 0xFE, 0x20, 0x20, 0x10, 0x3E },  // B5 181
+	{ 0x0C, 0x12, 0x12, 0xFE, 0xFE },  // B6 182
+	{ 0x00, 0x30, 0x30, 0x00, 0x00 },  // B7 183
+	{ 0x70, 0x88, 0x60, 0x88, 0x70 },  // B8 184
+	{ 0x12, 0x1F, 0x10, 0x00, 0x00 },  // B9 185
+	{ 0x9C, 0xA2, 0xA2, 0xA2, 0x9C },  // BA 186
+	{ 0x44, 0x28, 0x54, 0x28, 0x10 },  // BB 187
+	{ 0x17, 0x68, 0x54, 0xFA, 0x41 },  // BC 188
+	{ 0x17, 0x08, 0x94, 0xCA, 0xB1 },  // BD 189
+	{ 0x15, 0x1F, 0x60, 0x50, 0xF8 },  // BE 190
+	{ 0x60, 0x90, 0x8A, 0x80, 0x40 },  // BF 191
+	{ 0xF0, 0x29, 0x26, 0x28, 0xF0 },  // C0 192
+	{ 0xF0, 0x28, 0x26, 0x29, 0xF0 },  // C1 193
+	{ 0xF0, 0x2A, 0x29, 0x2A, 0xF0 },  // C2 194
+	{ 0xF2, 0x29, 0x29, 0x2A, 0xF1 },  // C3 195
+	{ 0xF0, 0x29, 0x24, 0x29, 0xF0 },  // C4 196
+	{ 0xF0, 0x2A, 0x2D, 0x2A, 0xF0 },  // C5 197
+	{ 0xF8, 0x24, 0xFE, 0x92, 0x92 },  // C6 198
+	{ 0x1E, 0x21, 0xA1, 0xE1, 0x12 },  // C7 199
+	{ 0xF8, 0xA9, 0xAA, 0xA8, 0x88 },  // C8 200
+	{ 0xF8, 0xA8, 0xAA, 0xA9, 0x88 },  // C9 201
+	{ 0xF8, 0xAA, 0xA9, 0xAA, 0x88 },  // CA 202
+	{ 0xF8, 0xAA, 0xA8, 0xAA, 0x88 },  // CB 203
+	{ 0x00, 0x89, 0xFA, 0x88, 0x00 },  // CC 204
+	{ 0x00, 0x88, 0xFA, 0x89, 0x00 },  // CD 205
+	{ 0x00, 0x8A, 0xF9, 0x8A, 0x00 },  // CE 206
+	{ 0x00, 0x8A, 0xF8, 0x8A, 0x00 },  // CF 207
+	{ 0x10, 0xFE, 0x92, 0x82, 0x7C },  // D0 208
+	{ 0xFA, 0x11, 0x21, 0x42, 0xF9 },  // D1 209
+	{ 0x78, 0x85, 0x86, 0x84, 0x78 },  // D2 210
+	{ 0x78, 0x84, 0x86, 0x85, 0x78 },  // D3 211
+	{ 0x70, 0x8A, 0x89, 0x8A, 0x70 },  // D4 212
+	{ 0x72, 0x89, 0x89, 0x8A, 0x71 },  // D5 213
+	{ 0x78, 0x85, 0x84, 0x85, 0x78 },  // D6 214
+	{ 0x44, 0x28, 0x10, 0x28, 0x44 },  // D7 215
+	{ 0x10, 0xAA, 0xFE, 0xAA, 0x10 },  // D8 216
+	{ 0x7C, 0x81, 0x82, 0x80, 0x7C },  // D9 217
+	{ 0x7C, 0x80, 0x82, 0x81, 0x7C },  // DA 218
+	{ 0x78, 0x82, 0x81, 0x82, 0x78 },  // DB 219
+	{ 0x7C, 0x81, 0x80, 0x81, 0x7C },  // DC 220
+	{ 0x04, 0x08, 0xF2, 0x09, 0x04 },  // DD 221
+	{ 0x81, 0xFF, 0xA4, 0x24, 0x18 },  // DE 222
+	{ 0x80, 0x7C, 0x92, 0x92, 0x6C },  // DF 223
+	{ 0x40, 0xA9, 0xAA, 0xA8, 0xF0 },  // E0 224
+	{ 0x40, 0xA8, 0xAA, 0xA9, 0xF0 },  // E1 225
+	{ 0x40, 0xAA, 0xA9, 0xAA, 0xF0 },  // E2 226
+	{ 0x42, 0xA9, 0xA9, 0xAA, 0xF1 },  // E3 227
+	{ 0x40, 0xAA, 0xA8, 0xAA, 0xF0 },  // E4 228
+	{ 0x40, 0xAA, 0xAD, 0xAA, 0xF0 },  // E5 229
+	{ 0x64, 0x94, 0x78, 0x94, 0x58 },  // E6 230
+	{ 0x18, 0xA4, 0xE4, 0x24, 0x10 },  // E7 231
+	{ 0x70, 0xA9, 0xAA, 0xA8, 0x30 },  // E8 232
+	{ 0x70, 0xA8, 0xAA, 0xA9, 0x30 },  // E9 233
+	{ 0x70, 0xAA, 0xA9, 0xAA, 0x30 },  // EA 234
+	{ 0x70, 0xAA, 0xA8, 0xAA, 0x30 },  // EB 235
+	{ 0x00, 0x91, 0xFA, 0x80, 0x00 },  // EC 236
+	{ 0x00, 0x90, 0xFA, 0x81, 0x00 },  // ED 237
+	{ 0x00, 0x92, 0xF9, 0x82, 0x00 },  // EE 238
+	{ 0x00, 0x92, 0xF8, 0x82, 0x00 },  // EF 239
+	{ 0x4A, 0xA4, 0xAA, 0xB0, 0x60 },  // F0 240
+	{ 0xFA, 0x11, 0x09, 0x0A, 0xF1 },  // F1 241
+	{ 0x70, 0x89, 0x8A, 0x88, 0x70 },  // F2 242
+	{ 0x70, 0x88, 0x8A, 0x89, 0x70 },  // F3 243
+	{ 0x60, 0x94, 0x92, 0x94, 0x60 },  // F4 244
+	{ 0x64, 0x92, 0x92, 0x94, 0x62 },  // F5 245
+	{ 0x70, 0x8A, 0x88, 0x8A, 0x70 },  // F6 246
+	{ 0x10, 0x10, 0x54, 0x10, 0x10 },  // F7 247
+	{ 0x10, 0xA8, 0x7C, 0x2A, 0x10 },  // F8 248
+	{ 0x78, 0x81, 0x82, 0x40, 0xF8 },  // F9 249
+	{ 0x78, 0x80, 0x82, 0x41, 0xF8 },  // FA 250
+	{ 0x78, 0x82, 0x81, 0x42, 0xF8 },  // FB 251
+	{ 0x78, 0x82, 0x80, 0x42, 0xF8 },  // FC 252
+	{ 0x18, 0xA0, 0xA4, 0xA2, 0x78 },  // FD 253
+	{ 0x00, 0x82, 0xFE, 0xA8, 0x10 },  // FE 254
+	{ 0x18, 0xA2, 0xA0, 0xA2, 0x78 },  // FF 255
+};
+
+//=============================================================================
+// Glyph Metrics
+//=============================================================================
+
+// Proportional text needs the inked columns of every glyph. They are measured
+// here from the column data while compiling, so the tables cannot drift from
+// the fonts and cost nothing at startup.
+
+template <int... I> struct GlyphIndices {};
+template <int N, int... I> struct MakeGlyphIndices : MakeGlyphIndices<N - 1, N - 1, I...> {};
+template <int... I> struct MakeGlyphIndices<0, I...> { typedef GlyphIndices<I...> type; };
+
+template <int N> struct GlyphMetricsTable {
+  GlyphMetrics glyphs[N];
+};
+
+// C++11 constexpr functions are single expressions, hence the recursion
+constexpr int firstInkedColumn(const uint8_t* glyph, int column, int width, uint8_t rowMask) {
+  return column >= width ? width : (glyph[column] & rowMask) ? column : firstInkedColumn(glyph, column + 1, width, rowMask);
+}
+
+constexpr int lastInkedColumn(const uint8_t* glyph, int column, uint8_t rowMask) {
+  return column < 0 ? -1 : (glyph[column] & rowMask) ? column : lastInkedColumn(glyph, column - 1, rowMask);
+}
+
+constexpr GlyphMetrics measureGlyph(const uint8_t* glyph, int width, uint8_t rowMask) {
+  return firstInkedColumn(glyph, 0, width, rowMask) >= width
+    ? GlyphMetrics{ 0, 0 }
+    : GlyphMetrics{ (uint8_t)firstInkedColumn(glyph, 0, width, rowMask),
+                    (uint8_t)(lastInkedColumn(glyph, width - 1, rowMask) - firstInkedColumn(glyph, 0, width, rowMask) + 1) };
+}
+
+template <int N, int W, int... I>
+constexpr GlyphMetricsTable<N> measureFont(const uint8_t (&data)[N][W], uint8_t rowMask, GlyphIndices<I...>) {
+  return GlyphMetricsTable<N>{ { measureGlyph(data[I], W, rowMask)... } };
+}
+
+// Only the rows that are drawn count as ink
+#define FONT_ROW_MASK(height, rowShift) (uint8_t)(((1 << (height)) - 1) << (rowShift))
+
+static constexpr GlyphMetricsTable<240> metrics_mo = measureFont(font_mo, FONT_ROW_MASK(7, 0), MakeGlyphIndices<240>::type());
+static constexpr GlyphMetricsTable<240> metrics_cf = measureFont(font_cf, FONT_ROW_MASK(7, 0), MakeGlyphIndices<240>::type());
+static constexpr GlyphMetricsTable<96> metrics_A00 = measureFont(font_A00, FONT_ROW_MASK(7, 0), MakeGlyphIndices<96>::type());
+static constexpr GlyphMetricsTable<96> metrics_A00h = measureFont(font_A00h, FONT_ROW_MASK(7, 0), MakeGlyphIndices<96>::type());
+static constexpr GlyphMetricsTable<240> metrics_A02 = measureFont(font_A02, FONT_ROW_MASK(7, 1), MakeGlyphIndices<240>::type());
+
+static_assert(metrics_mo.glyphs['i' - 16].width == 3 && metrics_mo.glyphs['.' - 16].width == 2,
+              "glyph metrics must be measured from the column data");
+static_assert(metrics_mo.glyphs[' ' - 16].width == 0, "a blank glyph has no inked columns");
+
+// Row-major copies of the same glyphs, for code that draws a row at a time
+template <int N> struct GlyphRowsTable {
+  GlyphRows glyphs[N];
+};
+
+constexpr uint8_t rowBits(const uint8_t* glyph, int column, int width, int bit) {
+  return column >= width ? 0 : (uint8_t)((((glyph[column] >> bit) & 1) << column) | rowBits(glyph, column + 1, width, bit));
+}
+
+template <int W, int... R>
+constexpr GlyphRows transposeGlyph(const uint8_t (&glyph)[W], int rowShift, GlyphIndices<R...>) {
+  return GlyphRows{ { rowBits(glyph, 0, W, rowShift + R)... } };
+}
+
+template <int N, int W, int... I>
+constexpr GlyphRowsTable<N> transposeFont(const uint8_t (&data)[N][W], int rowShift, GlyphIndices<I...>) {
+  return GlyphRowsTable<N>{ { transposeGlyph(data[I], rowShift, MakeGlyphIndices<FONT_CHAR_HEIGHT>::type())... } };
+}
+
+static constexpr GlyphRowsTable<240> rows_mo = transposeFont(font_mo, 0, MakeGlyphIndices<240>::type());
+static constexpr GlyphRowsTable<240> rows_cf = transposeFont(font_cf, 0, MakeGlyphIndices<240>::type());
+static constexpr GlyphRowsTable<96> rows_A00 = transposeFont(font_A00, 0, MakeGlyphIndices<96>::type());
+static constexpr GlyphRowsTable<96> rows_A00h = transposeFont(font_A00h, 0, MakeGlyphIndices<96>::type());
+static constexpr GlyphRowsTable<240> rows_A02 = transposeFont(font_A02, 1, MakeGlyphIndices<240>::type());
+
+// 'T' in the Matrix Orbital font: full top row, then the middle column
+static_assert(rows_mo.glyphs['T' - 16].row[0] == 0x1F && rows_mo.glyphs['T' - 16].row[6] == 0x04,
+              "row-major glyphs must be transposed from the column data");
+
+//=============================================================================
+// Registry
+//=============================================================================
+
+// Indexed by FontId
+static const Font FONTS[NUM_FONTS] = {
+  { "Matrix Orbital",   &font_mo[0][0],    metrics_mo.glyphs,   rows_mo.glyphs,    16, 240, 5, 7, 0 },
+  { "Crystalfontz",     &font_cf[0][0],    metrics_cf.glyphs,   rows_cf.glyphs,    16, 240, 5, 7, 0 },
+  { "HD44780 A00",      &font_A00[0][0],   metrics_A00.glyphs,  rows_A00.glyphs,   32,  96, 5, 7, 0 },
+  { "HD44780 A00 High", &font_A00h[0][0],  metrics_A00h.glyphs, rows_A00h.glyphs, 160,  96, 5, 7, 0 },
+  { "HD44780 A02",      &font_A02[0][0],   metrics_A02.glyphs,  rows_A02.glyphs,   16, 240, 5, 7, 1 }  // Row 0 is bit 1
+};
+
+const Font& getFont(FontId id) {
+  int index = static_cast<int>(id);
+  return FONTS[index >= 0 && index < NUM_FONTS ? index : 0];
+}
+
+int Font::textWidth(const char* text, int length, int gap) const {
+  int width = 0;
+  for (int i = 0; i < length; i++) {
+    width += advance(text[i], gap);
+  }
+  return width;
+}
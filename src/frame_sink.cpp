@@ -0,0 +1,167 @@
+#include "frame_sink.h"
+#include "topology.h"
+#include "performance_monitor.h"
+#include "trace_buffer.h"
+
+FrameOutput g_frameOutput;
+
+//=============================================================================
+// FastLedSink Implementation
+//=============================================================================
+
+template <uint8_t PIN>
+static void addOutput(CRGB* slice, int count) {
+  FastLED.addLeds<WS2812Controller800Khz, PIN, GRB>(slice, count);
+}
+
+FastLedSink::FastLedSink(CRGB* frame) : frame(frame), shownBrightness(0), shown(false) {
+  for (int output = 0; output < g_topology.getOutputCount(); output++) {
+    CRGB* slice = frame + g_topology.getOutputStart(output);
+    int count = g_topology.getOutputLength(output);
+    switch (output) {
+      case 0: addOutput<LED_OUTPUT_PIN_0>(slice, count); break;
+      case 1: addOutput<LED_OUTPUT_PIN_1>(slice, count); break;
+      case 2: addOutput<LED_OUTPUT_PIN_2>(slice, count); break;
+      case 3: addOutput<LED_OUTPUT_PIN_3>(slice, count); break;
+      case 4: addOutput<LED_OUTPUT_PIN_4>(slice, count); break;
+      case 5: addOutput<LED_OUTPUT_PIN_5>(slice, count); break;
+      case 6: addOutput<LED_OUTPUT_PIN_6>(slice, count); break;
+      case 7: addOutput<LED_OUTPUT_PIN_7>(slice, count); break;
+    }
+  }
+}
+
+bool FastLedSink::write(const CRGB* frame, int count, const FrameInfo& info) {
+  // The controllers send from the buffer they were set up on, which is this frame
+  if (FRAME_SINK_SKIP_UNCHANGED && shown && !info.changed && FastLED.getBrightness() == shownBrightness) {
+    return false;
+  }
+  FastLED.show();
+  shownBrightness = FastLED.getBrightness();
+  shown = true;
+  return true;
+}
+
+// Each output sends the part of its slice that lies within the first count LEDs
+void FastLedSink::setLength(int count) {
+  for (int output = 0; output < g_topology.getOutputCount(); output++) {
+    int start = g_topology.getOutputStart(output);
+    int length = count - start;
+    if (length > g_topology.getOutputLength(output)) length = g_topology.getOutputLength(output);
+    FastLED[output].setLeds(frame + start, length > 0 ? length : 0);
+  }
+  shown = false;
+}
+
+//=============================================================================
+// FrameRecorderSink Implementation
+//=============================================================================
+
+FrameRecorderSink::FrameRecorderSink(FILE* file) : file(file) {
+  row = new uint8_t[g_topology.getWidth() * 3];
+}
+
+FrameRecorderSink::~FrameRecorderSink() {
+  delete[] row;
+}
+
+bool FrameRecorderSink::write(const CRGB* frame, int count, const FrameInfo& info) {
+  if (!file) return false;
+  fprintf(file, "P6\n%d %d\n255\n", g_topology.getWidth(), g_topology.getHeight());
+  for (int y = 0; y < g_topology.getHeight(); y++) {
+    for (int x = 0; x < g_topology.getWidth(); x++) {
+      const CRGB& pixel = frame[g_topology.index(x, y)];
+      row[x * 3] = pixel.r;
+      row[x * 3 + 1] = pixel.g;
+      row[x * 3 + 2] = pixel.b;
+    }
+    fwrite(row, 3, g_topology.getWidth(), file);
+  }
+  fflush(file);
+  return true;
+}
+
+//=============================================================================
+// FrameStreamSink Implementation
+//=============================================================================
+
+FrameStreamSink::FrameStreamSink(uint16_t pixelCount, uint8_t displayId)
+  : encoder(pixelCount, displayId), sendFailures(0) {
+  capacity = encoder.maxPacketSize();
+  packet = new uint8_t[capacity];
+}
+
+FrameStreamSink::~FrameStreamSink() {
+  delete[] packet;
+}
+
+bool FrameStreamSink::write(const CRGB* frame, int count, const FrameInfo& info) {
+  // CRGB is three bytes in r, g, b order, the stream's pixel layout
+  size_t length = encoder.encode(reinterpret_cast<const uint8_t*>(frame), packet, capacity);
+  if (length == 0 || !sendPacket(packet, length)) {
+    sendFailures++;
+    encoder.requestKeyframe(); // Receivers drop deltas after a lost packet anyway
+    return false;
+  }
+  return true;
+}
+
+#if defined(ESP32)
+#include <WiFi.h>
+
+bool UdpFrameSink::sendPacket(const uint8_t* packet, size_t length) {
+  if (WiFi.status() != WL_CONNECTED) return false;
+  if (!udp.beginPacket(IPAddress(255, 255, 255, 255), port)) return false;
+  udp.write(packet, length);
+  return udp.endPacket();
+}
+#endif
+
+//=============================================================================
+// FrameOutput Implementation
+//=============================================================================
+
+void FrameOutput::begin(int ledCount) {
+  count = ledCount;
+  frame = new CRGB[count]();
+}
+
+bool FrameOutput::addSink(FrameSink* sink) {
+  if (sinkCount >= FRAME_SINK_MAX) return false;
+  sinks[sinkCount++] = sink;
+  return true;
+}
+
+bool FrameOutput::stage(const CRGB* source) {
+  size_t bytes = sizeof(CRGB) * count;
+  bool changed = forced || memcmp(frame, source, bytes) != 0;
+  if (changed) memcpy(frame, source, bytes);
+  forced = false;
+  return changed;
+}
+
+void FrameOutput::send(unsigned long sequence, bool changed) {
+  FrameInfo info = { sequence, changed };
+  unsigned long outputStart = micros();
+  bool written = false;
+  for (int i = 0; i < sinkCount; i++) {
+    FrameSink* sink = sinks[i];
+    unsigned long start = micros();
+    if (!sink->write(frame, count, info)) continue;
+    unsigned long end = micros();
+    written = true;
+    if (g_traceBuffer) g_traceBuffer->record(sink->getName(), start, end);
+  }
+  // Frames no sink wrote cost next to nothing and would swamp the histogram
+  if (written) g_perfMonitor->recordShowTime((uint32_t)(micros() - outputStart));
+}
+
+void FrameOutput::write(const CRGB* source, unsigned long sequence) {
+  send(sequence, stage(source));
+}
+
+void FrameOutput::setLength(int count) {
+  for (int i = 0; i < sinkCount; i++) {
+    sinks[i]->setLength(count);
+  }
+}
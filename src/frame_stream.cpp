@@ -0,0 +1,236 @@
+#include "frame_stream.h"
+#include <string.h>
+#include <stdlib.h>
+
+static inline void putU16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static inline uint16_t getU16(const uint8_t* in) {
+  return in[0] | (in[1] << 8);
+}
+
+static inline size_t keyframePayloadSize(uint16_t pixelCount) {
+  size_t spans = (pixelCount + FRAME_STREAM_MAX_SPAN_LENGTH - 1) / FRAME_STREAM_MAX_SPAN_LENGTH;
+  return spans * FRAME_STREAM_SPAN_HEADER_SIZE + (size_t)pixelCount * 3;
+}
+
+//=============================================================================
+// FrameStreamEncoder Implementation
+//=============================================================================
+
+FrameStreamEncoder::FrameStreamEncoder(uint16_t pixelCount, uint8_t displayId)
+  : pixelCount(pixelCount), displayId(displayId), sequence(0),
+    keyframeInterval(FRAME_STREAM_KEYFRAME_INTERVAL), framesSinceKeyframe(0), forceKeyframe(true) {
+  previous = (uint8_t*)calloc(pixelCount, 3);
+}
+
+FrameStreamEncoder::~FrameStreamEncoder() {
+  free(previous);
+}
+
+size_t FrameStreamEncoder::maxPacketSize() const {
+  return FRAME_STREAM_HEADER_SIZE + keyframePayloadSize(pixelCount) + 1;
+}
+
+size_t FrameStreamEncoder::writeSpan(const uint8_t* rgb, uint16_t start, uint16_t length, uint8_t* out, size_t pos, size_t capacity) {
+  // Split long runs so each span length fits in one byte
+  while (length > 0) {
+    uint16_t chunk = length > FRAME_STREAM_MAX_SPAN_LENGTH ? FRAME_STREAM_MAX_SPAN_LENGTH : length;
+    size_t needed = FRAME_STREAM_SPAN_HEADER_SIZE + chunk * 3;
+    if (pos + needed + 1 > capacity) return 0; // Leave room for the checksum
+
+    putU16(out + pos, start);
+    out[pos + 2] = (uint8_t)chunk;
+    memcpy(out + pos + FRAME_STREAM_SPAN_HEADER_SIZE, rgb + start * 3, chunk * 3);
+    pos += needed;
+    start += chunk;
+    length -= chunk;
+  }
+  return pos;
+}
+
+size_t FrameStreamEncoder::encode(const uint8_t* rgb, uint8_t* out, size_t capacity) {
+  if (!previous || !rgb || capacity < FRAME_STREAM_HEADER_SIZE + 1) return 0;
+
+  bool keyframe = forceKeyframe || (keyframeInterval > 0 && framesSinceKeyframe >= keyframeInterval);
+  size_t pos = FRAME_STREAM_HEADER_SIZE;
+
+  if (keyframe) {
+    pos = writeSpan(rgb, 0, pixelCount, out, pos, capacity);
+    if (pos == 0) return 0;
+  } else {
+    // Collect runs of changed pixels. A gap of one unchanged pixel costs the same
+    // three bytes as a new span header, so short gaps are folded into the run.
+    int runStart = -1;
+    int lastChanged = -1;
+    for (int i = 0; i < pixelCount; i++) {
+      if (memcmp(rgb + i * 3, previous + i * 3, 3) == 0) continue;
+
+      if (runStart >= 0 && i - lastChanged > 2) {
+        pos = writeSpan(rgb, runStart, lastChanged - runStart + 1, out, pos, capacity);
+        if (pos == 0) return 0;
+        runStart = -1;
+      }
+      if (runStart < 0) runStart = i;
+      lastChanged = i;
+    }
+    if (runStart >= 0) {
+      pos = writeSpan(rgb, runStart, lastChanged - runStart + 1, out, pos, capacity);
+      if (pos == 0) return 0;
+    }
+  }
+
+  uint16_t payloadLength = pos - FRAME_STREAM_HEADER_SIZE;
+  out[0] = FRAME_STREAM_MAGIC_0;
+  out[1] = FRAME_STREAM_MAGIC_1;
+  out[2] = FRAME_STREAM_VERSION;
+  out[3] = keyframe ? FRAME_STREAM_FLAG_KEYFRAME : 0;
+  out[4] = displayId;
+  putU16(out + 5, sequence);
+  putU16(out + 7, pixelCount);
+  putU16(out + 9, payloadLength);
+
+  uint8_t checksum = 0;
+  for (size_t i = 0; i < pos; i++) checksum ^= out[i];
+  out[pos++] = checksum;
+
+  memcpy(previous, rgb, (size_t)pixelCount * 3);
+  sequence++;
+  if (keyframe) {
+    forceKeyframe = false;
+    framesSinceKeyframe = 0;
+  } else {
+    framesSinceKeyframe++;
+  }
+  return pos;
+}
+
+//=============================================================================
+// FrameStreamDecoder Implementation
+//=============================================================================
+
+FrameStreamDecoder::FrameStreamDecoder(uint8_t* rgb, uint16_t pixelCount, uint8_t displayId)
+  : rgb(rgb), pixelCount(pixelCount), displayId(displayId),
+    framesApplied(0), framesDropped(0), checksumErrors(0) {
+  payloadCapacity = keyframePayloadSize(pixelCount);
+  payload = (uint8_t*)malloc(payloadCapacity);
+  reset();
+}
+
+FrameStreamDecoder::~FrameStreamDecoder() {
+  free(payload);
+}
+
+void FrameStreamDecoder::reset() {
+  state = WAIT_MAGIC_0;
+  headerPos = 0;
+  payloadLength = 0;
+  payloadPos = 0;
+  checksum = 0;
+  lastSequence = 0;
+  synced = false;
+}
+
+bool FrameStreamDecoder::feed(uint8_t byte) {
+  switch (state) {
+    case WAIT_MAGIC_0:
+      if (byte == FRAME_STREAM_MAGIC_0) {
+        header[0] = byte;
+        state = WAIT_MAGIC_1;
+      }
+      return false;
+
+    case WAIT_MAGIC_1:
+      if (byte == FRAME_STREAM_MAGIC_1) {
+        header[1] = byte;
+        headerPos = 2;
+        state = READ_HEADER;
+      } else {
+        state = byte == FRAME_STREAM_MAGIC_0 ? WAIT_MAGIC_1 : WAIT_MAGIC_0;
+      }
+      return false;
+
+    case READ_HEADER:
+      header[headerPos++] = byte;
+      if (headerPos < FRAME_STREAM_HEADER_SIZE) return false;
+
+      payloadLength = getU16(header + 9);
+      if (header[2] != FRAME_STREAM_VERSION || payloadLength > payloadCapacity || !payload) {
+        // Not a packet we can hold - resynchronize on the next magic
+        framesDropped++;
+        state = WAIT_MAGIC_0;
+        return false;
+      }
+      checksum = 0;
+      for (int i = 0; i < FRAME_STREAM_HEADER_SIZE; i++) checksum ^= header[i];
+      payloadPos = 0;
+      state = payloadLength > 0 ? READ_PAYLOAD : READ_CHECKSUM;
+      return false;
+
+    case READ_PAYLOAD:
+      payload[payloadPos++] = byte;
+      checksum ^= byte;
+      if (payloadPos >= payloadLength) state = READ_CHECKSUM;
+      return false;
+
+    case READ_CHECKSUM:
+      state = WAIT_MAGIC_0;
+      if (byte != checksum) {
+        checksumErrors++;
+        synced = false;
+        return false;
+      }
+      return finishPacket();
+  }
+  return false;
+}
+
+bool FrameStreamDecoder::finishPacket() {
+  uint8_t targetId = header[4];
+  if (targetId != displayId && targetId != FRAME_STREAM_BROADCAST_ID) return false;
+
+  bool keyframe = header[3] & FRAME_STREAM_FLAG_KEYFRAME;
+  uint16_t sequence = getU16(header + 5);
+
+  if (getU16(header + 7) != pixelCount) {
+    framesDropped++;
+    return false;
+  }
+
+  // Deltas only make sense on top of the frame they were encoded against
+  if (!keyframe && (!synced || sequence != (uint16_t)(lastSequence + 1))) {
+    synced = false;
+    framesDropped++;
+    return false;
+  }
+
+  // Check every span before applying any, so a bad one cannot leave half a frame
+  uint32_t pos = 0;
+  while (pos < payloadLength) {
+    if (pos + FRAME_STREAM_SPAN_HEADER_SIZE > payloadLength) break;
+    uint16_t start = getU16(payload + pos);
+    uint8_t length = payload[pos + 2];
+    if (start + length > pixelCount) break;
+    pos += FRAME_STREAM_SPAN_HEADER_SIZE + length * 3; // Past the end if the span overruns
+  }
+  if (pos != payloadLength) {
+    synced = false;
+    framesDropped++;
+    return false;
+  }
+
+  for (pos = 0; pos < payloadLength; ) {
+    uint16_t start = getU16(payload + pos);
+    uint8_t length = payload[pos + 2];
+    pos += FRAME_STREAM_SPAN_HEADER_SIZE;
+    memcpy(rgb + start * 3, payload + pos, length * 3);
+    pos += length * 3;
+  }
+
+  lastSequence = sequence;
+  synced = true;
+  framesApplied++;
+  return true;
+}
@@ -0,0 +1,155 @@
+#include "golden_frames.h"
+#include "golden_frame_table.h"
+#include "task_runner.h"
+
+// Every implemented transition in every color mode, then the space animation
+static const int GOLDEN_COLOR_MODES = 4;
+
+GoldenFrameCheck::GoldenFrameCheck(DisplayController& controller) : controller(controller), missing(0) {
+}
+
+int GoldenFrameCheck::caseCount() const {
+  return TransitionFactory::getImplementedCount() * GOLDEN_COLOR_MODES + 1;
+}
+
+Scenario GoldenFrameCheck::caseScenario(int index) const {
+  Scenario scenario = { "", DisplayMode::TEXT_CONTENT, TransitionType::SMOOTH_SCROLL, ColorMode::WORD_BASED, 0, nullptr, 0 };
+  if (index == caseCount() - 1) {
+    scenario.mode = DisplayMode::SPACE_ANIMATION;
+  } else {
+    scenario.transition = static_cast<TransitionType>(index / GOLDEN_COLOR_MODES);
+    scenario.colorMode = static_cast<ColorMode>(index % GOLDEN_COLOR_MODES);
+  }
+  return scenario;
+}
+
+void GoldenFrameCheck::caseName(int index, char* name, size_t length) {
+  Scenario scenario = caseScenario(index);
+  if (scenario.mode == DisplayMode::SPACE_ANIMATION) {
+    snprintf(name, length, "Space Animation");
+    return;
+  }
+  // Color mode names come from the content manager, which only names its current mode
+  ContentManager& content = controller.getContentManager();
+  ColorMode current = content.getColorMode();
+  content.setColorMode(scenario.colorMode);
+  snprintf(name, length, "%s/%s", TransitionFactory::getTransitionName(scenario.transition), content.getColorModeName());
+  content.setColorMode(current);
+}
+
+const GoldenCase* GoldenFrameCheck::findGolden(const char* name) const {
+  if (strcmp(GOLDEN_TABLE_PLATFORM, GOLDEN_FRAMES_PLATFORM) != 0) return nullptr;
+  for (const GoldenCase* golden = GOLDEN_CASES; golden->name; golden++) {
+    if (strcmp(golden->name, name) == 0) return golden;
+  }
+  return nullptr;
+}
+
+void GoldenFrameCheck::dumpFrame(const char* name, int frame) {
+  // Plain PPM in display coordinates, one text row per LED row
+  Serial.printf("=== FRAME DUMP BEGIN %s frame %d ===\n", name, frame);
+  Serial.printf("P3\n%d %d\n255\n", g_topology.getWidth(), g_topology.getHeight());
+  for (int y = 0; y < g_topology.getHeight(); y++) {
+    for (int x = 0; x < g_topology.getWidth(); x++) {
+      const CRGB& pixel = leds[g_topology.index(x, y)];
+      Serial.printf("%d %d %d ", pixel.r, pixel.g, pixel.b);
+    }
+    Serial.printf("\n");
+  }
+  Serial.println("=== FRAME DUMP END ===");
+}
+
+bool GoldenFrameCheck::verify() {
+  ScenarioReplay replay(controller);
+  bool passed = true;
+  char name[48];
+
+  missing = 0;
+  if (!replay.open()) return false;
+  Serial.println("=== GOLDEN FRAME CHECK BEGIN ===");
+  for (int index = 0; index < caseCount(); index++) {
+    caseName(index, name, sizeof(name));
+    const GoldenCase* golden = findGolden(name);
+    Scenario scenario = caseScenario(index);
+    scenario.name = name;
+
+    int frame = 0;
+    int divergent = -1;
+    replay.start(scenario);
+    while (frame < GOLDEN_FRAMES_PER_CASE && replay.elapsed() < GOLDEN_MAX_MILLIS) {
+      if (!replay.frame()) continue;
+      uint32_t hash = ScenarioReplay::hashFrame(FRAME_HASH_SEED);
+      if (golden && (frame >= golden->count || golden->hashes[frame] != hash)) {
+        divergent = frame;
+        dumpFrame(name, frame);
+        break;
+      }
+      frame++;
+    }
+    replay.stop();
+
+    if (!golden) {
+      missing++;
+      Serial.printf("{\"case\":\"%s\",\"frames\":%d,\"status\":\"no_golden\"}\n", name, frame);
+    } else if (divergent >= 0) {
+      passed = false;
+      Serial.printf("{\"case\":\"%s\",\"frames\":%d,\"status\":\"mismatch\",\"first_divergent_frame\":%d}\n",
+                    name, frame, divergent);
+    } else {
+      Serial.printf("{\"case\":\"%s\",\"frames\":%d,\"status\":\"match\"}\n", name, frame);
+    }
+    Task::sleep(1); // Let the io task drain the log between cases
+  }
+  Serial.println("=== GOLDEN FRAME CHECK END ===");
+  replay.close();
+
+  if (missing > 0) {
+    Serial.printf("Golden frames: %d of %d cases have no %s hashes - record them with '%c'\n",
+                  missing, caseCount(), GOLDEN_FRAMES_PLATFORM, GOLDEN_FRAMES_RECORD_COMMAND);
+  }
+  return passed;
+}
+
+void GoldenFrameCheck::record() {
+  ScenarioReplay replay(controller);
+  char name[48];
+
+  if (!replay.open()) return;
+  Serial.println("=== GOLDEN FRAMES BEGIN ===");
+  Serial.printf("// Golden frame hashes, checked by GoldenFrameCheck (see golden_frames.h).\n"
+                "// Replace with the output of '%c' on serial from a diagnostics build on the %s:\n"
+                "//   python3 tools/golden_frames.py update capture.txt\n"
+                "#pragma once\n\n"
+                "#define GOLDEN_TABLE_PLATFORM \"%s\"\n\n",
+                GOLDEN_FRAMES_RECORD_COMMAND, GOLDEN_FRAMES_PLATFORM, GOLDEN_FRAMES_PLATFORM);
+
+  int frames[NUM_TRANSITION_TYPES * GOLDEN_COLOR_MODES + 1];
+  for (int index = 0; index < caseCount(); index++) {
+    Scenario scenario = caseScenario(index);
+    caseName(index, name, sizeof(name));
+    scenario.name = name;
+
+    Serial.printf("static const uint32_t GOLDEN_%d[] = {\n", index);
+    int frame = 0;
+    replay.start(scenario);
+    while (frame < GOLDEN_FRAMES_PER_CASE && replay.elapsed() < GOLDEN_MAX_MILLIS) {
+      if (!replay.frame()) continue;
+      uint32_t hash = ScenarioReplay::hashFrame(FRAME_HASH_SEED);
+      Serial.printf("%s0x%08lx,%s", frame % 8 == 0 ? "  " : "", (unsigned long)hash, frame % 8 == 7 ? "\n" : " ");
+      frame++;
+    }
+    replay.stop();
+    Serial.printf("%s};\n\n", frame % 8 == 0 ? "" : "\n");
+    frames[index] = frame;
+    Task::sleep(1);
+  }
+
+  Serial.println("static const GoldenCase GOLDEN_CASES[] = {");
+  for (int index = 0; index < caseCount(); index++) {
+    caseName(index, name, sizeof(name));
+    Serial.printf("  { \"%s\", GOLDEN_%d, %d },\n", name, index, frames[index]);
+  }
+  Serial.println("  { nullptr, nullptr, 0 }\n};");
+  Serial.println("=== GOLDEN FRAMES END ===");
+  replay.close();
+}
@@ -0,0 +1,67 @@
+#include "idle_sleep.h"
+
+#if defined(ESP32)
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/semphr.h>
+  #include <esp_sleep.h>
+  #include <driver/gpio.h>
+#endif
+
+// Global idle sleeper used by the single-context frame loop
+IdleSleeper g_idleSleeper;
+
+#if defined(ESP32)
+// Given by the button interrupt, taken by a sleeping loop
+static SemaphoreHandle_t wakeSemaphore = nullptr;
+
+static void IRAM_ATTR onWakePin() {
+  BaseType_t higherPriorityWoken = pdFALSE;
+  xSemaphoreGiveFromISR(wakeSemaphore, &higherPriorityWoken);
+  if (higherPriorityWoken) {
+    portYIELD_FROM_ISR();
+  }
+}
+#endif
+
+IdleSleeper::IdleSleeper() : wakePin(0), started(false), lightSleeps(0) {
+}
+
+void IdleSleeper::begin(uint8_t pin) {
+  wakePin = pin;
+#if defined(ESP32)
+  wakeSemaphore = xSemaphoreCreateBinary();
+  attachInterrupt(digitalPinToInterrupt(wakePin), onWakePin, CHANGE);
+#endif
+  started = true;
+}
+
+unsigned long IdleSleeper::timeUntil(unsigned long deadline) {
+  long wait = (int32_t)(deadline - millis());
+  if (wait <= 0) return 0;
+  return wait > MAX_IDLE_SLEEP ? MAX_IDLE_SLEEP : wait;
+}
+
+unsigned long IdleSleeper::sleepUntil(unsigned long deadline, bool allowLightSleep) {
+  unsigned long wait = timeUntil(deadline);
+  if (wait == 0) return 0;
+
+  unsigned long start = micros();
+#if defined(ESP32)
+  if (ENABLE_LIGHT_SLEEP && allowLightSleep && wait >= LIGHT_SLEEP_MIN_TIME && digitalRead(wakePin) == HIGH) {
+    // The CPU halts until the timer or a press (button pulls the pin low)
+    esp_sleep_enable_timer_wakeup(wait * 1000ULL);
+    gpio_wakeup_enable((gpio_num_t)wakePin, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_light_sleep_start();
+    lightSleeps++;
+  } else if (started) {
+    // Blocking lets the idle task halt the CPU until a tick or a button edge
+    xSemaphoreTake(wakeSemaphore, pdMS_TO_TICKS(wait));
+  } else {
+    delay(wait);
+  }
+#else
+  delay(wait);
+#endif
+  return (uint32_t)(micros() - start);
+}
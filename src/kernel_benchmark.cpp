@@ -0,0 +1,296 @@
+#include "kernel_benchmark.h"
+#include "content_manager.h"
+#include "transition_effects.h"
+#include "space_animation.h"
+#include "task_runner.h"
+#include "segment_renderer.h"
+#include "render_kernels.h"
+#include <memory>
+#include <new>
+
+// Results are folded in here so the compiler cannot drop a kernel's work
+static volatile uint32_t sink = 0;
+
+static const int COLOR_MODES = 4;
+
+struct ColorContext {
+  ContentManager* content;
+  const String* text;
+  int scrollRange;  // Scroll positions that keep a full display of text
+};
+
+struct SlideContext {
+  const Font* font;
+  const char* line;  // Repeated across the text row
+  int length;
+};
+
+struct KernelSetContext {
+  const RenderKernels* kernels;
+  SlideContext slide;
+};
+
+struct TransitionContext {
+  TransitionEffect* transition;
+  ContentManager* content;
+};
+
+//=============================================================================
+// Kernels
+//=============================================================================
+
+static void setLedKernel(void* context, unsigned long i) {
+  set_led(i % g_topology.getWidth(), (i / g_topology.getWidth()) % g_topology.getHeight(), CRGB(i, i >> 8, i >> 16));
+}
+
+static void writeCharacterKernel(void* context, unsigned long i) {
+  write_character(getFont(DEFAULT_FONT), 'A' + i % 26, i % g_topology.getColumns(), CRGB(0, 128, 255), 0);
+}
+
+// One line of a vertical slide at step i % 9, the way LineSlideTransition drew
+// it before the row-major tables: every pixel of every glyph tested on its own
+static void slideLinePerPixelKernel(void* context, unsigned long i) {
+  SlideContext& c = *static_cast<SlideContext*>(context);
+  const Font& font = *c.font;
+  int y = -(int)(i % 9);
+  for (int pos = 0; pos < g_topology.getColumns(); pos++) {
+    const uint8_t* glyph = font.glyph(c.line[pos % c.length]);
+    if (!glyph) continue;
+    for (int py = 0; py < font.height; py++) {
+      int actualY = py + y;
+      if (actualY >= 0 && actualY < 7) {
+        for (int px = 0; px < font.width; px++) {
+          if (font.bit(glyph, px, py)) {
+            set_led(pos*5 + px, actualY, CRGB(0, 128, 255));
+          }
+        }
+      }
+    }
+  }
+}
+
+static void slideLineRowsKernel(void* context, unsigned long i) {
+  SlideContext& c = *static_cast<SlideContext*>(context);
+  int y = -(int)(i % 9);
+  for (int pos = 0; pos < g_topology.getColumns(); pos++) {
+    write_character_rows(*c.font, c.line[pos % c.length], pos, y, CRGB(0, 128, 255));
+  }
+}
+
+// The same glyph kernels compiled for the runtime geometry and for the
+// loaded sign's fixed one, called directly so only the kernel is timed
+static void kernelSetWriteCharacter(void* context, unsigned long i) {
+  KernelSetContext& c = *static_cast<KernelSetContext*>(context);
+  c.kernels->writeCharacter(*c.slide.font, 'A' + i % 26, i % g_topology.getColumns(), CRGB(0, 128, 255), 0);
+}
+
+static void kernelSetDrawGlyph(void* context, unsigned long i) {
+  KernelSetContext& c = *static_cast<KernelSetContext*>(context);
+  sink += c.kernels->drawGlyph(*c.slide.font, 'A' + i % 26, i % (g_topology.getWidth() - BLOCK_WIDTH), 0, CRGB(0, 128, 255));
+}
+
+// A full row of proportional text, as the smooth scroll draws it
+static void kernelSetTextRow(void* context, unsigned long i) {
+  KernelSetContext& c = *static_cast<KernelSetContext*>(context);
+  int x = -(int)(i % 6);
+  for (int n = 0; x < g_topology.getWidth(); n++) {
+    x += c.kernels->drawGlyph(*c.slide.font, c.slide.line[n % c.slide.length], x, 0, CRGB(0, 128, 255));
+  }
+}
+
+static void kernelSetSlideLine(void* context, unsigned long i) {
+  KernelSetContext& c = *static_cast<KernelSetContext*>(context);
+  int y = -(int)(i % 9);
+  for (int pos = 0; pos < g_topology.getColumns(); pos++) {
+    c.kernels->writeCharacterRows(*c.slide.font, c.slide.line[pos % c.slide.length], pos, y, CRGB(0, 128, 255));
+  }
+}
+
+static void characterColorKernel(void* context, unsigned long i) {
+  ColorContext& c = *static_cast<ColorContext*>(context);
+  CRGB color = c.content->getCharacterColor(*c.text, i % g_topology.getColumns(), (i / g_topology.getColumns()) % c.scrollRange);
+  sink += color.r + color.g + color.b;
+}
+
+static void extractLinesKernel(void* context, unsigned long i) {
+  ColorContext& c = *static_cast<ColorContext*>(context);
+  sink += c.content->extractLines(*c.text).size();
+}
+
+static void transitionKernel(void* context, unsigned long i) {
+  TransitionContext& t = *static_cast<TransitionContext*>(context);
+  t.transition->renderStep(*t.content, i);
+}
+
+// Matrix frame between paragraphs at step 1..29, on whatever display is loaded
+static void newlineFrameKernel(void* context, unsigned long i) {
+  SmoothScrollTransition::drawNewlineFrame(1 + i % (NEWLINE_TRANSITION_STEPS - 1), i);
+}
+
+static void spaceUpdateKernel(void* context, unsigned long i) {
+  static_cast<SpaceAnimation*>(context)->advance();
+}
+
+static void spaceRenderKernel(void* context, unsigned long i) {
+  static_cast<SpaceAnimation*>(context)->render();
+}
+
+//=============================================================================
+// Measurement
+//=============================================================================
+
+KernelBenchmark::KernelBenchmark(const ContentManager& stories) : stories(stories) {
+}
+
+unsigned long KernelBenchmark::timeIterations(Kernel kernel, void* context, unsigned long iterations) {
+  unsigned long start = micros();
+  for (unsigned long i = 0; i < iterations; i++) {
+    kernel(context, i);
+  }
+  return micros() - start;
+}
+
+void KernelBenchmark::measure(const char* name, Kernel kernel, void* context) {
+  // Double the iteration count until one sample is long enough to time
+  unsigned long iterations = 1;
+  while (iterations < KERNEL_BENCHMARK_MAX_ITERATIONS &&
+         timeIterations(kernel, context, iterations) < KERNEL_BENCHMARK_SAMPLE_MICROS) {
+    iterations *= 2;
+  }
+
+  unsigned long samples[KERNEL_BENCHMARK_SAMPLES];
+  for (int s = 0; s < KERNEL_BENCHMARK_SAMPLES; s++) {
+    Task::sleep(1); // Let other tasks run between samples rather than during them
+    unsigned long elapsed = timeIterations(kernel, context, iterations);
+
+    // Insertion sort, so the median and minimum fall out at the end
+    int j = s;
+    while (j > 0 && samples[j - 1] > elapsed) {
+      samples[j] = samples[j - 1];
+      j--;
+    }
+    samples[j] = elapsed;
+  }
+
+  unsigned long median = (unsigned long)((uint64_t)samples[KERNEL_BENCHMARK_SAMPLES / 2] * 1000 / iterations);
+  unsigned long fastest = (unsigned long)((uint64_t)samples[0] * 1000 / iterations);
+  Serial.printf("{\"kernel\":\"%s\",\"ns_per_op\":%lu,\"min_ns_per_op\":%lu,\"iterations\":%lu,\"samples\":%d}\n",
+                name, median, fastest, iterations, KERNEL_BENCHMARK_SAMPLES);
+}
+
+void KernelBenchmark::measureKernelSets() {
+  const RenderKernels* sets[] = { &RenderKernels::runtime(), &RenderKernels::select(g_topology) };
+  char name[48];
+
+  for (int set = 0; set < 2; set++) {
+    if (set > 0 && sets[set] == sets[0]) break; // No fixed set for this sign
+    KernelSetContext context = { sets[set], { &getFont(DEFAULT_FONT), "The quick brown fox jumps over t", 32 } };
+    snprintf(name, sizeof(name), "writeCharacter/%s", sets[set]->name);
+    measure(name, kernelSetWriteCharacter, &context);
+    snprintf(name, sizeof(name), "drawGlyph/%s", sets[set]->name);
+    measure(name, kernelSetDrawGlyph, &context);
+    snprintf(name, sizeof(name), "textRow/%s", sets[set]->name);
+    measure(name, kernelSetTextRow, &context);
+    snprintf(name, sizeof(name), "slideLine/%s", sets[set]->name);
+    measure(name, kernelSetSlideLine, &context);
+  }
+}
+
+void KernelBenchmark::measureScaling() {
+  // Chains of each length stand in for the sign in turn, drawing into a
+  // buffer of their own; output is suspended, so nothing shows them
+  Topology live = g_topology;
+  CRGB* liveLeds = leds;
+  bool segmented = g_segmentRenderer.isEnabled();
+  char description[16];
+  char name[48];
+
+  for (int blocks = KERNEL_BENCHMARK_SCALING_MIN; blocks <= KERNEL_BENCHMARK_SCALING_MAX; blocks *= 2) {
+    snprintf(description, sizeof(description), "%dx1", blocks);
+    std::unique_ptr<CRGB[]> frame(new (std::nothrow) CRGB[blocks * BLOCK_LEDS]());
+    if (!frame || !g_topology.load(description)) {
+      Serial.printf("Scaling: no room for %s\n", description);
+      break;
+    }
+    leds = frame.get();
+
+    g_segmentRenderer.setEnabled(false);
+    snprintf(name, sizeof(name), "newlineFrame/%d/1", blocks);
+    measure(name, newlineFrameKernel, nullptr);
+
+    g_segmentRenderer.setEnabled(true);
+    int segments = g_segmentRenderer.segmentsFor(g_topology.getWidth());
+    if (segments > 1) {
+      snprintf(name, sizeof(name), "newlineFrame/%d/%d", blocks, segments);
+      measure(name, newlineFrameKernel, nullptr);
+    }
+  }
+
+  g_segmentRenderer.setEnabled(segmented);
+  g_topology = live;
+  leds = liveLeds;
+}
+
+void KernelBenchmark::run() {
+  // Kernels draw into leds[]; the frame on display is put back afterwards
+  std::unique_ptr<CRGB[]> saved(new CRGB[g_topology.getLedCount()]);
+  memcpy(saved.get(), leds, sizeof(CRGB) * g_topology.getLedCount());
+  suspend_output(true);
+
+  // Private copies, so the suite starts from the same state every run
+  ContentManager content;
+  for (int i = 0; i < stories.getStoryCount(); i++) {
+    content.addStory(stories.getStory(i));
+  }
+  content.selectStory(0);
+
+  Serial.println("=== KERNEL BENCHMARK BEGIN ===");
+
+  measure("set_led", setLedKernel, nullptr);
+  measure("write_character", writeCharacterKernel, nullptr);
+
+  // Vertical slide of one full line: per-pixel column tests against row masks
+  SlideContext slide = { &getFont(DEFAULT_FONT), "The quick brown fox jumps over t", 32 };
+  measure("slideLine/per_pixel", slideLinePerPixelKernel, &slide);
+  measure("slideLine/row_major", slideLineRowsKernel, &slide);
+  measureKernelSets();
+
+  char name[48];
+  if (content.getStoryCount() > 0) {
+    const String& story = content.getStory(0);
+    ColorContext color = { &content, &story, (int)story.length() > g_topology.getColumns() ? (int)story.length() - g_topology.getColumns() : 1 };
+    for (int mode = 0; mode < COLOR_MODES; mode++) {
+      content.setColorMode(static_cast<ColorMode>(mode));
+      snprintf(name, sizeof(name), "getCharacterColor/%s", content.getColorModeName());
+      measure(name, characterColorKernel, &color);
+    }
+
+    for (int i = 0; i < content.getStoryCount(); i++) {
+      ColorContext lines = { &content, &content.getStory(i), 1 };
+      snprintf(name, sizeof(name), "extractLines/story%d", i);
+      measure(name, extractLinesKernel, &lines);
+    }
+
+    // Transitions render the first story in word colors
+    content.setColorMode(ColorMode::WORD_BASED);
+    for (int type = 0; type < TransitionFactory::getImplementedCount(); type++) {
+      TransitionType transitionType = static_cast<TransitionType>(type);
+      std::unique_ptr<TransitionEffect> transition(TransitionFactory::createTransition(transitionType));
+      if (!transition) continue;
+      TransitionContext context = { transition.get(), &content };
+      snprintf(name, sizeof(name), "renderStep/%s", TransitionFactory::getTransitionName(transitionType));
+      measure(name, transitionKernel, &context);
+    }
+  }
+
+  SpaceAnimation space;
+  measure("SpaceAnimation::update", spaceUpdateKernel, &space);
+  measure("SpaceAnimation::render", spaceRenderKernel, &space);
+
+  measureScaling();
+
+  Serial.println("=== KERNEL BENCHMARK END ===");
+
+  suspend_output(false);
+  memcpy(leds, saved.get(), sizeof(CRGB) * g_topology.getLedCount());
+}
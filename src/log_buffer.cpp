@@ -0,0 +1,75 @@
+#include "log_buffer.h"
+
+// Global log buffer
+LogBuffer g_logBuffer;
+
+LogBuffer::LogBuffer() : reportedDropped(0), lineLength(0), lineWritten(0) {
+}
+
+void LogBuffer::push(const char* format, const LogArg* args, int count) {
+  LogEntry entry;
+  entry.time = millis();
+  entry.format = format;
+  for (int i = 0; i < LOG_MAX_ARGS; i++) {
+    entry.args[i] = i < count ? args[i].word : 0;
+  }
+
+  if (!ENABLE_DEFERRED_LOGGING) {
+    // Synchronous fallback - the caller pays for the UART
+    char text[LOG_LINE_LENGTH];
+    formatEntry(entry, text, sizeof(text));
+    Serial.print(text);
+    return;
+  }
+  entries.push(entry);
+}
+
+size_t LogBuffer::formatEntry(const LogEntry& entry, char* out, size_t length) {
+  int n = snprintf(out, length, "[%lu] ", entry.time);
+  if (n < 0 || n >= (int)length) n = 0;
+
+  // Unused trailing arguments are passed and ignored
+  int m = snprintf(out + n, length - n, entry.format, entry.args[0], entry.args[1], entry.args[2],
+                 entry.args[3], entry.args[4], entry.args[5]);
+  if (m < 0) m = 0;
+  size_t total = n + m;
+  if (total >= length) total = length - 1; // Truncated
+
+  // Every entry ends its line, truncated or not
+  if (total == 0 || out[total - 1] != '\n') {
+    if (total >= length - 1) total = length - 2;
+    out[total++] = '\n';
+    out[total] = '\0';
+  }
+  return total;
+}
+
+bool LogBuffer::writePending() {
+  // Only what fits in the transmit buffer, so the write cannot block
+  size_t remaining = lineLength - lineWritten;
+  size_t room = Serial.availableForWrite();
+  size_t chunk = remaining < room ? remaining : room;
+  if (chunk > 0) {
+    Serial.write(reinterpret_cast<const uint8_t*>(line) + lineWritten, chunk);
+    lineWritten += chunk;
+  }
+  return lineWritten == lineLength;
+}
+
+void LogBuffer::drain() {
+  while (true) {
+    if (lineWritten < lineLength && !writePending()) return;
+
+    unsigned long dropped = entries.getDropped();
+    LogEntry entry;
+    if (dropped != reportedDropped) {
+      lineLength = snprintf(line, sizeof(line), "[log] %lu messages dropped\n", dropped - reportedDropped);
+      reportedDropped = dropped;
+    } else if (entries.pop(entry)) {
+      lineLength = formatEntry(entry, line, sizeof(line));
+    } else {
+      return;
+    }
+    lineWritten = 0;
+  }
+}
@@ -4,221 +4,345 @@
 
 // Include our new modular headers
 #include "font.h"
-#include "led_art.h"
-#include "led_history.h"
+#include "topology.h"
 #include "performance_monitor.h"
 #include "content_manager.h"
-#include "transition_effects.h"
-#include "space_animation.h"
+#include "display_controller.h"
+#include "shared_clock.h"
+#include "task_runner.h"
+#include "segment_renderer.h"
+#include "render_kernels.h"
+#include "idle_sleep.h"
+#include "trace_buffer.h"
+#include "log_buffer.h"
+#include "kernel_benchmark.h"
+#include "scenario_replay.h"
+#include "golden_frames.h"
+#include "soak_test.h"
+#include "output_timing.h"
+#include "frame_sink.h"
+#if defined(ESP32)
+  #include <WiFi.h>
+#endif
 
 // ===================== CONFIGURATION =====================
-#define MAX_BRIGHTNESS 24
+// MAX_BRIGHTNESS and the button pin live in display_controller.h; the sign's
+// size and wiring come from the topology loaded at boot (topology.h)
 
-// Display constants (moved to headers)
-#define NUM_LEDS (5*7*NUM_CHARS)  // NUM_CHARS is defined in content_manager.h
+// Layout of the sign. Defined ahead of displayController, whose members ask it
+// for the display size.
+Topology g_topology;
 
-// LED array and utility functions
-CRGB leds[NUM_LEDS];
+// LED array and utility functions - sized from the topology once, in setup()
+CRGB* leds = nullptr;
 
-// Global instances
-ContentManager contentManager;
-TransitionEffect* currentTransition = nullptr;
-SpaceAnimation spaceAnimation;
+// Global instances - the controller owns modes, transitions and the frame loop
+DisplayController displayController;
 
-// Current state
-TransitionType currentTransitionType = TransitionType::SMOOTH_SCROLL;
-unsigned long lastTransitionChange = 0;
-bool autoTransitionCycling = false; // Set to true to auto-cycle transitions
+// Timing point for per-character glyph writes
+DEFINE_TIMER(char_write);
 
 // ===================== LED UTILITY FUNCTIONS =====================
-void set_led(uint8_t x, uint8_t y, CRGB color) {
-  if (x < NUM_CHARS*5 && y < 7) {
-    int offset = x/5*30;
-    leds[y*5+x+offset] = color;
+// Coordinates are 16-bit and signed, so glyphs partly off either edge clip
+// instead of wrapping onto the far side of wide chains
+void set_led(int16_t x, int16_t y, CRGB color) {
+  if (x >= 0 && x < g_topology.getWidth() && y >= 0 && y < g_topology.getHeight()) {
+    leds[g_topology.index(x, y)] = color;
   }
 }
 
-void fade_led(uint8_t x, uint8_t y, uint8_t fade) {
-  if (x < NUM_CHARS*5 && y < 7) {
-    int offset = x/5*30;
-    leds[y*5+x+offset].fadeToBlackBy(fade);
+void fade_led(int16_t x, int16_t y, uint8_t fade) {
+  if (x >= 0 && x < g_topology.getWidth() && y >= 0 && y < g_topology.getHeight()) {
+    leds[g_topology.index(x, y)].fadeToBlackBy(fade);
   }
 }
 
-void write_character(uint8_t character, uint8_t pos, CRGB color, int offset=0) {
-  START_TIMER(char_write);
-  
-	// Loop through 7 high 5 wide monochrome font  
-	for (int py = 0; py < 7; py++) { // rows
-    int adjusted_offset = 0;
-		for (int px = 0; px < 5; px++) {  // columns
-      if (px == abs(offset)-1) continue;
-      if (offset < -1){
-        adjusted_offset = (px < abs(offset)-1) ? 1 : 0;
-      }
-			if (FONT_BIT(character - 16, px, py)) {  
-				set_led(pos*5 + px + offset + adjusted_offset, py, color);
-			} else {
-        set_led(pos*5 + px + offset + adjusted_offset, py, CRGB::Black);
-      }
-		}
-	}
-  
-  END_TIMER(char_write, g_perfMonitor->getMetrics().characterWriteTime);
+#if ENABLE_TASK_LAYER
+struct FrameToken {
+  unsigned long sequence;
+  bool changed;
+};
+
+BoundedQueue<FrameToken, 1> framesToShow;          // render -> output
+BoundedQueue<FrameToken, 1> framesShown;           // output -> render: output buffer is free
+BoundedQueue<InputEvent, 8> inputEvents;           // io -> render
+BoundedQueue<PerformanceSnapshot, 2> reportQueue;  // render -> io
+#endif
+
+unsigned long frameSequence = 0;
+
+// Set while benchmarks and replays draw into leds[]
+volatile bool outputSuspended = false;
+
+// Diagnostic serial command waiting for the rendering context, 0 when none
+volatile char pendingDiagnostic = 0;
+
+// Hand the finished frame in leds[] to the frame sinks
+void show_frame() {
+  if (outputSuspended) return;
+  TIME_SCOPE(show);
+  g_perfMonitor->incrementVisualUpdate();
+#if ENABLE_TASK_LAYER
+  FrameToken token;
+  framesShown.pop(token, TASK_WAIT_FOREVER); // Previous frame has left the output buffer
+  token.changed = g_frameOutput.stage(leds);
+  token.sequence = ++frameSequence;
+  framesToShow.push(token, TASK_WAIT_FOREVER);
+#else
+  g_frameOutput.write(leds, ++frameSequence);
+#endif
 }
 
-// ===================== TRANSITION MANAGEMENT =====================
-void createTransition(TransitionType type) {
-  // Clean up previous transition
-  if (currentTransition) {
-    delete currentTransition;
-  }
-  
-  currentTransition = TransitionFactory::createTransition(type, true);
-  currentTransitionType = type;
-  if (currentTransition) {
-    currentTransition->reset();
-  }
-  Serial.printf("Switched to transition: %s\n", TransitionFactory::getTransitionName(type));
+// The next frame goes to every sink, even if it matches the last one
+void force_next_frame() {
+  g_frameOutput.forceNext();
 }
 
-void cycleThroughTransitions() {
-  int nextType = (static_cast<int>(currentTransitionType) + 1) % 4; // Only use first 4 transitions
-  createTransition(static_cast<TransitionType>(nextType));
-  
-  // Randomize color mode when switching transitions
-  contentManager.randomizeColorMode();
-  
-  lastTransitionChange = millis();
-  Serial.printf("Cycled to transition %d of 4 total\n", nextType + 1);
+// Limit the output to the first count LEDs of the chain (the benchmark sweeps this)
+void set_output_length(int count) {
+#if ENABLE_TASK_LAYER
+  FrameToken token;
+  framesShown.pop(token, TASK_WAIT_FOREVER); // The output task is idle until the next frame arrives
+  g_frameOutput.setLength(count);
+  framesShown.push(token);
+#else
+  g_frameOutput.setLength(count);
+#endif
+}
+
+void suspend_output(bool suspended) {
+  outputSuspended = suspended;
+}
+
+void clear_frame() {
+  fill_solid(leds, g_topology.getLedCount(), CRGB::Black);
+}
+
+// The glyph writers go through the kernel set compiled for this sign's
+// geometry, or the runtime one (see render_kernels.h)
+void write_character(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset=0) {
+  TIME_SCOPE(char_write);
+  g_renderKernels->writeCharacter(font, character, pos, color, offset);
+}
+
+// Fixed-cell glyph shifted down by y rows within the text row, for vertical
+// transitions. Only lit pixels are written.
+// Not timed per call; a timer would cost more than the glyph.
+void write_character_rows(const Font& font, uint8_t character, uint16_t pos, int y, CRGB color) {
+  g_renderKernels->writeCharacterRows(font, character, pos, y, color);
 }
 
-// ===================== MODE FUNCTIONS =====================
-void color_show(){
-  // Original color show function - simplified
-  CRGB color = CRGB::White;
-  int c = random(1,255);
-  for (int i = 0; i < NUM_LEDS; i++) {
-    color.setHSV(c+i/2, 255 - (i%2==0 ? 50 : 0), 70);
-    leds[i] = color;
-    if (digitalRead(0) == LOW){
-      return;
-    } else {
-      delay(20);
-      START_TIMER(led_show_seq);
-      FastLED.show();
-      END_FASTLED_TIMER(led_show_seq, g_perfMonitor->getMetrics().fastLEDShowTime);
+// Proportional counterpart of write_character(): draws the inked columns of
+// a glyph from display column x, shifted down by y rows, clipped to the
+// display. Only lit pixels are written. Returns the columns to the next glyph.
+int draw_glyph(const Font& font, uint8_t character, int x, int y, CRGB color) {
+  TIME_SCOPE(char_write);
+  return g_renderKernels->drawGlyph(font, character, x, y, color);
+}
+
+// 'T' on the serial port writes the trace out as Chrome trace JSON. The
+// diagnostics - 'B' kernel benchmarks, 'R' scenario replay, 'G'/'g' golden
+// frame check and record, 'S' soak test, 'O' output timing - and 'F', which
+// switches the story's font, are handed to the rendering context. 'L' reads a
+// topology description up to the end of the line and stores it for the next
+// boot.
+// Serial input belongs to the frame stream while the stream receiver is active.
+void poll_serial_commands() {
+  static char topologyInput[TOPOLOGY_DESCRIPTION_LENGTH];
+  static int topologyLength = -1; // -1 when no description is being read
+  
+  if (displayController.getDisplayMode() == DisplayMode::STREAM_RECEIVER) return;
+  while (Serial.available() > 0) {
+    int command = Serial.read();
+    if (topologyLength >= 0) {
+      if (command == '\n' || command == '\r') {
+        topologyInput[topologyLength] = '\0';
+        if (topologyLength > 0) Topology::save(topologyInput);
+        topologyLength = -1;
+      } else if (topologyLength < TOPOLOGY_DESCRIPTION_LENGTH - 1) {
+        topologyInput[topologyLength++] = command;
+      }
+    } else if (command == TOPOLOGY_COMMAND) {
+      topologyLength = 0;
+    } else if (command == TRACE_DUMP_COMMAND && g_traceBuffer) {
+      g_traceBuffer->dumpToSerial();
+    } else if (command == KERNEL_BENCHMARK_COMMAND || command == SCENARIO_REPLAY_COMMAND ||
+               command == GOLDEN_FRAMES_COMMAND || command == GOLDEN_FRAMES_RECORD_COMMAND ||
+               command == SOAK_TEST_COMMAND || command == FONT_CYCLE_COMMAND || command == OUTPUT_TIMING_COMMAND) {
+      pendingDiagnostic = command;
     }
   }
-  delay(1000);
-  
-  // Fade out
-  for (int x=0; x<50; x++) {
-    for (int i = 0; i < NUM_LEDS; i++) {
-      leds[i].fadeToBlackBy(3+random(5));
+}
+
+// Runs in the rendering context, which owns leds[] and the content.
+// Returns false if a check failed.
+bool run_diagnostic(char command) {
+  switch (command) {
+    case KERNEL_BENCHMARK_COMMAND: {
+      KernelBenchmark benchmark(displayController.getContentManager());
+      benchmark.run();
+      return true;
+    }
+    case SCENARIO_REPLAY_COMMAND: {
+      ScenarioReplay replay(displayController);
+      return replay.run();
+    }
+    case GOLDEN_FRAMES_COMMAND: {
+      GoldenFrameCheck check(displayController);
+      return check.verify();
+    }
+    case GOLDEN_FRAMES_RECORD_COMMAND: {
+      GoldenFrameCheck check(displayController);
+      check.record();
+      return true;
     }
-    if (digitalRead(0) == LOW){
-      return;
-    } else {
-      START_TIMER(led_show_fade);
-      FastLED.show();
-      END_FASTLED_TIMER(led_show_fade, g_perfMonitor->getMetrics().fastLEDShowTime);
-      delay(50);
+    case SOAK_TEST_COMMAND: {
+      SoakTest soak(displayController);
+      return soak.run();
     }
+    case FONT_CYCLE_COMMAND:
+      displayController.cycleStoryFont();
+      return true;
+    case OUTPUT_TIMING_COMMAND:
+      OutputTiming::run();
+      return true;
+    default:
+      return true;
   }
 }
 
-void test_patterns(){
-  static int x=0;
-  static int y=0;
-  set_led(x, y, CRGB::White);
-  START_TIMER(led_show1);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show1, g_perfMonitor->getMetrics().fastLEDShowTime);
-  delay(30);
-  set_led(x, y, CRGB::Black);
-  START_TIMER(led_show2);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show2, g_perfMonitor->getMetrics().fastLEDShowTime);
-  delay(2);
-
-  x++;
-  if (x >= NUM_CHARS*5){
-    x = 0;
-    y++;
-    if (y >= 7){
-      y = 0;
+void run_pending_diagnostic() {
+  char command = pendingDiagnostic;
+  if (command == 0) return;
+  pendingDiagnostic = 0;
+  run_diagnostic(command);
+}
+
+// ===================== TASKS =====================
+#if ENABLE_TASK_LAYER
+void render_step(Task& task) {
+  InputEvent event;
+  while (inputEvents.pop(event)) {
+    displayController.handleInput(event);
+  }
+
+  run_pending_diagnostic();
+
+  task.beginWork();
+  bool modeRan = displayController.update();
+
+  // Formatting and printing the report is left to the io task
+  PerformanceSnapshot snapshot;
+  if (g_perfMonitor && g_perfMonitor->takeSnapshot(snapshot)) {
+    reportQueue.push(snapshot);
+  }
+  unsigned long wait = ENABLE_IDLE_SLEEP ? IdleSleeper::timeUntil(displayController.getNextWakeTime()) : 0;
+  task.endWork();
+
+  if (wait > 0) {
+    // Sleep until the next frame is due; a button event cuts the wait short
+    unsigned long idleStart = micros();
+    if (inputEvents.pop(event, wait)) {
+      displayController.handleInput(event);
     }
+    unsigned long idleEnd = micros();
+    g_perfMonitor->addIdleTime((uint32_t)(idleEnd - idleStart));
+    if (g_traceBuffer) g_traceBuffer->record("idle", idleStart, idleEnd);
+  } else if (!modeRan) {
+    Task::sleep(1); // Nothing due yet - let lower priority tasks run
   }
 }
 
-// ===================== BUTTON HANDLING =====================
-unsigned long buttonPressTime = 0;
-bool longPressActive = false;
+void output_step(Task& task) {
+  FrameToken token;
+  framesToShow.pop(token, TASK_WAIT_FOREVER);
 
-enum class DisplayMode {
-  TEXT_CONTENT = 0,
-  SPACE_ANIMATION = 1,
-  COLOR_SHOW = 2,
-  TEST_PATTERNS = 3
-};
+  task.beginWork();
+  g_frameOutput.send(token.sequence, token.changed);
+  task.endWork();
 
-DisplayMode currentMode = DisplayMode::TEXT_CONTENT;
+  framesShown.push(token, TASK_WAIT_FOREVER);
+}
 
-void handleShortPress() {
-  if (currentMode == DisplayMode::TEXT_CONTENT) {
-    // Always cycle through transitions in text mode
-    cycleThroughTransitions();
-  } else {
-    // In other modes, short press switches back to text mode  
-    currentMode = DisplayMode::TEXT_CONTENT;
-    Serial.println("Switched back to Text Content mode");
+void io_step(Task& task) {
+  task.beginWork();
+  InputEvent event = displayController.sampleButton();
+  if (event != InputEvent::NONE) {
+    inputEvents.push(event);
   }
-}
 
-void handleLongPress() {
-  // Long press cycles through display modes
-  int nextMode = (static_cast<int>(currentMode) + 1) % 4;
-  currentMode = static_cast<DisplayMode>(nextMode);
-  
-  const char* modeNames[] = {"Text Content", "Space Animation", "Color Show", "Test Patterns"};
-  Serial.printf("Long press - Mode changed to: %s\n", modeNames[static_cast<int>(currentMode)]);
-  
-  // Visual feedback
-  FastLED.setBrightness(MAX_BRIGHTNESS/2);
-  START_TIMER(led_show_long);
-  FastLED.showColor(CRGB::Blue);
-  END_FASTLED_TIMER(led_show_long, g_perfMonitor->getMetrics().fastLEDShowTime);
-  delay(300);
-  FastLED.clear();
-  FastLED.setBrightness(MAX_BRIGHTNESS);
+  PerformanceSnapshot snapshot;
+  if (reportQueue.pop(snapshot)) {
+    g_perfMonitor->sendReport(snapshot);
+  }
+  poll_serial_commands();
+  g_logBuffer.drain();
+  task.endWork();
+
+  Task::sleep(IO_TASK_INTERVAL);
 }
 
+Task renderTask("render", render_step);
+Task outputTask("output", output_step);
+Task ioTask("io", io_step);
+#endif
+
 // ===================== MAIN SETUP =====================
-void setup() {
+// Everything up to the start of the tasks. The host runner (host/host_main.cpp)
+// calls this alone and then runs diagnostics in place of the frame loop.
+void setup_firmware() {
   Serial.begin(115200);
   
-  // Initialize FastLED
-  FastLED.addLeds<WS2812Controller800Khz, 5, GRB>(leds, NUM_LEDS);
+  // The topology decides how many LEDs there are; buffers are sized once here
+  g_topology.loadAtBoot();
+  g_renderKernels = &RenderKernels::select(g_topology);
+  int ledCount = g_topology.getLedCount();
+  leds = new CRGB[ledCount]();
+  g_frameOutput.begin(ledCount);
+
+  // The controller was built before the topology was loaded; start it over at the sign's size
+  displayController.reset();
+  
+  // Frame sinks all read the one buffer frames are shown from
+#if ENABLE_TASK_LAYER
+  FrameToken initial = { 0, false };
+  framesShown.push(initial); // Output buffer starts out free
+#endif
+  g_frameOutput.addSink(new FastLedSink(g_frameOutput.getFrame()));
   FastLED.setBrightness(MAX_BRIGHTNESS);
-
-  // Initialize button
-  pinMode(0, INPUT_PULLUP);
+  if (FRAME_SINK_RECORD_PATH) {
+    FILE* recording = fopen(FRAME_SINK_RECORD_PATH, "wb");
+    if (recording) g_frameOutput.addSink(new FrameRecorderSink(recording));
+  }
 
   // Initialize random seed
   randomSeed(analogRead(A0) + millis());
 
   // Initialize performance monitor
   g_perfMonitor = new PerformanceMonitor(ENABLE_BENCHMARKING);
+  g_perfMonitor->setFrameBudget(FRAME_BUDGET_MICROS);
+  if (ENABLE_TRACING) {
+    g_traceBuffer = new TraceBuffer(TRACE_BUFFER_EVENTS);
+  }
 
-  // Initialize content manager with stories
-  contentManager.addStory(led_art_story);
-  contentManager.addStory(led_history_story);
-  contentManager.selectRandomStory();
+  // Shared time base for signs built from several controllers, and frames for thin displays
+  #if defined(ESP32)
+    if (CLOCK_SYNC_ENABLED || FRAME_SINK_NETWORK) {
+      WiFi.mode(WIFI_STA);
+      WiFi.begin(CLOCK_SYNC_WIFI_SSID, CLOCK_SYNC_WIFI_PASSWORD);
+    }
+    if (FRAME_SINK_NETWORK) {
+      g_frameOutput.addSink(new UdpFrameSink(g_topology.getLedCount(), FRAME_SINK_NETWORK_DISPLAY_ID, FRAME_SINK_NETWORK_PORT));
+    }
+  #endif
+  if (CLOCK_SYNC_ENABLED) {
+    #if defined(ESP32)
+      g_sharedClock = new SharedClock(new UdpClockTransport(CLOCK_SYNC_PORT, CLOCK_SYNC_MASTER), CLOCK_SYNC_MASTER);
+    #endif
+  }
 
-  // Initialize first transition and randomize color mode
-  contentManager.randomizeColorMode();
-  createTransition(TransitionType::SMOOTH_SCROLL);
+  // Stories, first transition and display mode
+  displayController.initialize();
 
   delay(500);
 
@@ -232,109 +356,103 @@ void setup() {
   int minor = (FASTLED_VERSION / 100) % 1000;
   int patch = FASTLED_VERSION % 100;
   Serial.printf("FastLED version: %d.%d.%d\n", major, minor, patch);
-  Serial.printf("Number of LEDs: %d\n", NUM_LEDS);
-  Serial.printf("Stories loaded: %d\n", contentManager.getStoryCount());
-  Serial.printf("Initial color mode: %s\n", contentManager.getColorModeName());
+  Serial.printf("Number of LEDs: %d\n", ledCount);
+  Serial.printf("Topology: %s, %d x %d blocks, %d x %d pixels\n", g_topology.getDescription(),
+                g_topology.getColumns(), g_topology.getBlockRows(), g_topology.getWidth(), g_topology.getHeight());
+  Serial.printf("Render kernels: %s\n", g_renderKernels->name);
+  Serial.printf("Frame sinks:");
+  for (int i = 0; i < g_frameOutput.getSinkCount(); i++) {
+    Serial.printf(" %s", g_frameOutput.getSink(i)->getName());
+  }
+  Serial.printf("\n");
+  Serial.printf("LED outputs: %d, predicted refresh %luus (%lu FPS max)\n", g_topology.getOutputCount(),
+                OutputTiming::showMicros(g_topology), OutputTiming::maxFps(OutputTiming::showMicros(g_topology)));
+  Serial.printf("Stories loaded: %d\n", displayController.getContentManager().getStoryCount());
+  Serial.printf("Initial color mode: %s\n", displayController.getContentManager().getColorModeName());
+  if (g_sharedClock) {
+    Serial.printf("Clock sync: %s, column offset %d\n", CLOCK_SYNC_MASTER ? "master" : "follower", CLOCK_SYNC_COLUMN_OFFSET);
+  }
   Serial.println("=== Controls ===");
   Serial.println("Short press: Cycle transitions (text mode) or return to text mode");
-  Serial.println("Long press: Change display mode (Text -> Space -> Color Show -> Test Patterns)");
-  Serial.println("Auto-cycle transitions: Set autoTransitionCycling = true");
+  Serial.println("Long press: Change display mode (Text -> Space -> Color Show -> Test Patterns -> Benchmark -> Stream Receiver)");
+  Serial.println("Auto-cycle transitions: Set ENABLE_AUTO_TRANSITION_CYCLING = true");
   Serial.println("Note: Color mode randomizes when switching transitions");
   Serial.println("Transitions: Smooth Scroll -> Character Scroll -> Line Slide -> Cursor Wipe (loops)");
+  Serial.printf("Frame budget: %dus\n", FRAME_BUDGET_MICROS);
+  if (g_traceBuffer) {
+    Serial.printf("Tracing: %d events, send '%c' to dump Chrome trace JSON\n", TRACE_BUFFER_EVENTS, TRACE_DUMP_COMMAND);
+  }
+  Serial.printf("Kernel benchmarks: send '%c' to run\n", KERNEL_BENCHMARK_COMMAND);
+  Serial.printf("Scenario replay: send '%c' to run\n", SCENARIO_REPLAY_COMMAND);
+  Serial.printf("Golden frames: send '%c' to check, '%c' to record\n", GOLDEN_FRAMES_COMMAND, GOLDEN_FRAMES_RECORD_COMMAND);
+  Serial.printf("Soak test: send '%c' to simulate %d hours\n", SOAK_TEST_COMMAND, SOAK_DURATION_HOURS);
+  Serial.printf("Fonts: send '%c' to switch the current story's font\n", FONT_CYCLE_COMMAND);
+  Serial.printf("Topology: send '%c' and a description such as 16x2s or 64x1/4, then restart\n", TOPOLOGY_COMMAND);
+  Serial.printf("Output timing: send '%c' for predicted refresh rates per number of outputs\n", OUTPUT_TIMING_COMMAND);
   Serial.println("===============================================");
-}
-
-// ===================== MAIN LOOP =====================
-void loop() {
-  START_TIMER(frame);
 
-  // Handle button input
-  if (digitalRead(0) == LOW) {
-    if (buttonPressTime == 0) {
-      buttonPressTime = millis(); // Mark the time button was first pressed
-    }
-    
-    if (millis() - buttonPressTime > 1000 && !longPressActive) {
-      handleLongPress();
-      longPressActive = true;
-    }
-  } else {
-    if (buttonPressTime > 0) {
-      if (!longPressActive) {
-        handleShortPress();
-      }
-      buttonPressTime = 0;
-      longPressActive = false;
+  // Workers that take a share of wide full-frame passes, diagnostics included
+  if (ENABLE_SEGMENT_RENDERING && g_segmentRenderer.begin()) {
+    for (int i = 0; i < SEGMENT_WORKERS; i++) {
+      g_perfMonitor->registerTask(&g_segmentRenderer.getWorkerStats(i));
     }
+    Serial.printf("Segment rendering: %d worker(s), %d segment(s) at this width\n",
+                  SEGMENT_WORKERS, g_segmentRenderer.segmentsFor(g_topology.getWidth()));
   }
 
-  // Auto-cycle transitions every 15 seconds (optional)
-  if (autoTransitionCycling && currentMode == DisplayMode::TEXT_CONTENT) {
-    if (millis() - lastTransitionChange > 15000) {
-      cycleThroughTransitions();
-    }
+  // Results are in the serial output
+  if (OUTPUT_TIMING_AT_BOOT) run_diagnostic(OUTPUT_TIMING_COMMAND);
+  if (KERNEL_BENCHMARK_AT_BOOT) run_diagnostic(KERNEL_BENCHMARK_COMMAND);
+  if (SCENARIO_REPLAY_AT_BOOT) run_diagnostic(SCENARIO_REPLAY_COMMAND);
+  if (GOLDEN_FRAMES_AT_BOOT) run_diagnostic(GOLDEN_FRAMES_COMMAND);
+  if (SOAK_TEST_AT_BOOT) run_diagnostic(SOAK_TEST_COMMAND);
+}
+
+void setup() {
+  setup_firmware();
+
+#if ENABLE_TASK_LAYER
+  // Render, LED output and io/reporting each get their own context
+  displayController.setInlineInput(false);
+  displayController.setInlineReporting(false);
+  g_perfMonitor->registerTask(&renderTask.getStats());
+  g_perfMonitor->registerTask(&outputTask.getStats());
+  g_perfMonitor->registerTask(&ioTask.getStats());
+  outputTask.start(TASK_DEFAULT_STACK_SIZE, OUTPUT_TASK_PRIORITY, OUTPUT_TASK_CORE);
+  ioTask.start(TASK_DEFAULT_STACK_SIZE, IO_TASK_PRIORITY, IO_TASK_CORE);
+  renderTask.start(TASK_DEFAULT_STACK_SIZE * 2, RENDER_TASK_PRIORITY, RENDER_TASK_CORE);
+  Serial.println("Task layer: render, output and io tasks started");
+#else
+  // The button pin doubles as the wake-up source for idle sleep
+  if (ENABLE_IDLE_SLEEP) {
+    g_idleSleeper.begin(BUTTON_PIN);
   }
+#endif
+}
 
-  // Update based on current mode
-  switch (currentMode) {
-    case DisplayMode::TEXT_CONTENT:
-      if (currentTransition) {
-        currentTransition->update(contentManager);
-      }
-      break;
-      
-    case DisplayMode::SPACE_ANIMATION:
-      spaceAnimation.update();
-      spaceAnimation.render();
-      break;
-      
-    case DisplayMode::COLOR_SHOW:
-      color_show();
-      break;
-      
-    case DisplayMode::TEST_PATTERNS:
-      test_patterns();
-      break;
+// ===================== MAIN LOOP =====================
+void loop() {
+#if ENABLE_TASK_LAYER
+  // All work happens in the render, output and io tasks
+  Task::sleep(1000);
+#else
+  // One frame: input, the active mode when due, then background work within budget
+  displayController.update();
+
+  // Messages logged during the frame go out now, as far as the UART has room
+  g_logBuffer.drain();
+
+  // Sleep until the next visible change instead of rendering identical frames
+  if (ENABLE_IDLE_SLEEP) {
+    unsigned long slept = g_idleSleeper.sleepUntil(displayController.getNextWakeTime(), displayController.canLightSleep());
+    g_perfMonitor->addIdleTime(slept);
+    if (g_traceBuffer && slept > 0) {
+      unsigned long now = micros();
+      g_traceBuffer->record("idle", now - slept, now);
+    }
   }
 
-  // Performance tracking
-  END_TIMER(frame, g_perfMonitor->getMetrics().totalFrameTime);
-  g_perfMonitor->incrementFrame();
-  g_perfMonitor->reportPerformance();
+  poll_serial_commands();
+  run_pending_diagnostic();
+#endif
 }
-
-// ===================== LEGACY FUNCTIONS REMOVED =====================
-/*
-The following functions have been moved to separate modules:
-
-OLD FUNCTIONS → NEW MODULES:
-- PerformanceMetrics struct → performance_monitor.h/cpp
-- scroll_message_smooth() → transition_effects.cpp (SmoothScrollTransition)  
-- display_line_slide() → transition_effects.cpp (LineSlideTransition)
-- display_line_cursor_wipe() → transition_effects.cpp (CursorWipeTransition)
-- extractLines() → content_manager.cpp
-- getWordColor() → content_manager.cpp
-- display_story() → transition_effects.cpp (individual transition classes)
-- write_message() → removed (replaced by transition system)
-- headlines() → removed (placeholder function)
-
-BENEFITS OF REFACTORING:
-✅ 838 lines → 280 lines (66% reduction)
-✅ Runtime transition switching during text display
-✅ Modular architecture for easy feature additions
-✅ Clean separation of concerns
-✅ Maintained all original functionality
-✅ Enhanced button controls and user feedback
-
-CONTROLS:
-- Short press in text mode: Cycle transitions
-- Short press in other modes: Cycle display modes  
-- Long press: Always cycles display modes
-- Auto-cycling: Set autoTransitionCycling = true (15 sec intervals)
-
-Ready for next enhancements:
-A) Space animation implementation
-B) Enhanced transition effects 
-C) Additional content sources
-D) Network integration
-*/
\ No newline at end of file
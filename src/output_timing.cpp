@@ -0,0 +1,50 @@
+#include "output_timing.h"
+#include "transition_effects.h"  // For SMOOTH_SCROLL_INTERVAL
+
+// Sub-steps per second of a smooth scroll at the target character rate
+static const unsigned long SMOOTH_SCROLL_FPS = 1000 / SMOOTH_SCROLL_INTERVAL;
+
+unsigned long OutputTiming::showMicros(int blocks, int outputs, int count) {
+  int longest = 0;
+  int active = 0;
+  for (int output = 0; output < outputs; output++) {
+    int start = Topology::outputStart(blocks, outputs, output);
+    int length = Topology::outputStart(blocks, outputs, output + 1) - start;
+    if (count - start < length) length = count - start;
+    if (length <= 0) break;
+    if (length > longest) longest = length;
+    active++;
+  }
+  unsigned long starts = active > 1 ? (unsigned long)(active - 1) * OUTPUT_START_MICROS : 0;
+  return (unsigned long)longest * OUTPUT_WIRE_MICROS_PER_LED + OUTPUT_LATCH_MICROS + starts;
+}
+
+void OutputTiming::run() {
+  Serial.println("=== OUTPUT TIMING BEGIN ===");
+
+  int blocks = g_topology.getBlockCount();
+  unsigned long show = showMicros(g_topology);
+  int smoothOutputs = 0; // None of the possible splits is fast enough
+  for (int outputs = 1; outputs <= TOPOLOGY_MAX_OUTPUTS && outputs <= blocks; outputs++) {
+    if (maxFps(showMicros(blocks, outputs, g_topology.getLedCount())) >= SMOOTH_SCROLL_FPS) {
+      smoothOutputs = outputs;
+      break;
+    }
+  }
+  Serial.printf("{\"sign\":\"%s\",\"leds\":%d,\"outputs\":%d,\"longest_output\":%d,\"show_us\":%lu,\"max_fps\":%lu,"
+                "\"smooth_scroll_fps\":%lu,\"outputs_for_smooth_scroll\":%d}\n",
+                g_topology.getDescription(), g_topology.getLedCount(), g_topology.getOutputCount(),
+                g_topology.getOutputLength(g_topology.getOutputCount() - 1), show, maxFps(show),
+                SMOOTH_SCROLL_FPS, smoothOutputs);
+
+  for (int chain = OUTPUT_TIMING_BLOCKS_MIN; chain <= OUTPUT_TIMING_BLOCKS_MAX; chain *= 2) {
+    for (int outputs = 1; outputs <= TOPOLOGY_MAX_OUTPUTS && outputs <= chain; outputs *= 2) {
+      int leds = chain * BLOCK_LEDS;
+      show = showMicros(chain, outputs, leds);
+      Serial.printf("{\"blocks\":%d,\"leds\":%d,\"outputs\":%d,\"longest_output\":%d,\"show_us\":%lu,\"max_fps\":%lu}\n",
+                    chain, leds, outputs, leds - Topology::outputStart(chain, outputs, outputs - 1), show, maxFps(show));
+    }
+  }
+
+  Serial.println("=== OUTPUT TIMING END ===");
+}
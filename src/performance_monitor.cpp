@@ -1,30 +1,28 @@
 #include "performance_monitor.h"
 #include "content_manager.h"  // For CPS_TARGET and LINE_TRANSITION_SMOOTH
+#include "quality_controller.h"
 
 // Global performance monitor instance
 PerformanceMonitor* g_perfMonitor = nullptr;
 
-PerformanceMonitor::PerformanceMonitor(bool enabled) : enabled(enabled) {
-  metrics.lastReportTime = millis();
-}
+// Registry storage is zero-initialized before any timer constructor runs
+TimerMetric* TimerMetric::registry[MAX_TIMER_METRICS];
+int TimerMetric::count = 0;
 
-void PerformanceMonitor::startTimer(unsigned long* startTime) {
-  if (enabled && startTime) {
-    *startTime = micros();
-  }
-}
+TimerMetric frame_timer("frame");
+TimerMetric show_timer("show");
 
-void PerformanceMonitor::endTimer(unsigned long startTime, unsigned long& accumulator) {
-  if (enabled && startTime != 0) {
-    accumulator += (micros() - startTime);
-  }
+PerformanceMonitor::PerformanceMonitor(bool enabled)
+  : enabled(enabled), frameBudget(ULONG_MAX), showWindow(0), showCount(0), showMicros(0), lastFrees(0), steadyMode(nullptr), steadyTransition(nullptr),
+    steadyFrames(0), steadyAllocatingFrames(0), taskCount(0) {
+  metrics.lastReportTime = millis();
 }
 
-void PerformanceMonitor::endFastLEDTimer(unsigned long startTime, unsigned long& accumulator) {
-  if (enabled && startTime != 0) {
-    accumulator += (micros() - startTime);
+void PerformanceMonitor::registerTask(TaskStats* stats) {
+  if (stats && taskCount < MAX_MONITORED_TASKS) {
+    lastTaskStats[taskCount] = *stats;
+    tasks[taskCount++] = stats;
   }
-  metrics.visualUpdateCount++;
 }
 
 void PerformanceMonitor::incrementFrame() {
@@ -35,51 +33,349 @@ void PerformanceMonitor::incrementCharactersScrolled(int count) {
   metrics.charactersScrolled += count;
 }
 
-void PerformanceMonitor::reportPerformance() {
+void PerformanceMonitor::addIdleTime(unsigned long micros) {
+  metrics.idleTime += micros;
+}
+
+void PerformanceMonitor::setQualityLevel(int level) {
+  if (level != metrics.qualityLevel) metrics.qualityChanges++;
+  metrics.qualityLevel = level;
+}
+
+void PerformanceMonitor::recordFrameTime(unsigned long micros) {
+  if (!enabled) return;
+  metrics.frameTimes.record(micros);
+  if (micros > metrics.maxFrameTime) metrics.maxFrameTime = micros;
+  if (micros < metrics.minFrameTime) metrics.minFrameTime = micros;
+  if (micros > frameBudget) metrics.framesOverBudget++;
+}
+
+void PerformanceMonitor::recordRenderTime(unsigned long micros) {
+  if (enabled) metrics.renderTimes.record(micros);
+}
+
+void PerformanceMonitor::recordShowTime(unsigned long micros) {
+  if (!enabled) return;
+  showLock.lock();
+  showWindows[showWindow].record(micros);
+  showLock.unlock();
+  showCount = showCount + 1;
+  showMicros = showMicros + micros;
+}
+
+void PerformanceMonitor::recordAllocations(const char* mode, const char* transition, const AllocationCount& frame) {
+  // Names are literals, so a pointer change is a mode or transition change
+  if (mode != steadyMode || transition != steadyTransition) {
+    steadyMode = mode;
+    steadyTransition = transition;
+    steadyFrames = 0;
+  }
+  steadyFrames++;
+  
+  if (frame.allocations > 0 && steadyFrames > ALLOCATION_WARMUP_FRAMES) {
+    steadyAllocatingFrames++;
+    if (ALLOCATION_CHECK) {
+      Serial.printf("ALLOCATION CHECK FAILED: %s%s%s made %lu allocations (%lu bytes) in steady-state frame %lu\n",
+                    mode, transition[0] ? "/" : "", transition, frame.allocations, frame.bytes, steadyFrames);
+    }
+  }
+  
   if (!enabled) return;
+  if (frame.allocations > 0) metrics.allocatingFrames++;
+  
+  AllocationSite* site = nullptr;
+  for (int i = 0; i < metrics.allocationSiteCount; i++) {
+    if (metrics.allocationSites[i].mode == mode && metrics.allocationSites[i].transition == transition) {
+      site = &metrics.allocationSites[i];
+      break;
+    }
+  }
+  if (!site) {
+    if (metrics.allocationSiteCount >= MAX_ALLOCATION_SITES) return;
+    site = &metrics.allocationSites[metrics.allocationSiteCount++];
+    *site = AllocationSite();
+    site->mode = mode;
+    site->transition = transition;
+  }
+  site->frames++;
+  site->allocations += frame.allocations;
+  site->bytes += frame.bytes;
+}
+
+bool PerformanceMonitor::isReportDue() const {
+  return enabled && (uint32_t)(millis() - metrics.lastReportTime) >= 2000 && metrics.frameCount > 0; // Report every 2 seconds
+}
+
+void PerformanceMonitor::reportPerformance() {
+  PerformanceSnapshot snapshot;
+  if (takeSnapshot(snapshot)) {
+    sendReport(snapshot);
+  }
+}
+
+void PerformanceMonitor::sendReport(const PerformanceSnapshot& snapshot) {
+  if (ENABLE_BINARY_TELEMETRY) {
+    writeTelemetry(snapshot);
+  } else {
+    printReport(snapshot);
+  }
+}
+
+void PerformanceMonitor::writeTelemetry(const PerformanceSnapshot& snapshot) {
+  // Integer fields only - percentages and averages are derived on the host
+  static uint8_t record[TELEMETRY_MAX_RECORD_SIZE];
+  size_t length = telemetry.encode(snapshot, record, sizeof(record));
+  if (length > 0) {
+    Serial.write(record, length);
+  }
+}
+
+bool PerformanceMonitor::takeSnapshot(PerformanceSnapshot& snapshot) {
+  if (!isReportDue()) return false;
   
   unsigned long currentTime = millis();
-  if (currentTime - metrics.lastReportTime >= 2000 && metrics.frameCount > 0) { // Report every 2 seconds
-    unsigned long reportInterval = currentTime - metrics.lastReportTime;
-    float avgFrameTime = (float)metrics.totalFrameTime / metrics.frameCount / 1000.0; // Convert to milliseconds
-    float loopFPS = 1000.0 / avgFrameTime;
-    float visualFPS = (float)metrics.visualUpdateCount * 1000.0 / reportInterval; // Visual updates per second
-    float avgFastLEDTime = metrics.visualUpdateCount > 0 ? (float)metrics.fastLEDShowTime / metrics.visualUpdateCount / 1000.0 : 0; // Per visual update
-    float avgCharWriteTime = (float)metrics.characterWriteTime / metrics.frameCount / 1000.0;
-    float avgScrollTime = (float)metrics.scrollTime / metrics.frameCount / 1000.0;
-    float avgCalcTime = (float)metrics.calculationTime / metrics.frameCount / 1000.0;
-    float actualCPS = (float)metrics.charactersScrolled * 1000.0 / reportInterval; // Characters per second
-    
-    float cpuUsagePercent = metrics.visualUpdateCount > 0 ? 
-      ((avgFrameTime - (avgFastLEDTime * metrics.visualUpdateCount / metrics.frameCount)) / avgFrameTime) * 100.0 : 0;
-    float hardwareWaitPercent = metrics.visualUpdateCount > 0 ?
-      ((avgFastLEDTime * metrics.visualUpdateCount / metrics.frameCount) / avgFrameTime) * 100.0 : 0;
-    
-    Serial.println("=== PERFORMANCE REPORT ===");
-    Serial.printf("Visual FPS: %.1f | Loop FPS: %.1f | Avg Loop: %.1fms\n", 
-                  visualFPS, loopFPS, avgFrameTime);
-    Serial.printf("Visual Updates/Loop: %.1f | FastLED.show(): %.2fms each\n", 
-                  metrics.frameCount > 0 ? (float)metrics.visualUpdateCount / metrics.frameCount : 0, avgFastLEDTime);
-    Serial.printf("Character Write: %.2fms | Scroll: %.2fms | Calc: %.2fms\n", 
-                  avgCharWriteTime, avgScrollTime, avgCalcTime);
-    Serial.printf("Actual CPS: %.1f | Target: %.1f | Transitions: %s\n", 
-                  actualCPS, CPS_TARGET, LINE_TRANSITION_SMOOTH ? "Smooth" : "Fast");
-    Serial.printf("CPU Usage: %.1f%% | Hardware Wait: %.1f%%\n", cpuUsagePercent, hardwareWaitPercent);
-    Serial.printf("Loops: %lu | Visual Updates: %lu | Characters: %lu\n", 
-                  metrics.frameCount, metrics.visualUpdateCount, metrics.charactersScrolled);
-    Serial.println("========================");
+  snapshot.metrics = metrics;
+  snapshot.interval = (uint32_t)(currentTime - metrics.lastReportTime);
+  
+  // Show times come from the output task - swap its window out, then copy it
+  showLock.lock();
+  int taken = showWindow;
+  showWindow = 1 - taken;
+  showLock.unlock();
+  snapshot.metrics.showTimes = showWindows[taken];
+  showWindows[taken].clear();
+  
+  // Same for the registered timers
+  for (int i = 0; i < TimerMetric::getCount(); i++) {
+    TimerMetric* timer = TimerMetric::get(i);
+    TimerSample& sample = snapshot.timers[i];
+    sample.totalMicros = timer->getTotalMicros() - lastTimers[i].totalMicros;
+    sample.calls = timer->getCalls() - lastTimers[i].calls;
+    sample.maxMicros = timer->takeMaxMicros();
+    lastTimers[i].totalMicros = timer->getTotalMicros();
+    lastTimers[i].calls = timer->getCalls();
+  }
+  
+  // And for the registered tasks
+  snapshot.taskCount = taskCount;
+  for (int i = 0; i < taskCount; i++) {
+    TaskStats& sample = snapshot.tasks[i];
+    sample.name = tasks[i]->name;
+    sample.busyMicros = tasks[i]->busyMicros - lastTaskStats[i].busyMicros;
+    sample.iterations = tasks[i]->iterations - lastTaskStats[i].iterations;
+    sample.maxIterationMicros = tasks[i]->maxIterationMicros;
+    tasks[i]->maxIterationMicros = 0;
+    lastTaskStats[i] = *tasks[i];
+  }
+  
+  // And for the allocator hooks, which every task goes through
+  AllocationCount allocations = AllocationTracker::total();
+  unsigned long frees = AllocationTracker::frees();
+  snapshot.allocations.allocations = allocations.allocations - lastAllocations.allocations;
+  snapshot.allocations.bytes = allocations.bytes - lastAllocations.bytes;
+  snapshot.frees = frees - lastFrees;
+  lastAllocations = allocations;
+  lastFrees = frees;
+  snapshot.freeHeap = AllocationTracker::freeHeap();
+  snapshot.largestFreeBlock = AllocationTracker::largestFreeBlock();
+  
+  // Reset metrics
+  metrics.frameCount = 0;
+  metrics.visualUpdateCount = 0;
+  metrics.charactersScrolled = 0;
+  metrics.idleTime = 0;
+  metrics.maxFrameTime = 0;
+  metrics.minFrameTime = ULONG_MAX;
+  metrics.framesOverBudget = 0;
+  metrics.qualityChanges = 0;
+  metrics.frameTimes.clear();
+  metrics.renderTimes.clear();
+  metrics.allocationSiteCount = 0;
+  metrics.allocatingFrames = 0;
+  metrics.lastReportTime = currentTime;
+  return true;
+}
+
+void PerformanceMonitor::printReport(const PerformanceSnapshot& snapshot) {
+  const PerformanceMetrics& window = snapshot.metrics;
+  unsigned long reportInterval = snapshot.interval;
+  const TimerSample& frame = snapshot.timers[frame_timer.getIndex()];
+  const TimerSample& show = snapshot.timers[show_timer.getIndex()];
+  float avgFrameTime = frame.calls > 0 ? (float)frame.totalMicros / frame.calls / 1000.0 : 0; // Convert to milliseconds
+  float loopFPS = (float)window.frameCount * 1000.0 / reportInterval;
+  float visualFPS = (float)window.visualUpdateCount * 1000.0 / reportInterval; // Visual updates per second
+  float avgShowTime = show.calls > 0 ? (float)show.totalMicros / show.calls / 1000.0 : 0; // Per visual update
+  float actualCPS = (float)window.charactersScrolled * 1000.0 / reportInterval; // Characters per second
+  float dutyCyclePercent = 100.0 - (float)window.idleTime / (reportInterval * 10.0); // Share of time not sleeping
+  if (dutyCyclePercent < 0) dutyCyclePercent = 0; // A sleep can straddle the window edge
+  
+  // Share of frame time spent writing to (or waiting on) the LEDs
+  float hardwareWaitPercent = frame.totalMicros > 0 ? (float)show.totalMicros / frame.totalMicros * 100.0 : 0;
+  if (hardwareWaitPercent > 100) hardwareWaitPercent = 100;
+  float cpuUsagePercent = frame.totalMicros > 0 ? 100.0 - hardwareWaitPercent : 0;
+  
+  Serial.println("=== PERFORMANCE REPORT ===");
+  Serial.printf("Visual FPS: %.1f | Loop FPS: %.1f | Avg Loop: %.1fms\n", 
+                visualFPS, loopFPS, avgFrameTime);
+  Serial.printf("Visual Updates/Loop: %.1f | show_frame(): %.2fms each\n", 
+                window.frameCount > 0 ? (float)window.visualUpdateCount / window.frameCount : 0, avgShowTime);
+  Serial.printf("Actual CPS: %.1f | Target: %.1f | Transitions: %s\n", 
+                actualCPS, CPS_TARGET, LINE_TRANSITION_SMOOTH ? "Smooth" : "Fast");
+  Serial.printf("CPU Usage: %.1f%% | Hardware Wait: %.1f%%\n", cpuUsagePercent, hardwareWaitPercent);
+  Serial.printf("Duty Cycle: %.1f%% | Idle: %lums\n", dutyCyclePercent, window.idleTime / 1000);
+  Serial.printf("Loops: %lu | Visual Updates: %lu | Characters: %lu\n", 
+                window.frameCount, window.visualUpdateCount, window.charactersScrolled);
+  printTimerReport(snapshot);
+  printHistogram("Frame", window.frameTimes);
+  printHistogram("Render", window.renderTimes);
+  printHistogram("Show", window.showTimes);
+  Serial.printf("Frame range: %.2f-%.2fms | Over budget: %lu\n",
+                window.frameCount > 0 ? window.minFrameTime / 1000.0 : 0, window.maxFrameTime / 1000.0, window.framesOverBudget);
+  Serial.printf("Quality: %s (level %d of %d) | Changes: %lu\n", QualityController::getSettings(window.qualityLevel).name,
+                window.qualityLevel, NUM_QUALITY_LEVELS - 1, window.qualityChanges);
+  printAllocationReport(snapshot);
+  printTaskReport(snapshot);
+  Serial.println("========================");
+}
+
+void PerformanceMonitor::printTimerReport(const PerformanceSnapshot& snapshot) {
+  // Average and worst call of every timer that ran, three to a line
+  int printed = 0;
+  for (int i = 0; i < TimerMetric::getCount(); i++) {
+    const TimerSample& sample = snapshot.timers[i];
+    if (sample.calls == 0) continue;
     
-    // Reset metrics
-    metrics.totalFrameTime = 0;
-    metrics.fastLEDShowTime = 0;
-    metrics.characterWriteTime = 0;
-    metrics.scrollTime = 0;
-    metrics.calculationTime = 0;
-    metrics.frameCount = 0;
-    metrics.visualUpdateCount = 0;
-    metrics.charactersScrolled = 0;
-    metrics.maxFrameTime = 0;
-    metrics.minFrameTime = ULONG_MAX;
-    metrics.lastReportTime = currentTime;
-  }
-} 
\ No newline at end of file
+    Serial.printf("%s%s %.2f/%.2fms x%lu", printed % 3 == 0 ? "Timers: " : " | ", TimerMetric::get(i)->getName(),
+                  sample.totalMicros / 1000.0 / sample.calls, sample.maxMicros / 1000.0, sample.calls);
+    if (++printed % 3 == 0) Serial.printf("\n");
+  }
+  if (printed % 3 != 0) Serial.printf("\n");
+}
+
+void PerformanceMonitor::printAllocationReport(const PerformanceSnapshot& snapshot) {
+  const PerformanceMetrics& window = snapshot.metrics;
+  Serial.printf("Allocations: %lu (%lu bytes) | Frees: %lu | Allocating frames: %lu\n",
+                snapshot.allocations.allocations, snapshot.allocations.bytes, snapshot.frees, window.allocatingFrames);
+  if (snapshot.freeHeap > 0) {
+    Serial.printf("Heap free: %lu | Largest block: %lu\n", snapshot.freeHeap, snapshot.largestFreeBlock);
+  }
+  
+  // Per-frame cost of each mode and transition that ran this window
+  for (int i = 0; i < window.allocationSiteCount; i++) {
+    const AllocationSite& site = window.allocationSites[i];
+    Serial.printf("%s%s%s%s %.2f/frame %luB/frame x%lu", i == 0 ? "Frame allocs: " : " | ", site.mode,
+                  site.transition[0] ? "/" : "", site.transition, (float)site.allocations / site.frames,
+                  site.bytes / site.frames, site.frames);
+  }
+  if (window.allocationSiteCount > 0) Serial.printf("\n");
+}
+
+void PerformanceMonitor::printTaskReport(const PerformanceSnapshot& snapshot) {
+  if (snapshot.taskCount == 0 || snapshot.interval == 0) return;
+  
+  // Busy share of the window and worst single step for each task
+  Serial.print("Tasks:");
+  for (int i = 0; i < snapshot.taskCount; i++) {
+    const TaskStats& task = snapshot.tasks[i];
+    Serial.printf(" %s %.1f%% %lu steps max %.2fms%s", task.name, task.busyMicros / (snapshot.interval * 10.0),
+                  task.iterations, task.maxIterationMicros / 1000.0, i + 1 < snapshot.taskCount ? " |" : "");
+  }
+  Serial.println();
+}
+
+void PerformanceMonitor::printHistogram(const char* label, const LatencyHistogram& histogram) {
+  if (histogram.count() == 0) return;
+  Serial.printf("%s p50/p95/p99/max: %.2f/%.2f/%.2f/%.2fms\n", label,
+                histogram.percentile(0.50) / 1000.0, histogram.percentile(0.95) / 1000.0,
+                histogram.percentile(0.99) / 1000.0, histogram.max / 1000.0);
+}
+
+//=============================================================================
+// LatencyHistogram Implementation
+//=============================================================================
+
+void LatencyHistogram::clear() {
+  memset(counts, 0, sizeof(counts));
+  max = 0;
+}
+
+void LatencyHistogram::record(unsigned long micros) {
+  int bucket = bucketFor(micros);
+  if (counts[bucket] < UINT16_MAX) counts[bucket]++;
+  if (micros > max) max = micros;
+}
+
+unsigned long LatencyHistogram::count() const {
+  unsigned long total = 0;
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    total += counts[i];
+  }
+  return total;
+}
+
+unsigned long LatencyHistogram::percentile(float fraction) const {
+  unsigned long total = count();
+  if (total == 0) return 0;
+  
+  unsigned long rank = (unsigned long)(fraction * total + 0.5);
+  if (rank < 1) rank = 1;
+  unsigned long seen = 0;
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    seen += counts[i];
+    if (seen >= rank) {
+      // The midpoint can overshoot the largest value actually seen
+      unsigned long value = bucketMidpoint(i);
+      return value < max ? value : max;
+    }
+  }
+  return max;
+}
+
+int LatencyHistogram::bucketFor(unsigned long micros) {
+  if (micros < HISTOGRAM_LINEAR_BUCKETS) return micros;
+  if (micros >= 1UL << HISTOGRAM_MAX_OCTAVE) return HISTOGRAM_BUCKETS - 1;
+  
+  // Octave from the highest set bit, sub-bucket from the bits below it
+  int octave = 31 - __builtin_clz((uint32_t)micros);
+  int sub = (micros >> (octave - HISTOGRAM_SUB_BUCKET_BITS)) & (HISTOGRAM_SUB_BUCKETS - 1);
+  return HISTOGRAM_LINEAR_BUCKETS + (octave - 4) * HISTOGRAM_SUB_BUCKETS + sub;
+}
+
+unsigned long LatencyHistogram::bucketMidpoint(int bucket) {
+  if (bucket < HISTOGRAM_LINEAR_BUCKETS) return bucket;
+  
+  int octave = 4 + (bucket - HISTOGRAM_LINEAR_BUCKETS) / HISTOGRAM_SUB_BUCKETS;
+  int sub = (bucket - HISTOGRAM_LINEAR_BUCKETS) % HISTOGRAM_SUB_BUCKETS;
+  unsigned long width = 1UL << (octave - HISTOGRAM_SUB_BUCKET_BITS);
+  return (HISTOGRAM_SUB_BUCKETS + sub) * width + width / 2;
+}
+
+//=============================================================================
+// TimerMetric Implementation
+//=============================================================================
+
+TimerMetric::TimerMetric(const char* name)
+  : name(name), index(-1), totalMicros(0), calls(0), maxMicros(0) {
+  if (count < MAX_TIMER_METRICS) {
+    index = count++;
+    registry[index] = this;
+  }
+}
+
+void TimerMetric::add(unsigned long micros) {
+  totalMicros += micros;
+  calls++;
+  if (micros > maxMicros) maxMicros = micros;
+}
+
+unsigned long TimerMetric::takeMaxMicros() {
+  unsigned long value = maxMicros;
+  maxMicros = 0;
+  return value;
+}
+
+ScopedTimer::~ScopedTimer() {
+  unsigned long end = micros();
+  metric.add((uint32_t)(end - start));
+  if (g_traceBuffer) g_traceBuffer->record(metric.getName(), start, end);
+}
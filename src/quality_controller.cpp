@@ -0,0 +1,70 @@
+#include "quality_controller.h"
+
+// Levels from full detail down. Scroll strides must divide SMOOTH_SCROLL_STEPS;
+// proportional text carries any overshoot into the next character.
+static const QualitySettings QUALITY_LEVELS[NUM_QUALITY_LEVELS] = {
+  { "Full",      100, true,  1, 1 },
+  { "No Nebula", 100, false, 1, 1 },
+  { "Reduced",    50, false, 2, 1 },
+  { "Minimal",    25, false, 3, 2 }  // Paced modes also run at half rate
+};
+
+QualityController::QualityController(unsigned long targetMicros)
+  : targetMicros(targetMicros), adaptive(ENABLE_ADAPTIVE_QUALITY), level(0), windowFrames(0), windowOverruns(0),
+    windowMicros(0), quietWindows(0), settling(false), lastWindowAverage(0) {
+}
+
+const QualitySettings& QualityController::getSettings(int level) {
+  if (level < 0 || level >= NUM_QUALITY_LEVELS) level = 0;
+  return QUALITY_LEVELS[level];
+}
+
+void QualityController::reset() {
+  level = 0;
+  quietWindows = 0;
+  settling = false;
+  lastWindowAverage = 0;
+  startWindow();
+}
+
+void QualityController::startWindow() {
+  windowFrames = 0;
+  windowOverruns = 0;
+  windowMicros = 0;
+}
+
+bool QualityController::recordFrame(unsigned long micros) {
+  if (!adaptive) return false;
+
+  windowFrames++;
+  windowMicros += micros;
+  if (micros > targetMicros) windowOverruns++;
+  if (windowFrames < QUALITY_WINDOW_FRAMES) return false;
+
+  lastWindowAverage = windowMicros / windowFrames;
+  bool shed = windowOverruns * 100 >= windowFrames * QUALITY_SHED_PERCENT;
+  bool quiet = windowOverruns == 0 && lastWindowAverage * 100 <= targetMicros * QUALITY_RESTORE_PERCENT;
+  startWindow();
+
+  if (settling) {
+    settling = false;
+    return false;
+  }
+
+  int previous = level;
+  if (shed) {
+    quietWindows = 0;
+    if (level < NUM_QUALITY_LEVELS - 1) level++;
+  } else if (quiet) {
+    if (++quietWindows >= QUALITY_RESTORE_WINDOWS && level > 0) {
+      level--;
+      quietWindows = 0;
+    }
+  } else {
+    quietWindows = 0;
+  }
+
+  if (level == previous) return false;
+  settling = true;
+  return true;
+}
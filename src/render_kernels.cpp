@@ -0,0 +1,148 @@
+#include "render_kernels.h"
+
+extern CRGB* leds;
+extern void set_led(int16_t x, int16_t y, CRGB color);
+
+//=============================================================================
+// Geometries
+//=============================================================================
+
+// The loaded topology, looked up at run time
+struct RuntimeGeometry {
+  static int width() { return g_topology.getWidth(); }
+  static int columns() { return g_topology.getColumns(); }
+  static int index(int x, int y) { return g_topology.index(x, y); }
+  static int cellIndex(int pos, int px, int py) { return g_topology.index(pos * BLOCK_WIDTH + px, py); }
+};
+
+// One row of COLUMNS blocks, chained left to right and mounted normally
+template <int COLUMNS>
+struct RowGeometry {
+  static int width() { return COLUMNS * BLOCK_WIDTH; }
+  static int columns() { return COLUMNS; }
+  static int index(int x, int y) { return x / BLOCK_WIDTH * BLOCK_LEDS + y * BLOCK_WIDTH + x % BLOCK_WIDTH; }
+  static int cellIndex(int pos, int px, int py) { return pos * BLOCK_LEDS + py * BLOCK_WIDTH + px; }
+};
+
+//=============================================================================
+// Kernels
+//=============================================================================
+
+// Fixed cell at pos, shifted by offset columns. Every pixel of the cell is
+// written, lit or blank.
+template <class Geometry>
+static void writeCharacter(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset) {
+  const uint8_t* rows = font.glyphRows(character); // nullptr draws a blank cell
+
+  if (offset == 0 && pos < Geometry::columns()) {
+    // The whole cell is on the display
+    for (int py = 0; py < BLOCK_HEIGHT; py++) {
+      uint8_t mask = rows && py < font.height ? rows[py] : 0;
+      for (int px = 0; px < BLOCK_WIDTH; px++) {
+        leds[Geometry::cellIndex(pos, px, py)] = (mask >> px) & 1 ? color : CRGB(CRGB::Black);
+      }
+    }
+    return;
+  }
+
+  // Shifted cells drop the column at abs(offset) - 1 and clip at the edges
+  for (int py = 0; py < BLOCK_HEIGHT; py++) {
+    uint8_t mask = rows && py < font.height ? rows[py] : 0;
+    int adjusted_offset = 0;
+    for (int px = 0; px < BLOCK_WIDTH; px++) {
+      if (px == abs(offset)-1) continue;
+      if (offset < -1){
+        adjusted_offset = (px < abs(offset)-1) ? 1 : 0;
+      }
+      set_led(pos * BLOCK_WIDTH + px + offset + adjusted_offset, py, (mask >> px) & 1 ? color : CRGB(CRGB::Black));
+    }
+  }
+}
+
+// Fixed cell shifted down by y rows within the text row. Only lit pixels are written.
+template <class Geometry>
+static void writeCharacterRows(const Font& font, uint8_t character, uint16_t pos, int y, CRGB color) {
+  const uint8_t* rows = font.glyphRows(character);
+  if (!rows || pos >= Geometry::columns()) return;
+
+  int first = y < 0 ? -y : 0;
+  int last = BLOCK_HEIGHT - y < font.height ? BLOCK_HEIGHT - y : font.height;
+  for (int row = first; row < last; row++) {
+    for (uint8_t mask = rows[row]; mask; mask &= mask - 1) {
+      leds[Geometry::cellIndex(pos, __builtin_ctz(mask), row + y)] = color;
+    }
+  }
+}
+
+// Inked columns of a glyph from display column x, shifted down by y rows.
+// Only lit pixels are written. Returns the columns to the next glyph.
+template <class Geometry>
+static int drawGlyph(const Font& font, uint8_t character, int x, int y, CRGB color) {
+  const uint8_t* rows = font.glyphRows(character);
+  GlyphMetrics inked = font.measure(character);
+  int height = font.height < BLOCK_HEIGHT ? font.height : BLOCK_HEIGHT;
+
+  if (rows && y == 0 && x >= 0 && x + inked.width <= Geometry::width()) {
+    // Wholly on the display, so within the cell at x and the one after it
+    int cell = x / BLOCK_WIDTH;
+    int column = x % BLOCK_WIDTH;
+    for (int row = 0; row < height; row++) {
+      for (uint8_t mask = rows[row] >> inked.offset; mask; mask &= mask - 1) {
+        int px = column + __builtin_ctz(mask);
+        leds[px < BLOCK_WIDTH ? Geometry::cellIndex(cell, px, row) : Geometry::cellIndex(cell + 1, px - BLOCK_WIDTH, row)] = color;
+      }
+    }
+    return font.advance(character, FONT_GLYPH_GAP);
+  }
+
+  // Clipped: columns left of the display are dropped from the masks up front
+  int skip = x < 0 ? -x : 0;
+  for (int row = 0; rows && skip < inked.width && row < font.height; row++) {
+    int py = row + y;
+    if (py < 0 || py >= BLOCK_HEIGHT) continue;
+    for (uint8_t mask = rows[row] >> (inked.offset + skip); mask; mask &= mask - 1) {
+      int px = x + skip + __builtin_ctz(mask);
+      if (px >= Geometry::width()) break;
+      set_led(px, py, color);
+    }
+  }
+  return font.advance(character, FONT_GLYPH_GAP);
+}
+
+//=============================================================================
+// Kernel sets
+//=============================================================================
+
+#define GEOMETRY_KERNELS(name, geometry) \
+  { name, writeCharacter<geometry>, writeCharacterRows<geometry>, drawGlyph<geometry> }
+
+static const RenderKernels RUNTIME_KERNELS = GEOMETRY_KERNELS("runtime", RuntimeGeometry);
+
+static const int FIXED_COLUMNS[] = { 8, 16, 32, 64 };
+static const RenderKernels FIXED_KERNELS[] = {
+  GEOMETRY_KERNELS("row8", RowGeometry<8>),
+  GEOMETRY_KERNELS("row16", RowGeometry<16>),
+  GEOMETRY_KERNELS("row32", RowGeometry<32>),
+  GEOMETRY_KERNELS("row64", RowGeometry<64>)
+};
+
+const RenderKernels* g_renderKernels = &RUNTIME_KERNELS;
+
+const RenderKernels& RenderKernels::runtime() {
+  return RUNTIME_KERNELS;
+}
+
+const RenderKernels& RenderKernels::select(const Topology& topology) {
+  if (!ENABLE_FIXED_GEOMETRY || topology.getBlockRows() != 1) return RUNTIME_KERNELS;
+
+  // Orientation letters can turn blocks around; only a plain row will do
+  for (int y = 0; y < topology.getHeight(); y++) {
+    for (int x = 0; x < topology.getWidth(); x++) {
+      if (topology.index(x, y) != x / BLOCK_WIDTH * BLOCK_LEDS + y * BLOCK_WIDTH + x % BLOCK_WIDTH) return RUNTIME_KERNELS;
+    }
+  }
+  for (size_t i = 0; i < sizeof(FIXED_COLUMNS) / sizeof(FIXED_COLUMNS[0]); i++) {
+    if (topology.getColumns() == FIXED_COLUMNS[i]) return FIXED_KERNELS[i];
+  }
+  return RUNTIME_KERNELS;
+}
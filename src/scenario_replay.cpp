@@ -0,0 +1,243 @@
+#include "scenario_replay.h"
+#include "virtual_clock.h"
+#include "performance_monitor.h"  // For LatencyHistogram
+#include "task_runner.h"
+#if !defined(ESP32)
+  #include <linux/perf_event.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  #include <string.h>
+  #include <chrono>
+#endif
+
+//=============================================================================
+// Scenarios
+//=============================================================================
+
+// Through every transition, each press also randomizing the color mode
+static const ScenarioEvent TRANSITION_CYCLE_EVENTS[] = {
+  { 10000, InputEvent::SHORT_PRESS },
+  { 20000, InputEvent::SHORT_PRESS },
+  { 30000, InputEvent::SHORT_PRESS },
+  { 40000, InputEvent::SHORT_PRESS },
+  { 50000, InputEvent::SHORT_PRESS },
+};
+
+// Text -> Space -> Color Show -> Test Patterns
+static const ScenarioEvent MODE_TOUR_EVENTS[] = {
+  { 15000, InputEvent::LONG_PRESS },
+  { 30000, InputEvent::LONG_PRESS },
+  { 45000, InputEvent::LONG_PRESS },
+};
+
+#define SCENARIO_EVENTS(events) events, (int)(sizeof(events) / sizeof(events[0]))
+
+static const Scenario SCENARIOS[] = {
+  { "smooth_scroll", DisplayMode::TEXT_CONTENT, TransitionType::SMOOTH_SCROLL, ColorMode::WORD_BASED, 0, nullptr, 0 },
+  { "character_scroll", DisplayMode::TEXT_CONTENT, TransitionType::CHARACTER_SCROLL, ColorMode::RAINBOW_SCROLL, 0, nullptr, 0 },
+  { "line_slide", DisplayMode::TEXT_CONTENT, TransitionType::LINE_SLIDE, ColorMode::SINGLE_COLOR, 1, nullptr, 0 },
+  { "cursor_wipe", DisplayMode::TEXT_CONTENT, TransitionType::CURSOR_WIPE, ColorMode::RANDOM_WORDS, 1, nullptr, 0 },
+  { "transition_cycle", DisplayMode::TEXT_CONTENT, TransitionType::SMOOTH_SCROLL, ColorMode::WORD_BASED, 0, SCENARIO_EVENTS(TRANSITION_CYCLE_EVENTS) },
+  { "space_animation", DisplayMode::SPACE_ANIMATION, TransitionType::SMOOTH_SCROLL, ColorMode::WORD_BASED, 0, nullptr, 0 },
+  { "mode_tour", DisplayMode::TEXT_CONTENT, TransitionType::CHARACTER_SCROLL, ColorMode::WORD_BASED, 0, SCENARIO_EVENTS(MODE_TOUR_EVENTS) },
+};
+
+#define NUM_SCENARIOS (int)(sizeof(SCENARIOS) / sizeof(SCENARIOS[0]))
+
+//=============================================================================
+// Work Counter
+//=============================================================================
+
+#if defined(ESP32)
+static const char* workUnit() { return "cycles"; }
+static uint32_t readWork() { return ESP.getCycleCount(); }
+#else
+// Retired user-space instructions of this thread, if the kernel lets us count them
+static int instructionCounter = -2; // -2 until opened, -1 when unavailable
+
+static void openWorkCounter() {
+  if (instructionCounter != -2) return;
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  instructionCounter = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static const char* workUnit() {
+  openWorkCounter();
+  return instructionCounter >= 0 ? "instructions" : "ns";
+}
+
+static uint32_t readWork() {
+  uint64_t count = 0;
+  if (instructionCounter >= 0 && read(instructionCounter, &count, sizeof(count)) == sizeof(count)) {
+    return (uint32_t)count;
+  }
+  // The real clock - micros() is virtual while a scenario runs
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+//=============================================================================
+// Replay
+//=============================================================================
+
+ScenarioReplay::ScenarioReplay(DisplayController& controller)
+  : controller(controller), savedMode(DisplayMode::TEXT_CONTENT), savedTransition(TransitionType::SMOOTH_SCROLL),
+    savedStory(0), savedColorMode(ColorMode::WORD_BASED), savedInlineInput(false), savedInlineReporting(false),
+    scenario(nullptr), nextEvent(0), startMillis(0), lastWork(0) {
+}
+
+uint32_t ScenarioReplay::hashFrame(uint32_t hash) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(leds);
+  for (size_t i = 0; i < sizeof(CRGB) * g_topology.getLedCount(); i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+bool ScenarioReplay::open() {
+  if (!VirtualClock::available()) {
+    Serial.println("Replay needs the virtual clock; use a diagnostics or native build (platformio.ini)");
+    return false;
+  }
+  ContentManager& content = controller.getContentManager();
+  savedMode = controller.getDisplayMode();
+  savedTransition = controller.getTransitionType();
+  savedStory = content.getCurrentStoryIndex();
+  savedColorMode = content.getColorMode();
+  savedInlineInput = controller.getInlineInput();
+  savedInlineReporting = controller.getInlineReporting();
+  savedFonts.clear();
+  for (int i = 0; i < content.getStoryCount(); i++) {
+    savedFonts.push_back(content.getStoryFontId(i));
+  }
+
+  // The physical button and the periodic report would make runs differ
+  controller.setInlineInput(false);
+  controller.setInlineReporting(false);
+  suspend_output(true);
+  return true;
+}
+
+void ScenarioReplay::close() {
+  ContentManager& content = controller.getContentManager();
+  suspend_output(false);
+  for (int i = 0; i < (int)savedFonts.size(); i++) {
+    content.setStoryFont(i, savedFonts[i]);
+  }
+  content.selectStory(savedStory);
+  content.setColorMode(savedColorMode);
+  controller.setTransitionType(savedTransition);
+  controller.setDisplayMode(savedMode);
+  controller.reset();
+  controller.setInlineInput(savedInlineInput);
+  controller.setInlineReporting(savedInlineReporting);
+  randomSeed(analogRead(A0) + millis());
+  random16_set_seed(random(65536));
+}
+
+void ScenarioReplay::start(const Scenario& scenario, uint64_t clockMicros) {
+  ContentManager& content = controller.getContentManager();
+  this->scenario = &scenario;
+  nextEvent = 0;
+
+  // Identical starting state: time, random numbers, story, colors, mode
+  VirtualClock::start(clockMicros);
+  randomSeed(SCENARIO_SEED);
+  random16_set_seed(SCENARIO_SEED);
+  for (int i = 0; i < content.getStoryCount(); i++) {
+    content.setStoryFont(i, DEFAULT_FONT);
+  }
+  content.selectStory(scenario.story);
+  content.setColorMode(scenario.colorMode);
+  controller.setTransitionType(scenario.transition);
+  controller.setDisplayMode(scenario.mode);
+  controller.reset();
+  startMillis = millis();
+}
+
+unsigned long ScenarioReplay::elapsed() const {
+  return (uint32_t)(millis() - startMillis);
+}
+
+bool ScenarioReplay::frame() {
+  unsigned long now = elapsed();
+  while (nextEvent < scenario->eventCount && scenario->events[nextEvent].atMillis <= now) {
+    controller.handleInput(scenario->events[nextEvent++].input);
+  }
+
+  uint32_t before = readWork();
+  bool modeRan = controller.update();
+  lastWork = readWork() - before;
+
+  // A rendered frame holds the LED output for its wire time; otherwise skip
+  // straight to the next visible change, stopping at the next scripted press
+  unsigned long step = modeRan ? SCENARIO_FRAME_MICROS : 1000;
+  long untilWake = (int32_t)(controller.getNextWakeTime() - millis());
+  if (untilWake > 0 && (unsigned long)untilWake * 1000 > step) {
+    step = (unsigned long)untilWake * 1000;
+  }
+  if (nextEvent < scenario->eventCount) {
+    unsigned long untilEvent = (scenario->events[nextEvent].atMillis - now) * 1000;
+    if (untilEvent < step) step = untilEvent;
+  }
+  VirtualClock::advance(step);
+  return modeRan;
+}
+
+void ScenarioReplay::stop() {
+  VirtualClock::stop();
+}
+
+int ScenarioReplay::getScenarioCount() {
+  return NUM_SCENARIOS;
+}
+
+const Scenario& ScenarioReplay::getScenario(int index) {
+  return SCENARIOS[index];
+}
+
+bool ScenarioReplay::run() {
+  if (!open()) return false;
+  Serial.println("=== SCENARIO REPLAY BEGIN ===");
+  for (int i = 0; i < NUM_SCENARIOS; i++) {
+    replay(SCENARIOS[i]);
+    Task::sleep(1); // Let the io task drain the log between scenarios
+  }
+  Serial.println("=== SCENARIO REPLAY END ===");
+  close();
+  return true;
+}
+
+void ScenarioReplay::replay(const Scenario& scenario) {
+  LatencyHistogram perFrame;
+  uint64_t totalWork = 0;
+  unsigned long frames = 0;
+  uint32_t frameHash = FRAME_HASH_SEED;
+
+  start(scenario);
+  while (elapsed() < SCENARIO_DURATION_MILLIS) {
+    bool modeRan = frame();
+    totalWork += lastWork;
+    if (modeRan) {
+      frames++;
+      perFrame.record(lastWork);
+      frameHash = hashFrame(frameHash);
+    }
+  }
+  unsigned long simulated = elapsed();
+  stop();
+
+  Serial.printf("{\"scenario\":\"%s\",\"unit\":\"%s\",\"seed\":%lu,\"simulated_ms\":%lu,\"frames\":%lu,"
+                "\"per_frame_p50\":%lu,\"per_frame_p90\":%lu,\"per_frame_max\":%lu,"
+                "\"per_minute\":%llu,\"frame_hash\":\"%08lx\"}\n",
+                scenario.name, workUnit(), SCENARIO_SEED, simulated, frames,
+                perFrame.percentile(0.5f), perFrame.percentile(0.9f), perFrame.max,
+                (unsigned long long)(totalWork * 60000 / simulated), (unsigned long)frameHash);
+}
@@ -0,0 +1,60 @@
+#include "segment_renderer.h"
+#include "topology.h"
+
+SegmentRenderer g_segmentRenderer;
+
+SegmentRenderer::Worker::Worker() : task("segment", workerStep, this) {
+}
+
+SegmentRenderer::SegmentRenderer() : workers(nullptr), started(false), enabled(ENABLE_SEGMENT_RENDERING) {
+}
+
+bool SegmentRenderer::begin() {
+  if (started) return true;
+  if (!workers) workers = new Worker[SEGMENT_WORKERS];
+  for (int i = 0; i < SEGMENT_WORKERS; i++) {
+    if (!workers[i].task.start(TASK_DEFAULT_STACK_SIZE, SEGMENT_WORKER_PRIORITY, SEGMENT_WORKER_CORE)) return false;
+  }
+  started = true;
+  return true;
+}
+
+int SegmentRenderer::segmentsFor(int width) const {
+  if (!started || !enabled) return 1;
+  int segments = width / SEGMENT_MIN_COLUMNS;
+  if (segments > SEGMENT_WORKERS + 1) segments = SEGMENT_WORKERS + 1;
+  return segments > 1 ? segments : 1;
+}
+
+void SegmentRenderer::render(Kernel kernel, void* context, int width) {
+  int segments = segmentsFor(width);
+  if (segments == 1) {
+    kernel(context, 0, width);
+    return;
+  }
+
+  // Boundaries fall between blocks; worker s - 1 takes segment s
+  int blocks = width / BLOCK_WIDTH;
+  for (int s = 1; s < segments; s++) {
+    Job job = { kernel, context, blocks * s / segments * BLOCK_WIDTH,
+                s == segments - 1 ? width : blocks * (s + 1) / segments * BLOCK_WIDTH };
+    workers[s - 1].jobs.push(job, TASK_WAIT_FOREVER);
+  }
+  kernel(context, 0, blocks / segments * BLOCK_WIDTH);
+
+  uint8_t finished;
+  for (int s = 1; s < segments; s++) {
+    workers[s - 1].done.pop(finished, TASK_WAIT_FOREVER);
+  }
+}
+
+void SegmentRenderer::workerStep(Task& task) {
+  Worker& worker = *static_cast<Worker*>(task.getArg());
+  Job job;
+  if (!worker.jobs.pop(job, TASK_WAIT_FOREVER)) return;
+  task.beginWork();
+  job.kernel(job.context, job.xBegin, job.xEnd);
+  task.endWork();
+  uint8_t finished = 1;
+  worker.done.push(finished, TASK_WAIT_FOREVER);
+}
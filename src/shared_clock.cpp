@@ -0,0 +1,179 @@
+#include "shared_clock.h"
+
+// Global shared clock instance (null when clock sync is disabled)
+SharedClock* g_sharedClock = nullptr;
+
+static void putU64(uint8_t* out, uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    out[i] = (value >> (8 * i)) & 0xFF;
+  }
+}
+
+static uint64_t getU64(const uint8_t* in) {
+  uint64_t value = 0;
+  for (int i = 7; i >= 0; i--) {
+    value = (value << 8) | in[i];
+  }
+  return value;
+}
+
+//=============================================================================
+// LoopbackClockTransport Implementation
+//=============================================================================
+
+bool LoopbackClockTransport::send(const uint8_t* data, size_t length) {
+  if (!peer) return false;
+  Packet packet;
+  packet.deliverAt = micros() + delayMicros;
+  packet.data.assign(data, data + length);
+  peer->inbox.push_back(packet);
+  return true;
+}
+
+int LoopbackClockTransport::receive(uint8_t* data, size_t capacity) {
+  if (inbox.empty()) return 0;
+  const Packet& packet = inbox.front();
+  if ((int32_t)(micros() - packet.deliverAt) < 0) return 0; // Still in flight
+
+  size_t length = packet.data.size() < capacity ? packet.data.size() : capacity;
+  memcpy(data, packet.data.data(), length);
+  inbox.erase(inbox.begin());
+  return length;
+}
+
+//=============================================================================
+// UdpClockTransport Implementation
+//=============================================================================
+
+#if defined(ESP32)
+#include <WiFi.h>
+
+bool UdpClockTransport::ensureStarted() {
+  if (WiFi.status() != WL_CONNECTED) {
+    started = false;
+    return false;
+  }
+  if (!started) {
+    started = udp.begin(port);
+  }
+  return started;
+}
+
+bool UdpClockTransport::send(const uint8_t* data, size_t length) {
+  if (!ensureStarted()) return false;
+  // A master that went quiet may have moved; find it again
+  if (!master && hasPeer && ++unanswered > CLOCK_SYNC_UNANSWERED_LIMIT) {
+    hasPeer = false;
+  }
+  IPAddress target = hasPeer ? lastPeer : IPAddress(255, 255, 255, 255);
+  if (!udp.beginPacket(target, port)) return false;
+  udp.write(data, length);
+  return udp.endPacket();
+}
+
+int UdpClockTransport::receive(uint8_t* data, size_t capacity) {
+  if (!ensureStarted()) return 0;
+  if (udp.parsePacket() <= 0) return 0;
+  int length = udp.read(data, capacity);
+  if (length <= 0) return 0;
+  // The master replies to whoever asked; a follower talks to whoever replied
+  uint8_t type = length > 2 ? data[2] : 0;
+  if (type == (master ? CLOCK_SYNC_REQUEST : CLOCK_SYNC_RESPONSE)) {
+    lastPeer = udp.remoteIP();
+    hasPeer = true;
+    unanswered = 0;
+  }
+  return length;
+}
+#endif
+
+//=============================================================================
+// SharedClock Implementation
+//=============================================================================
+
+SharedClock::SharedClock(ClockTransport* transport, bool master)
+  : transport(transport), master(master), synced(false), sequence(0),
+    offsetMicros(0), roundTripMicros(0), lastRequestTime(0), sampleCount(0), sampleIndex(0) {
+}
+
+uint64_t SharedClock::localMicros() {
+#if defined(ESP32)
+  return esp_timer_get_time();
+#else
+  // Extend the 32-bit counter; valid as long as we are polled once per wrap (~71 min)
+  static uint32_t lastLow = 0;
+  static uint64_t high = 0;
+  uint32_t low = micros();
+  if (low < lastLow) high += 1ULL << 32;
+  lastLow = low;
+  return high | low;
+#endif
+}
+
+uint64_t SharedClock::nowMicros() const {
+  return localMicros() + offsetMicros;
+}
+
+void SharedClock::update() {
+  if (!transport) return;
+
+  uint8_t packet[CLOCK_SYNC_PACKET_SIZE];
+  int length;
+  while ((length = transport->receive(packet, sizeof(packet))) > 0) {
+    uint64_t receivedAt = localMicros();
+    if (length == CLOCK_SYNC_PACKET_SIZE && packet[0] == CLOCK_SYNC_MAGIC_0 && packet[1] == CLOCK_SYNC_MAGIC_1) {
+      handlePacket(packet, receivedAt);
+    }
+  }
+
+  if (!master && (uint32_t)(millis() - lastRequestTime) >= CLOCK_SYNC_INTERVAL) {
+    sendRequest();
+    lastRequestTime = millis();
+  }
+}
+
+void SharedClock::sendRequest() {
+  uint8_t packet[CLOCK_SYNC_PACKET_SIZE] = {0};
+  packet[0] = CLOCK_SYNC_MAGIC_0;
+  packet[1] = CLOCK_SYNC_MAGIC_1;
+  packet[2] = CLOCK_SYNC_REQUEST;
+  packet[3] = ++sequence;
+  putU64(packet + 4, localMicros());
+  transport->send(packet, sizeof(packet));
+}
+
+void SharedClock::handlePacket(const uint8_t* packet, uint64_t receivedAt) {
+  if (packet[2] == CLOCK_SYNC_REQUEST && master) {
+    // Echo the client timestamp with our receive and transmit times
+    uint8_t response[CLOCK_SYNC_PACKET_SIZE];
+    memcpy(response, packet, CLOCK_SYNC_PACKET_SIZE);
+    response[2] = CLOCK_SYNC_RESPONSE;
+    putU64(response + 12, receivedAt);
+    putU64(response + 20, localMicros());
+    transport->send(response, sizeof(response));
+  } else if (packet[2] == CLOCK_SYNC_RESPONSE && !master && packet[3] == sequence) {
+    int64_t t0 = getU64(packet + 4);
+    int64_t t1 = getU64(packet + 12);
+    int64_t t2 = getU64(packet + 20);
+    int64_t t3 = receivedAt;
+    int64_t roundTrip = (t3 - t0) - (t2 - t1);
+    if (roundTrip < 0) roundTrip = 0;
+    addSample(((t1 - t0) + (t2 - t3)) / 2, roundTrip);
+  }
+}
+
+void SharedClock::addSample(int64_t offset, unsigned long roundTrip) {
+  samples[sampleIndex].offset = offset;
+  samples[sampleIndex].roundTrip = roundTrip;
+  sampleIndex = (sampleIndex + 1) % CLOCK_SYNC_WINDOW;
+  if (sampleCount < CLOCK_SYNC_WINDOW) sampleCount++;
+
+  // Lowest round trip in the window has the least asymmetric queueing delay
+  int best = 0;
+  for (int i = 1; i < sampleCount; i++) {
+    if (samples[i].roundTrip < samples[best].roundTrip) best = i;
+  }
+  offsetMicros = samples[best].offset;
+  roundTripMicros = samples[best].roundTrip;
+  synced = true;
+}
@@ -0,0 +1,142 @@
+#include "soak_test.h"
+#include "allocation_tracker.h"
+#include "task_runner.h"
+#include <limits.h>
+
+#define MILLIS_PER_HOUR 3600000UL
+
+SoakTest::SoakTest(DisplayController& controller) : controller(controller) {
+}
+
+void SoakTest::pressButtons(unsigned long elapsed, unsigned long& nextMode, unsigned long& nextPress) {
+  if (elapsed >= nextMode) {
+    controller.handleInput(InputEvent::LONG_PRESS);
+    nextMode += SOAK_MODE_INTERVAL_MILLIS;
+  }
+  if (elapsed >= nextPress) {
+    // Elsewhere a short press would return to text mode and cut the mode cycle short
+    if (controller.getDisplayMode() == DisplayMode::TEXT_CONTENT) {
+      controller.handleInput(InputEvent::SHORT_PRESS);
+    }
+    nextPress += SOAK_PRESS_INTERVAL_MILLIS;
+  }
+}
+
+SoakTest::Checkpoint SoakTest::takeCheckpoint(int hours, unsigned long frames, const LatencyHistogram& perFrame,
+                                              unsigned long maxGap) {
+  Checkpoint checkpoint;
+  checkpoint.liveAllocations = AllocationTracker::total().allocations - AllocationTracker::frees();
+  checkpoint.freeHeap = AllocationTracker::freeHeap();
+  checkpoint.largestBlock = AllocationTracker::largestFreeBlock();
+  checkpoint.perFrameMedian = perFrame.percentile(0.5f);
+
+  Serial.printf("{\"soak_hours\":%d,\"millis\":%lu,\"frames\":%lu,\"live_allocations\":%lu,\"free_heap\":%lu,"
+                "\"min_free_heap\":%lu,\"largest_block\":%lu,\"per_frame_p50\":%lu,\"max_frame_gap_ms\":%lu}\n",
+                hours, millis(), frames, checkpoint.liveAllocations, checkpoint.freeHeap,
+                AllocationTracker::minimumFreeHeap(), checkpoint.largestBlock, checkpoint.perFrameMedian, maxGap);
+  return checkpoint;
+}
+
+bool SoakTest::run() {
+  ScenarioReplay replay(controller);
+  Scenario scenario = { "soak", DisplayMode::TEXT_CONTENT, TransitionType::SMOOTH_SCROLL, ColorMode::WORD_BASED, 0, nullptr, 0 };
+
+  if (!replay.open()) return false;
+  Serial.println("=== SOAK TEST BEGIN ===");
+  replay.start(scenario, (0x100000000ULL - SOAK_WRAP_LEAD_MILLIS) * 1000);
+
+  const unsigned long duration = SOAK_DURATION_HOURS * MILLIS_PER_HOUR;
+  unsigned long nextCheckpoint = SOAK_CHECKPOINT_HOURS * MILLIS_PER_HOUR;
+  unsigned long nextMode = SOAK_MODE_INTERVAL_MILLIS;
+  unsigned long nextPress = SOAK_PRESS_INTERVAL_MILLIS;
+
+  // Per checkpoint window
+  LatencyHistogram perFrame;
+  unsigned long frames = 0;
+  unsigned long maxGap = 0;
+
+  // Whole run
+  Checkpoint first = {};
+  Checkpoint last = {};
+  bool haveFirst = false;
+  // Cheapest window median of each half - one noisy window cannot fail the run
+  unsigned long earlyCost = ULONG_MAX;
+  unsigned long lateCost = ULONG_MAX;
+  unsigned long lastFrameAt = 0;
+  unsigned long longestGap = 0;
+  unsigned long previousMillis = millis();
+  bool crossedWrap = false;
+
+  while (true) {
+    unsigned long elapsed = replay.elapsed();
+    if (elapsed >= nextCheckpoint) {
+      // A mode that has stopped rendering altogether counts up to the checkpoint
+      unsigned long sinceFrame = elapsed - lastFrameAt;
+      if (sinceFrame > maxGap) maxGap = sinceFrame;
+      if (sinceFrame > longestGap) longestGap = sinceFrame;
+      last = takeCheckpoint(nextCheckpoint / MILLIS_PER_HOUR, frames, perFrame, maxGap);
+      if (!haveFirst) {
+        first = last;
+        haveFirst = true;
+      }
+      unsigned long& halfCost = nextCheckpoint <= duration / 2 ? earlyCost : lateCost;
+      if (last.perFrameMedian < halfCost) halfCost = last.perFrameMedian;
+      perFrame.clear();
+      frames = 0;
+      maxGap = 0;
+      if (nextCheckpoint >= duration) break;
+      nextCheckpoint += SOAK_CHECKPOINT_HOURS * MILLIS_PER_HOUR;
+      Task::sleep(1); // Let the io task drain the log
+    }
+
+    pressButtons(elapsed, nextMode, nextPress);
+    if (replay.frame()) {
+      frames++;
+      perFrame.record(replay.getLastWork());
+      unsigned long gap = elapsed - lastFrameAt;
+      if (gap > maxGap) maxGap = gap;
+      if (gap > longestGap) longestGap = gap;
+      lastFrameAt = elapsed;
+    }
+
+    unsigned long now = millis();
+    if (now < previousMillis) crossedWrap = true;
+    previousMillis = now;
+  }
+  replay.stop();
+
+  // Compare the last checkpoint with the first, which already includes warm-up
+  char failures[96] = "";
+  long allocationGrowth = (long)(last.liveAllocations - first.liveAllocations);
+  long costDrift = earlyCost > 0 && earlyCost != ULONG_MAX && lateCost != ULONG_MAX
+    ? ((long)lateCost - (long)earlyCost) * 100 / (long)earlyCost : 0;
+  if (allocationGrowth > SOAK_MAX_ALLOCATION_GROWTH) {
+    strncat(failures, " allocations", sizeof(failures) - strlen(failures) - 1);
+  }
+  // Hosts cannot report free heap; the summary says the checks were skipped
+  bool heapChecked = first.freeHeap > 0;
+  if (heapChecked && (long)(first.freeHeap - last.freeHeap) > SOAK_MAX_HEAP_LOSS) {
+    strncat(failures, " free_heap", sizeof(failures) - strlen(failures) - 1);
+  }
+  if (heapChecked && (long)(first.largestBlock - last.largestBlock) > SOAK_MAX_HEAP_LOSS) {
+    strncat(failures, " fragmentation", sizeof(failures) - strlen(failures) - 1);
+  }
+  if (!crossedWrap) {
+    strncat(failures, " millis_wrap", sizeof(failures) - strlen(failures) - 1);
+  }
+  if (longestGap > SOAK_MAX_FRAME_GAP_MILLIS) {
+    strncat(failures, " stalled", sizeof(failures) - strlen(failures) - 1);
+  }
+  if (abs(costDrift) > SOAK_MAX_COST_DRIFT_PERCENT) {
+    strncat(failures, " frame_cost", sizeof(failures) - strlen(failures) - 1);
+  }
+  bool passed = failures[0] == '\0';
+
+  Serial.printf("{\"status\":\"%s\",\"failures\":\"%s\",\"simulated_hours\":%d,\"crossed_millis_wrap\":%s,"
+                "\"heap_checks\":\"%s\",\"max_frame_gap_ms\":%lu,\"allocation_growth\":%ld,\"frame_cost_drift_percent\":%ld}\n",
+                passed ? "pass" : "fail", passed ? "" : failures + 1, SOAK_DURATION_HOURS,
+                crossedWrap ? "true" : "false", heapChecked ? "checked" : "skipped", longestGap, allocationGrowth, costDrift);
+  Serial.println("=== SOAK TEST END ===");
+  replay.close();
+  return passed;
+}
@@ -1,14 +1,19 @@
 #include "space_animation.h"
 #include "performance_monitor.h"
 #include "content_manager.h"
+#include "topology.h"
+#include "segment_renderer.h"
 
 // External references
 extern PerformanceMonitor* g_perfMonitor;
-extern CRGB leds[];
+extern CRGB* leds;
+
+// Timing point
+DEFINE_TIMER(space_render);
 
 SpaceAnimation::SpaceAnimation() 
   : maxStars(SPACE_STAR_COUNT), maxComets(SPACE_COMET_COUNT), 
-    maxPlanets(SPACE_PLANET_COUNT), maxSpaceships(SPACE_SPACESHIP_COUNT),
+    maxPlanets(SPACE_PLANET_COUNT), maxSpaceships(SPACE_SPACESHIP_COUNT), activeStars(SPACE_STAR_COUNT), nebulaEnabled(true),
     parallaxSpeed(SPACE_PARALLAX_SPEED), starSpeedMin(SPACE_STAR_SPEED_MIN), starSpeedMax(SPACE_STAR_SPEED_MAX),
     paused(false), lastUpdate(0), cometSpawnTimer(0), planetSpawnTimer(0), spaceshipSpawnTimer(0),
     nebularPhase(0), nebulaTimer(0) {
@@ -34,10 +39,13 @@ void SpaceAnimation::update() {
   if (paused) return;
   
   unsigned long currentTime = millis();
-  if (currentTime - lastUpdate < 16) return; // ~60 FPS limit
+  if ((uint32_t)(currentTime - lastUpdate) < 16) return; // ~60 FPS limit
   
   lastUpdate = currentTime;
-  
+  advance();
+}
+
+void SpaceAnimation::advance() {
   updateStars();
   updateComets();
   updatePlanets();
@@ -48,22 +56,23 @@ void SpaceAnimation::update() {
 void SpaceAnimation::render() {
   if (paused) return;
   
-  START_TIMER(space_render);
+  TIME_SCOPE(space_render);
   
-  FastLED.clear();
+  clear_frame();
   
   // Render in back-to-front order
-  renderNebula();    // Background nebula
+  if (nebulaEnabled) renderNebula(); // Background nebula
   renderStars();     // Starfield
   renderPlanets();   // Planets
   renderComets();    // Comets with trails
   renderSpaceships(); // Foreground spaceships
   
-  START_TIMER(led_show_space);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_space, g_perfMonitor->getMetrics().fastLEDShowTime);
-  
-  END_TIMER(space_render, g_perfMonitor->getMetrics().calculationTime);
+  show_frame();
+}
+
+void SpaceAnimation::setDetail(int starPercent, bool nebula) {
+  activeStars = maxStars * starPercent / 100;
+  nebulaEnabled = nebula;
 }
 
 void SpaceAnimation::reset() {
@@ -87,8 +96,8 @@ void SpaceAnimation::reset() {
 
 void SpaceAnimation::initializeStars() {
   for (int i = 0; i < maxStars; i++) {
-    stars[i].x = randomFloat(0, DISPLAY_WIDTH);
-    stars[i].y = randomFloat(0, DISPLAY_HEIGHT);
+    stars[i].x = randomFloat(0, displayWidth());
+    stars[i].y = randomFloat(0, displayHeight());
     stars[i].speed = randomFloat(starSpeedMin, starSpeedMax);
     stars[i].brightness = random(50, 255);
     stars[i].color = getStarColor(stars[i].brightness);
@@ -97,7 +106,8 @@ void SpaceAnimation::initializeStars() {
 }
 
 void SpaceAnimation::updateStars() {
-  for (auto& star : stars) {
+  for (int i = 0; i < activeStars; i++) {
+    Star& star = stars[i];
     if (!star.active) continue;
     
     // Move star left based on its speed
@@ -105,8 +115,8 @@ void SpaceAnimation::updateStars() {
     
     // Wrap around when star goes off screen
     if (star.x < 0) {
-      star.x = DISPLAY_WIDTH;
-      star.y = randomFloat(0, DISPLAY_HEIGHT);
+      star.x = displayWidth();
+      star.y = randomFloat(0, displayHeight());
       star.speed = randomFloat(starSpeedMin, starSpeedMax);
       star.brightness = random(50, 255);
       star.color = getStarColor(star.brightness);
@@ -124,7 +134,7 @@ void SpaceAnimation::updateComets() {
   unsigned long currentTime = millis();
   
   // Spawn new comets periodically
-  if (currentTime - cometSpawnTimer > SPACE_COMET_SPAWN_INTERVAL) {
+  if ((uint32_t)(currentTime - cometSpawnTimer) > SPACE_COMET_SPAWN_INTERVAL) {
     spawnComet();
     cometSpawnTimer = currentTime;
   }
@@ -137,8 +147,8 @@ void SpaceAnimation::updateComets() {
     comet.y += comet.speedY;
     
     // Remove comet if it goes off screen
-    if (comet.x < -10 || comet.x > DISPLAY_WIDTH + 10 || 
-        comet.y < -10 || comet.y > DISPLAY_HEIGHT + 10) {
+    if (comet.x < -10 || comet.x > displayWidth() + 10 || 
+        comet.y < -10 || comet.y > displayHeight() + 10) {
       comet.active = false;
     }
   }
@@ -148,7 +158,7 @@ void SpaceAnimation::updatePlanets() {
   unsigned long currentTime = millis();
   
   // Spawn new planets periodically
-  if (currentTime - planetSpawnTimer > SPACE_PLANET_SPAWN_INTERVAL) {
+  if ((uint32_t)(currentTime - planetSpawnTimer) > SPACE_PLANET_SPAWN_INTERVAL) {
     spawnPlanet();
     planetSpawnTimer = currentTime;
   }
@@ -171,7 +181,7 @@ void SpaceAnimation::updateSpaceships() {
   unsigned long currentTime = millis();
   
   // Spawn new spaceships periodically
-  if (currentTime - spaceshipSpawnTimer > SPACE_SPACESHIP_SPAWN_INTERVAL) {
+  if ((uint32_t)(currentTime - spaceshipSpawnTimer) > SPACE_SPACESHIP_SPAWN_INTERVAL) {
     spawnSpaceship();
     spaceshipSpawnTimer = currentTime;
   }
@@ -184,14 +194,14 @@ void SpaceAnimation::updateSpaceships() {
     spaceship.y += spaceship.speedY;
     
     // Animate spaceship frame
-    if (currentTime - spaceship.lastFrameUpdate > 200) {
+    if ((uint32_t)(currentTime - spaceship.lastFrameUpdate) > 200) {
       spaceship.frame = (spaceship.frame + 1) % 4;
       spaceship.lastFrameUpdate = currentTime;
     }
     
     // Remove spaceship if it goes off screen
-    if (spaceship.x < -10 || spaceship.x > DISPLAY_WIDTH + 10 || 
-        spaceship.y < -5 || spaceship.y > DISPLAY_HEIGHT + 5) {
+    if (spaceship.x < -10 || spaceship.x > displayWidth() + 10 || 
+        spaceship.y < -5 || spaceship.y > displayHeight() + 5) {
       spaceship.active = false;
     }
   }
@@ -199,7 +209,7 @@ void SpaceAnimation::updateSpaceships() {
 
 void SpaceAnimation::updateNebula() {
   unsigned long currentTime = millis();
-  if (currentTime - nebulaTimer > 100) {
+  if ((uint32_t)(currentTime - nebulaTimer) > 100) {
     nebularPhase = (nebularPhase + 1) % 255;
     nebulaTimer = currentTime;
   }
@@ -209,8 +219,8 @@ void SpaceAnimation::spawnComet() {
   for (auto& comet : comets) {
     if (!comet.active) {
       // All comets spawn from right edge and move horizontally left at different speeds
-      comet.x = DISPLAY_WIDTH + 5;
-      comet.y = randomFloat(0, DISPLAY_HEIGHT);
+      comet.x = displayWidth() + 5;
+      comet.y = randomFloat(0, displayHeight());
       comet.speedX = randomFloat(-4.0f, -1.5f); // Faster horizontal speeds
       comet.speedY = 0; // Pure horizontal movement
       
@@ -225,8 +235,8 @@ void SpaceAnimation::spawnComet() {
 void SpaceAnimation::spawnPlanet() {
   for (auto& planet : planets) {
     if (!planet.active) {
-      planet.x = DISPLAY_WIDTH + 10;
-      planet.y = randomFloat(1, DISPLAY_HEIGHT - 3);
+      planet.x = displayWidth() + 10;
+      planet.y = randomFloat(1, displayHeight() - 3);
       planet.speed = randomFloat(0.3f, 1.0f);
       planet.size = random(2, 5);
       planet.color = getPlanetColor();
@@ -245,11 +255,11 @@ void SpaceAnimation::spawnSpaceship() {
         spaceship.x = -5;
         spaceship.speedX = randomFloat(2.0f, 4.0f); // Faster speeds
       } else {
-        spaceship.x = DISPLAY_WIDTH + 5;
+        spaceship.x = displayWidth() + 5;
         spaceship.speedX = randomFloat(-4.0f, -2.0f); // Faster speeds
       }
       
-      spaceship.y = randomFloat(1, DISPLAY_HEIGHT - 2);
+      spaceship.y = randomFloat(1, displayHeight() - 2);
       spaceship.speedY = 0; // Pure horizontal movement
       spaceship.frame = 0;
       spaceship.color = getSpaceshipColor();
@@ -261,7 +271,8 @@ void SpaceAnimation::spawnSpaceship() {
 }
 
 void SpaceAnimation::renderStars() {
-  for (const auto& star : stars) {
+  for (int i = 0; i < activeStars; i++) {
+    const Star& star = stars[i];
     if (!star.active) continue;
     drawPixel(star.x, star.y, star.color, star.brightness);
   }
@@ -280,7 +291,7 @@ void SpaceAnimation::renderComets() {
       float tailY = comet.y - (comet.speedY * i * 0.3f);
       uint8_t tailBrightness = 255 * (comet.trailLength - i) / comet.trailLength;
       
-      if (tailX >= 0 && tailX < DISPLAY_WIDTH && tailY >= 0 && tailY < DISPLAY_HEIGHT) {
+      if (tailX >= 0 && tailX < displayWidth() && tailY >= 0 && tailY < displayHeight()) {
         drawPixel(tailX, tailY, comet.color, tailBrightness);
       }
     }
@@ -314,13 +325,20 @@ void SpaceAnimation::renderSpaceships() {
 }
 
 void SpaceAnimation::renderNebula() {
-  // Subtle background nebula effect
-  for (int x = 0; x < DISPLAY_WIDTH; x += 4) {
-    for (int y = 0; y < DISPLAY_HEIGHT; y += 2) {
+  // Subtle background nebula effect, in segments on wide displays
+  g_segmentRenderer.render(renderNebulaSegment, this, displayWidth());
+}
+
+void SpaceAnimation::renderNebulaSegment(void* context, int xBegin, int xEnd) {
+  SpaceAnimation& space = *static_cast<SpaceAnimation*>(context);
+  uint8_t nebularPhase = space.nebularPhase;
+  // Every fourth column from the left edge, wherever the segment starts
+  for (int x = (xBegin + 3) / 4 * 4; x < xEnd; x += 4) {
+    for (int y = 0; y < displayHeight(); y += 2) {
       uint8_t intensity = abs(sin((x + nebularPhase) * 0.1f) * cos((y + nebularPhase) * 0.15f)) * 30;
       if (intensity > 15) {
         CRGB nebulaColor = CHSV(160 + (nebularPhase % 60), 200, intensity);
-        drawPixel(x, y, nebulaColor, intensity);
+        space.drawPixel(x, y, nebulaColor, intensity);
       }
     }
   }
@@ -355,15 +373,10 @@ void SpaceAnimation::drawPixel(float x, float y, CRGB color, uint8_t brightness)
   int pixelY = (int)y;
   
   // Use the same LED addressing as the main set_led function
-  if (pixelX >= 0 && pixelX < NUM_CHARS * 5 && pixelY >= 0 && pixelY < 7) {
-    int offset = pixelX / 5 * 30;
-    int ledIndex = pixelY * 5 + pixelX + offset;
-    int totalLeds = 5 * 7 * NUM_CHARS; // Calculate total LEDs
-    if (ledIndex >= 0 && ledIndex < totalLeds) {
-      CRGB scaledColor = color;
-      scaledColor.fadeToBlackBy(255 - brightness);
-      leds[ledIndex] = scaledColor;
-    }
+  if (pixelX >= 0 && pixelX < displayWidth() && pixelY >= 0 && pixelY < displayHeight()) {
+    CRGB scaledColor = color;
+    scaledColor.fadeToBlackBy(255 - brightness);
+    leds[g_topology.index(pixelX, pixelY)] = scaledColor;
   }
 }
 
@@ -415,7 +428,7 @@ void SpaceAnimation::drawSpaceship(float x, float y, uint8_t frame, CRGB color)
 }
 
 bool SpaceAnimation::isInBounds(float x, float y) const {
-  return x >= 0 && x < DISPLAY_WIDTH && y >= 0 && y < DISPLAY_HEIGHT;
+  return x >= 0 && x < displayWidth() && y >= 0 && y < displayHeight();
 }
 
 float SpaceAnimation::randomFloat(float min, float max) {
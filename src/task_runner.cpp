@@ -0,0 +1,57 @@
+#include "task_runner.h"
+
+#if !defined(ESP32)
+// Host threads have no built-in names; each Task thread sets its own
+static thread_local const char* threadTaskName = "main";
+#endif
+
+Task::Task(const char* name, Step step, void* arg)
+  : step(step), arg(arg), workStart(0) {
+  stats.name = name;
+}
+
+bool Task::start(uint32_t stackSize, int priority, int core) {
+#if defined(ESP32)
+  BaseType_t affinity = core == TASK_ANY_CORE ? tskNO_AFFINITY : core;
+  return xTaskCreatePinnedToCore(entry, stats.name, stackSize, this, priority, nullptr, affinity) == pdPASS;
+#else
+  // Host threads have no priorities or core affinity; the scheduler decides
+  std::thread(entry, this).detach();
+  return true;
+#endif
+}
+
+void Task::endWork() {
+  unsigned long elapsed = (uint32_t)(micros() - workStart);
+  stats.busyMicros += elapsed;
+  stats.iterations++;
+  if (elapsed > stats.maxIterationMicros) {
+    stats.maxIterationMicros = elapsed;
+  }
+}
+
+void Task::sleep(unsigned long ms) {
+#if defined(ESP32)
+  vTaskDelay(pdMS_TO_TICKS(ms));
+#else
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+}
+
+const char* Task::currentName() {
+#if defined(ESP32)
+  return pcTaskGetName(nullptr);
+#else
+  return threadTaskName;
+#endif
+}
+
+void Task::entry(void* self) {
+  Task* task = static_cast<Task*>(self);
+#if !defined(ESP32)
+  threadTaskName = task->stats.name;
+#endif
+  for (;;) {
+    task->step(*task);
+  }
+}
@@ -0,0 +1,150 @@
+#include "telemetry.h"
+#include "performance_monitor.h"
+#include "quality_controller.h"
+#include <string.h>
+#include <stdio.h>
+
+static inline void putU16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static inline void putU32(uint8_t* out, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    out[i] = (value >> (8 * i)) & 0xFF;
+  }
+}
+
+TelemetryEncoder::TelemetryEncoder() : sequence(0) {
+}
+
+size_t TelemetryEncoder::beginSection(uint8_t type, uint8_t* out, size_t pos, size_t capacity, size_t length) {
+  // Leave room for the checksum; 0 means the section does not fit
+  if (pos + TELEMETRY_SECTION_HEADER_SIZE + length + 1 > capacity) return 0;
+  out[pos] = type;
+  putU16(out + pos + 1, length);
+  return pos + TELEMETRY_SECTION_HEADER_SIZE;
+}
+
+size_t TelemetryEncoder::encode(const PerformanceSnapshot& snapshot, uint8_t* out, size_t capacity) {
+  if (capacity < TELEMETRY_HEADER_SIZE + 1) return 0;
+  const PerformanceMetrics& window = snapshot.metrics;
+  size_t pos = TELEMETRY_HEADER_SIZE;
+
+  // Window counters
+  pos = beginSection(TELEMETRY_SECTION_COUNTERS, out, pos, capacity, 32);
+  if (pos == 0) return 0;
+  uint32_t counters[8] = {
+    (uint32_t)snapshot.interval, (uint32_t)window.frameCount, (uint32_t)window.visualUpdateCount,
+    (uint32_t)window.charactersScrolled, (uint32_t)window.idleTime, (uint32_t)window.framesOverBudget,
+    (uint32_t)(window.frameCount > 0 ? window.minFrameTime : 0), (uint32_t)window.maxFrameTime
+  };
+  for (int i = 0; i < 8; i++) {
+    putU32(out + pos, counters[i]);
+    pos += 4;
+  }
+
+  // Distributions
+  pos = writeHistogram(TELEMETRY_HISTOGRAM_FRAME, window.frameTimes, out, pos, capacity);
+  if (pos == 0) return 0;
+  pos = writeHistogram(TELEMETRY_HISTOGRAM_RENDER, window.renderTimes, out, pos, capacity);
+  if (pos == 0) return 0;
+  pos = writeHistogram(TELEMETRY_HISTOGRAM_SHOW, window.showTimes, out, pos, capacity);
+  if (pos == 0) return 0;
+
+  // Every timer and task that did something this window
+  for (int i = 0; i < TimerMetric::getCount(); i++) {
+    const TimerSample& sample = snapshot.timers[i];
+    if (sample.calls == 0) continue;
+    pos = writeNamed(TELEMETRY_SECTION_TIMER, TimerMetric::get(i)->getName(),
+                     sample.totalMicros, sample.calls, sample.maxMicros, out, pos, capacity);
+    if (pos == 0) return 0;
+  }
+  for (int i = 0; i < snapshot.taskCount; i++) {
+    const TaskStats& task = snapshot.tasks[i];
+    pos = writeNamed(TELEMETRY_SECTION_TASK, task.name,
+                     task.busyMicros, task.iterations, task.maxIterationMicros, out, pos, capacity);
+    if (pos == 0) return 0;
+  }
+
+  // Heap use, then allocations per mode and transition
+  pos = beginSection(TELEMETRY_SECTION_HEAP, out, pos, capacity, 24);
+  if (pos == 0) return 0;
+  uint32_t heap[6] = {
+    (uint32_t)snapshot.allocations.allocations, (uint32_t)snapshot.allocations.bytes, (uint32_t)snapshot.frees,
+    (uint32_t)window.allocatingFrames, (uint32_t)snapshot.freeHeap, (uint32_t)snapshot.largestFreeBlock
+  };
+  for (int i = 0; i < 6; i++) {
+    putU32(out + pos, heap[i]);
+    pos += 4;
+  }
+  for (int i = 0; i < window.allocationSiteCount; i++) {
+    const AllocationSite& site = window.allocationSites[i];
+    char name[TELEMETRY_MAX_NAME_LENGTH + 1];
+    snprintf(name, sizeof(name), "%s%s%s", site.mode, site.transition[0] ? "/" : "", site.transition);
+    pos = writeNamed(TELEMETRY_SECTION_ALLOCATION_SITE, name, site.frames, site.allocations, site.bytes, out, pos, capacity);
+    if (pos == 0) return 0;
+  }
+
+  // Adaptive quality level
+  pos = beginSection(TELEMETRY_SECTION_QUALITY, out, pos, capacity, 6);
+  if (pos == 0) return 0;
+  out[pos++] = (uint8_t)window.qualityLevel;
+  out[pos++] = NUM_QUALITY_LEVELS - 1;
+  putU32(out + pos, window.qualityChanges);
+  pos += 4;
+
+  // Header and checksum
+  out[0] = TELEMETRY_MAGIC_0;
+  out[1] = TELEMETRY_MAGIC_1;
+  out[2] = TELEMETRY_VERSION;
+  putU16(out + 3, sequence++);
+  putU16(out + 5, pos - TELEMETRY_HEADER_SIZE);
+
+  uint8_t checksum = 0;
+  for (size_t i = 0; i < pos; i++) {
+    checksum ^= out[i];
+  }
+  out[pos++] = checksum;
+  return pos;
+}
+
+size_t TelemetryEncoder::writeHistogram(uint8_t id, const LatencyHistogram& histogram, uint8_t* out, size_t pos, size_t capacity) {
+  // Sparse: most buckets are empty in any one window
+  int used = 0;
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    if (histogram.counts[i] > 0) used++;
+  }
+
+  pos = beginSection(TELEMETRY_SECTION_HISTOGRAM, out, pos, capacity, 7 + used * 3);
+  if (pos == 0) return 0;
+  out[pos] = id;
+  out[pos + 1] = HISTOGRAM_LINEAR_BUCKETS;
+  out[pos + 2] = HISTOGRAM_SUB_BUCKET_BITS;
+  putU32(out + pos + 3, histogram.max);
+  pos += 7;
+
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    if (histogram.counts[i] == 0) continue;
+    out[pos] = i;
+    putU16(out + pos + 1, histogram.counts[i]);
+    pos += 3;
+  }
+  return pos;
+}
+
+size_t TelemetryEncoder::writeNamed(uint8_t type, const char* name, uint32_t a, uint32_t b, uint32_t c,
+                                    uint8_t* out, size_t pos, size_t capacity) {
+  size_t nameLength = strlen(name);
+  if (nameLength > TELEMETRY_MAX_NAME_LENGTH) nameLength = TELEMETRY_MAX_NAME_LENGTH;
+
+  pos = beginSection(type, out, pos, capacity, 1 + nameLength + 12);
+  if (pos == 0) return 0;
+  out[pos] = nameLength;
+  memcpy(out + pos + 1, name, nameLength);
+  pos += 1 + nameLength;
+  putU32(out + pos, a);
+  putU32(out + pos + 4, b);
+  putU32(out + pos + 8, c);
+  return pos + 12;
+}
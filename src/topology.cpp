@@ -0,0 +1,131 @@
+#include "topology.h"
+#include <stdlib.h>
+#if defined(ESP32)
+  #include <Preferences.h>
+#endif
+
+#define TOPOLOGY_PREFERENCES "sign"
+#define TOPOLOGY_PREFERENCES_KEY "topology"
+
+Topology::Topology() : blocksPerRow(0), blockRows(0), width(0), height(0), outputs(1) {
+  description[0] = '\0';
+  load(TOPOLOGY_DEFAULT);
+}
+
+static bool parseOrientation(char letter, BlockOrientation& orientation) {
+  switch (letter) {
+    case 'N': orientation = BlockOrientation::NORMAL; return true;
+    case 'R': orientation = BlockOrientation::ROTATED_180; return true;
+    case 'M': orientation = BlockOrientation::MIRRORED; return true;
+    case 'F': orientation = BlockOrientation::FLIPPED; return true;
+    default: return false;
+  }
+}
+
+bool Topology::load(const char* text) {
+  if (!text || strlen(text) >= TOPOLOGY_DESCRIPTION_LENGTH) return false;
+
+  // <blocks per row>x<rows>[s][:<orientations>][/<outputs>]
+  char* end;
+  long across = strtol(text, &end, 10);
+  if (end == text || *end != 'x') return false;
+  const char* rowsText = end + 1;
+  long rows = strtol(rowsText, &end, 10);
+  if (end == rowsText) return false;
+  bool serpentine = *end == 's';
+  if (serpentine) end++;
+  const char* orientations = "N";
+  int orientationCount = 1;
+  if (*end == ':') {
+    orientations = end + 1;
+    orientationCount = strcspn(orientations, "/");
+    end += 1 + orientationCount;
+  }
+  long outputCount = 1;
+  if (*end == '/') {
+    const char* outputsText = end + 1;
+    outputCount = strtol(outputsText, &end, 10);
+    if (end == outputsText) return false;
+  }
+  if (*end != '\0') return false;
+
+  // Sides are bounded before they are multiplied, so no product can overflow a long
+  if (across < 1 || rows < 1 || across > TOPOLOGY_MAX_WIDTH / BLOCK_WIDTH ||
+      rows > TOPOLOGY_MAX_HEIGHT / BLOCK_HEIGHT || across * rows * BLOCK_LEDS > TOPOLOGY_MAX_LEDS ||
+      outputCount < 1 || outputCount > TOPOLOGY_MAX_OUTPUTS || outputCount > across * rows) {
+    return false;
+  }
+  BlockOrientation orientation;
+  if (orientationCount == 0) return false;
+  for (int i = 0; i < orientationCount; i++) {
+    if (!parseOrientation(orientations[i], orientation)) return false;
+  }
+
+  // Valid - build the map, block by block in chain order
+  blocksPerRow = across;
+  blockRows = rows;
+  width = across * BLOCK_WIDTH;
+  height = rows * BLOCK_HEIGHT;
+  outputs = outputCount;
+  map.assign(width * height, 0);
+  for (int block = 0; block < across * rows; block++) {
+    int blockY = block / across;
+    int blockX = block % across;
+    if (serpentine && blockY % 2 == 1) blockX = across - 1 - blockX;
+    parseOrientation(orientations[block < orientationCount ? block : orientationCount - 1], orientation);
+
+    for (int row = 0; row < BLOCK_HEIGHT; row++) {
+      for (int column = 0; column < BLOCK_WIDTH; column++) {
+        int physicalRow = row;
+        int physicalColumn = column;
+        if (orientation == BlockOrientation::ROTATED_180 || orientation == BlockOrientation::FLIPPED) {
+          physicalRow = BLOCK_HEIGHT - 1 - row;
+        }
+        if (orientation == BlockOrientation::ROTATED_180 || orientation == BlockOrientation::MIRRORED) {
+          physicalColumn = BLOCK_WIDTH - 1 - column;
+        }
+        int x = blockX * BLOCK_WIDTH + column;
+        int y = blockY * BLOCK_HEIGHT + row;
+        map[y * width + x] = block * BLOCK_LEDS + physicalRow * BLOCK_WIDTH + physicalColumn;
+      }
+    }
+  }
+  strcpy(description, text);
+  return true;
+}
+
+void Topology::loadAtBoot() {
+#if defined(ESP32)
+  Preferences preferences;
+  if (preferences.begin(TOPOLOGY_PREFERENCES, true)) {
+    String stored = preferences.getString(TOPOLOGY_PREFERENCES_KEY, "");
+    preferences.end();
+    if (stored.length() > 0) {
+      if (load(stored.c_str())) return;
+      Serial.printf("Stored topology \"%s\" is not valid, using %s\n", stored.c_str(), TOPOLOGY_DEFAULT);
+    }
+  }
+#endif
+  load(TOPOLOGY_DEFAULT);
+}
+
+bool Topology::save(const char* text) {
+  Topology check;
+  if (!check.load(text)) {
+    Serial.printf("Topology \"%s\" is not valid\n", text);
+    return false;
+  }
+#if defined(ESP32)
+  Preferences preferences;
+  if (!preferences.begin(TOPOLOGY_PREFERENCES, false)) return false;
+  bool stored = preferences.putString(TOPOLOGY_PREFERENCES_KEY, text) > 0;
+  preferences.end();
+  if (!stored) return false;
+  Serial.printf("Topology %s (%dx%d pixels, %d LEDs on %d output(s)) stored, restart to apply\n",
+                text, check.getWidth(), check.getHeight(), check.getLedCount(), check.getOutputCount());
+  return true;
+#else
+  Serial.printf("Topology %s is valid; host builds have nowhere to store it\n", text);
+  return false;
+#endif
+}
@@ -0,0 +1,133 @@
+#include "trace_buffer.h"
+#include "task_runner.h"
+#if !defined(ESP32)
+  #include <stdio.h>
+#endif
+
+// Global trace buffer (null unless tracing is enabled)
+TraceBuffer* g_traceBuffer = nullptr;
+
+TraceBuffer::TraceBuffer(size_t capacity)
+  : capacity(capacity), next(0), recording(true) {
+  events = new TraceEvent[capacity];
+  for (int i = 0; i < TRACE_MAX_TRACKS; i++) {
+    tracks[i] = nullptr;
+  }
+}
+
+TraceBuffer::~TraceBuffer() {
+  delete[] events;
+}
+
+void TraceBuffer::record(const char* name, unsigned long start, unsigned long end) {
+  unsigned long duration = (uint32_t)(end - start);
+  if (!recording || duration < TRACE_MIN_SPAN_MICROS) return;
+
+  // Claiming the slot is the only shared write, so concurrent tasks never collide
+  uint32_t slot = next.fetch_add(1) % capacity;
+  TraceEvent& event = events[slot];
+  event.start = start;
+  event.duration = duration;
+  event.name = name;
+  event.track = trackForCurrentTask();
+}
+
+uint8_t TraceBuffer::trackForCurrentTask() {
+  // Task names are stable pointers, so they double as track keys
+  const char* name = Task::currentName();
+  for (int i = 0; i < TRACE_MAX_TRACKS; i++) {
+    const char* expected = nullptr;
+    if (tracks[i].load() == name || tracks[i].compare_exchange_strong(expected, name) || expected == name) {
+      return i;
+    }
+  }
+  return TRACE_MAX_TRACKS - 1; // Out of tracks - share the last one
+}
+
+size_t TraceBuffer::size() const {
+  uint32_t written = next.load();
+  return written < capacity ? written : capacity;
+}
+
+unsigned long TraceBuffer::getOverwritten() const {
+  uint32_t written = next.load();
+  return written > capacity ? written - capacity : 0;
+}
+
+size_t TraceBuffer::oldestIndex() const {
+  uint32_t written = next.load();
+  return written > capacity ? written % capacity : 0;
+}
+
+void TraceBuffer::clear() {
+  next = 0;
+}
+
+//=============================================================================
+// Chrome Trace Output
+//=============================================================================
+
+int TraceBuffer::formatEvent(char* out, size_t length, const TraceEvent& event, uint32_t origin) const {
+  // Timestamps are relative to the oldest span, which also hides the micros() wrap
+  int n = snprintf(out, length, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lu,\"dur\":%lu,\"pid\":1,\"tid\":%d}",
+                   event.name, (unsigned long)(uint32_t)(event.start - origin), (unsigned long)event.duration, event.track);
+  return n < (int)length ? n : length - 1;
+}
+
+int TraceBuffer::formatTrackName(char* out, size_t length, int track) const {
+  int n = snprintf(out, length, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                   track, tracks[track].load());
+  return n < (int)length ? n : length - 1;
+}
+
+void TraceBuffer::writeJson(LineWriter write, void* context) {
+  bool wasRecording = recording;
+  recording = false;
+  Task::sleep(2); // Let a span being written on another task land
+
+  char line[192];
+  size_t count = size();
+  size_t first = oldestIndex();
+  uint32_t origin = count > 0 ? events[first].start : 0;
+  int trackCount = 0;
+  while (trackCount < TRACE_MAX_TRACKS && tracks[trackCount].load()) trackCount++;
+
+  write("{\"traceEvents\":[", context);
+  for (int i = 0; i < trackCount; i++) {
+    int n = formatTrackName(line, sizeof(line) - 1, i);
+    if (i + 1 < trackCount || count > 0) strcpy(line + n, ",");
+    write(line, context);
+  }
+  for (size_t i = 0; i < count; i++) {
+    int n = formatEvent(line, sizeof(line) - 1, events[(first + i) % capacity], origin);
+    if (i + 1 < count) strcpy(line + n, ",");
+    write(line, context);
+  }
+  write("],\"displayTimeUnit\":\"ms\"}", context);
+
+  recording = wasRecording;
+}
+
+static void writeSerialLine(const char* line, void* context) {
+  Serial.printf("%s\n", line);
+}
+
+void TraceBuffer::dumpToSerial() {
+  Serial.printf("=== TRACE BEGIN (%u events, %lu overwritten) ===\n", (unsigned)size(), getOverwritten());
+  writeJson(writeSerialLine, nullptr);
+  Serial.printf("=== TRACE END ===\n");
+}
+
+#if !defined(ESP32)
+static void writeFileLine(const char* line, void* context) {
+  fprintf(static_cast<FILE*>(context), "%s\n", line);
+}
+
+bool TraceBuffer::dumpToFile(const char* path) {
+  FILE* file = fopen(path, "w");
+  if (!file) return false;
+  writeJson(writeFileLine, file);
+  fclose(file);
+  return true;
+}
+#endif
@@ -1,140 +1,391 @@
 #include "transition_effects.h"
 #include "performance_monitor.h"
 #include "font.h"
+#include "idle_sleep.h"
+#include "segment_renderer.h"
 #include <memory>
 
 // External references from main.cpp
-extern CRGB leds[];
+extern CRGB* leds;
 extern PerformanceMonitor* g_perfMonitor;
 
 // Forward declaration of utility functions that will be in main.cpp
-void set_led(uint8_t x, uint8_t y, CRGB color);
-void write_character(uint8_t character, uint8_t pos, CRGB color, int offset = 0);
+void set_led(int16_t x, int16_t y, CRGB color);
+void write_character(const Font& font, uint8_t character, uint16_t pos, CRGB color, int offset = 0);
+int draw_glyph(const Font& font, uint8_t character, int x, int y, CRGB color);
+void write_character_rows(const Font& font, uint8_t character, uint16_t pos, int y, CRGB color);
+
+// Proportional layout from the left edge: the first count characters of a line
+// in content colors, drawn y rows down. Returns the column after the last one.
+static int drawProportionalLine(const String& line, int count, int y, ContentManager& content) {
+  const Font& font = content.getCurrentFont();
+  int x = 0;
+  for (int pos = 0; pos < count && pos < (int)line.length() && x < g_topology.getWidth(); pos++) {
+    x += draw_glyph(font, line.c_str()[pos], x, y, content.getCharacterColor(line, pos, 0));
+  }
+  return x;
+}
+
+// Timing points
+DEFINE_TIMER(scroll);
+DEFINE_TIMER(scroll_sync);
+DEFINE_TIMER(calc);
 
 //=============================================================================
 // SmoothScrollTransition Implementation
 //=============================================================================
 
 SmoothScrollTransition::SmoothScrollTransition() 
-  : TransitionEffect(true), scrollPosition(0), startPause(true), lastUpdateTime(0) {
+  : TransitionEffect(true), scrollPosition(0), startPause(true), lastUpdateTime(0), lastStepTime(0),
+    smoothStep(0), newlineStep(0), stepStride(1), sharedClock(nullptr), columnOffset(0), lastSyncedColumn(0) {
+}
+
+void SmoothScrollTransition::setSharedClock(SharedClock* clock, int offset) {
+  sharedClock = clock;
+  columnOffset = offset;
+  lastSyncedColumn = 0;
 }
 
 void SmoothScrollTransition::reset() {
   scrollPosition = 0;
   startPause = true;
   lastUpdateTime = millis();
+  lastStepTime = lastUpdateTime - SMOOTH_SCROLL_INTERVAL; // First sub-step is due at once
+  smoothStep = 0;
+  newlineStep = 0;
+}
+
+unsigned long SmoothScrollTransition::getNextUpdateTime(const ContentManager& content) const {
+  unsigned long now = millis();
+  if (sharedClock && sharedClock->isSynced()) {
+    // Wake when the shared scroll reaches its next whole column
+    uint64_t pixelsPerSecond = CPS_TARGET * SYNC_SCROLL_CHAR_PITCH;
+    uint64_t shared = sharedClock->nowMicros();
+    uint64_t nextColumn = shared * pixelsPerSecond / 1000000 + 1;
+    uint64_t nextColumnAt = (nextColumn * 1000000 + pixelsPerSecond - 1) / pixelsPerSecond;
+    return now + (unsigned long)((nextColumnAt - shared + 999) / 1000);
+  }
+  if (newlineStep > 0) {
+    return lastUpdateTime + NEWLINE_TRANSITION_INTERVAL;
+  }
+  // The next frame is due once the scroll has moved a whole stride
+  return lastStepTime + stepStride * SMOOTH_SCROLL_INTERVAL;
+}
+
+void SmoothScrollTransition::renderStep(ContentManager& content, int step) {
+  int length = content.getStoryLength();
+  int position = length > 0 ? (step / SMOOTH_SCROLL_STEPS) % length : 0;
+  renderScrollMessage(content, position, step % SMOOTH_SCROLL_STEPS);
 }
 
 bool SmoothScrollTransition::update(ContentManager& content) {
-  START_TIMER(scroll_op);
+  // Until the first sync the shared time is only the local clock; scroll on our own till then
+  if (sharedClock && sharedClock->isSynced()) {
+    return renderSynchronized(content);
+  }
+  
+  TIME_SCOPE(scroll);
   
   if (startPause) {
     showStartPauseEffect();
     startPause = false;
   }
   
-  // Handle newline transitions
-  if (content.hasNewlineAt(scrollPosition)) {
-    showNewlineTransition();
+  // Handle newline transitions - the matrix effect plays one frame per update
+  if (newlineStep == 0 && smoothStep == 0 && content.hasNewlineAt(scrollPosition)) {
+    newlineStep = 1;
+  }
+  
+  if (newlineStep > 0) {
+    unsigned long currentTime = millis();
+    if ((uint32_t)(currentTime - lastUpdateTime) >= NEWLINE_TRANSITION_INTERVAL) {
+      showNewlineStep(newlineStep);
+      newlineStep++;
+      lastUpdateTime = currentTime;
+    }
+    if (newlineStep < NEWLINE_TRANSITION_STEPS) {
+      return false;
+    }
+    
+    newlineStep = 0;
     scrollPosition = content.findNextPrintableChar(scrollPosition);
     startPause = true;
-    FastLED.clear();
-    END_TIMER(scroll_op, g_perfMonitor->getMetrics().scrollTime);
+    lastStepTime = millis() - SMOOTH_SCROLL_INTERVAL; // Scroll time resumes after the effect
+    clear_frame();
     return true;
   }
   
-  // Render current scroll position with smooth steps
-  renderScrollMessage(content, scrollPosition, true, 6);
+  // The scroll moves one sub-step per SMOOTH_SCROLL_INTERVAL whatever the
+  // frame rate; the stride only sets how far it moves between frames
+  unsigned long now = millis();
+  unsigned long due = (uint32_t)(now - lastStepTime) / SMOOTH_SCROLL_INTERVAL;
+  if (due < (unsigned long)stepStride) {
+    return false;
+  }
+  if (due > SMOOTH_SCROLL_STEPS) {
+    // Stalled for more than a character; carry on from here rather than jump
+    due = SMOOTH_SCROLL_STEPS;
+    lastStepTime = now;
+  } else {
+    lastStepTime += due * SMOOTH_SCROLL_INTERVAL;
+  }
+  
+  // Render the current sub-step, then move on by the time that passed
+  renderScrollMessage(content, scrollPosition, smoothStep);
+  smoothStep += due;
+  int columns = SMOOTH_SCROLL_STEPS;
+  if (PROPORTIONAL_TEXT) {
+    columns = content.getCurrentFont().advance(content.getCharacterAt(scrollPosition), FONT_GLYPH_GAP);
+  }
+  if (smoothStep < columns) {
+    return false;
+  }
+  // Steps that overshoot the character carry into the next one
+  smoothStep -= columns;
   
   // Advance position
   if (scrollPosition >= 0 && scrollPosition + 21 <= content.getStoryLength()) {
     scrollPosition++;
+    if (content.hasNewlineAt(scrollPosition)) smoothStep = 0; // The newline effect starts on a whole character
     if (g_perfMonitor) g_perfMonitor->incrementCharactersScrolled();
-    END_TIMER(scroll_op, g_perfMonitor->getMetrics().scrollTime);
     return true;
   } else {
     // End of story - trigger story change
     scrollPosition = 0;
     content.selectRandomStory();
     if (g_perfMonitor) g_perfMonitor->incrementCharactersScrolled();
-    END_TIMER(scroll_op, g_perfMonitor->getMetrics().scrollTime);
     return true;
   }
 }
 
-void SmoothScrollTransition::renderScrollMessage(ContentManager& content, int spos, bool scroll, int smoothSteps) {
-  // Simplified version of the original scroll_message_smooth function
-  START_TIMER(calc);
+void SmoothScrollTransition::renderScrollMessage(ContentManager& content, int spos, int step) {
+  // One sub-step of the original scroll_message_smooth function
+  TIME_SCOPE(calc);
+  
+  const String& story = content.getCurrentStory();
+  const Font& font = content.getCurrentFont();
+  int offset = -step;
+  
+  clear_frame();
+  if (PROPORTIONAL_TEXT) {
+    // Characters sit at their accumulated advances, shifted left by the step
+    int x = offset;
+    for (int pos = 0; spos + pos < (int)story.length() && x < g_topology.getWidth(); pos++) {
+      char thechar = story.c_str()[spos + pos];
+      if (thechar == '\n') thechar = ' ';
+      x += draw_glyph(font, thechar, x, 0, content.getCharacterColor(story, pos, spos));
+    }
+    show_frame();
+    return;
+  }
+  for (int pos = 0; pos <= g_topology.getColumns(); pos++) {
+    char thechar = ' ';
+    if (pos + spos < story.length()) {
+      thechar = story.c_str()[spos + pos];
+    }
+    
+    switch (thechar) {
+      case '\n':
+        thechar = ' ';
+        break;
+    }
+    
+    // Use configurable coloring mode
+    CRGB c = content.getCharacterColor(story, pos, spos);
+    write_character(font, thechar, pos, c, offset);
+  }
   
-  String story = content.getCurrentStory();
+  show_frame();
+}
+
+// Synchronized layout of one character: the columns it takes in the shared
+// scroll and the glyph columns it inks, laid out as a standalone sign lays
+// out the same text. Newlines take the place of a space.
+struct SyncedChar {
+  int pitch;  // Columns to the next character
+  int first;  // First inked glyph column
+  int ink;    // Inked columns
+};
+
+static SyncedChar syncedChar(const Font& font, uint8_t code) {
+  if (code == '\n') code = ' ';
+  SyncedChar layout;
+  if (PROPORTIONAL_TEXT) {
+    GlyphMetrics metrics = font.measure(code);
+    layout.pitch = font.advance(code, FONT_GLYPH_GAP);
+    layout.first = metrics.offset;
+    layout.ink = metrics.width;
+  } else {
+    layout.pitch = SYNC_SCROLL_CHAR_PITCH;
+    layout.first = 0;
+    layout.ink = font.width;
+  }
+  return layout;
+}
+
+// Columns a story and the gap after it take in the synchronized loop
+static uint64_t syncedStoryColumns(const ContentManager& content, int story) {
+  const String& text = content.getStory(story);
+  const Font& font = content.getStoryFont(story);
+  uint64_t columns = (uint64_t)SYNC_SCROLL_STORY_GAP * syncedChar(font, ' ').pitch;
+  for (unsigned int i = 0; i < text.length(); i++) {
+    columns += syncedChar(font, text.c_str()[i]).pitch;
+  }
+  return columns;
+}
+
+bool SmoothScrollTransition::renderSynchronized(ContentManager& content) {
+  // Every controller evaluates the same function of shared time, so text leaving
+  // the right edge of one chain enters the left edge of the next. All stories are
+  // laid end to end in one loop; the scroll moves at a fixed pixel rate, so the
+  // layout only has to agree between controllers, not match a character grid.
+  TIME_SCOPE(scroll_sync);
   
-  for (int step = 0; step < smoothSteps; step++) {
-    int offset = -step;
-    
-    FastLED.clear();
-    for (int pos = 0; pos <= NUM_CHARS; pos++) {
-      char thechar = ' ';
-      if (pos + spos < story.length()) {
-        thechar = story.c_str()[spos + pos];
-      }
-      
-      switch (thechar) {
-        case '\n':
-          thechar = ' ';
-          break;
+  int storyCount = content.getStoryCount();
+  if (storyCount == 0) return false;
+  
+  uint64_t loopColumns = 0;
+  for (int i = 0; i < storyCount; i++) {
+    loopColumns += syncedStoryColumns(content, i);
+  }
+  
+  uint64_t pixelsPerSecond = CPS_TARGET * SYNC_SCROLL_CHAR_PITCH;
+  uint64_t scrolled = sharedClock->nowMicros() * pixelsPerSecond / 1000000;
+  uint64_t column = (scrolled + columnOffset) % loopColumns;
+  
+  // Locate the story holding the first visible column, then the character
+  int story = 0;
+  uint64_t storyColumns = syncedStoryColumns(content, story);
+  while (column >= storyColumns) {
+    column -= storyColumns;
+    story = (story + 1) % storyCount;
+    storyColumns = syncedStoryColumns(content, story);
+  }
+  const String* text = &content.getStory(story);
+  const Font* font = &content.getStoryFont(story);
+  int charIndex = 0;
+  SyncedChar layout = syncedChar(*font, charIndex < (int)text->length() ? text->c_str()[0] : ' ');
+  while (column >= (uint64_t)layout.pitch) {
+    column -= layout.pitch;
+    charIndex++;
+    layout = syncedChar(*font, charIndex < (int)text->length() ? text->c_str()[charIndex] : ' ');
+  }
+  int charColumn = column;
+  
+  clear_frame();
+  for (int x = 0; x < g_topology.getWidth(); x++) {
+    // Characters past the end of the story are the blank gap
+    if (charIndex < (int)text->length() && charColumn < layout.ink) {
+      const uint8_t* glyph = font->glyph(text->c_str()[charIndex]);
+      if (glyph) {
+        CRGB c = content.getCharacterColor(*text, charIndex, 0);
+        for (int y = 0; y < font->height; y++) {
+          if (font->bit(glyph, layout.first + charColumn, y)) {
+            set_led(x, y, c);
+          }
+        }
       }
-      
-      // Use configurable coloring mode
-      CRGB c = content.getCharacterColor(story, pos, spos);
-      write_character(thechar, pos, c, offset);
     }
     
-    if (!scroll) break;
-    
-    START_TIMER(led_show);
-    FastLED.show();
-    END_FASTLED_TIMER(led_show, g_perfMonitor->getMetrics().fastLEDShowTime);
+    if (++charColumn < layout.pitch) continue;
+    charColumn = 0;
+    if (++charIndex >= (int)text->length() + SYNC_SCROLL_STORY_GAP) {
+      charIndex = 0;
+      story = (story + 1) % storyCount;
+      text = &content.getStory(story);
+      font = &content.getStoryFont(story);
+    }
+    layout = syncedChar(*font, charIndex < (int)text->length() ? text->c_str()[charIndex] : ' ');
   }
   
-  END_TIMER(calc, g_perfMonitor->getMetrics().calculationTime);
+  show_frame();
+  
+  // Count the characters that moved past since the last frame, at the pitch
+  // the pixel rate is set for
+  uint64_t advancedChars = scrolled / SYNC_SCROLL_CHAR_PITCH - lastSyncedColumn / SYNC_SCROLL_CHAR_PITCH;
+  bool advanced = lastSyncedColumn != 0 && advancedChars > 0;
+  if (advanced && g_perfMonitor) g_perfMonitor->incrementCharactersScrolled(advancedChars);
+  lastSyncedColumn = scrolled;
+  
+  return advanced;
 }
 
 void SmoothScrollTransition::showStartPauseEffect() {
   // Simplified version of the fade-in effect - just clear for now
-  FastLED.clear();
-  START_TIMER(led_show_pause);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_pause, g_perfMonitor->getMetrics().fastLEDShowTime);
-}
-
-void SmoothScrollTransition::showNewlineTransition() {
-  // Simplified matrix transition effect
-  for (int b = 1; b < 30; b++) {
-    FastLED.clear();
-    for (int x = 0; x < NUM_CHARS * 5; x++) {
-      for (int y = 0; y < 7; y++) {
-        set_led(x, y, CHSV(abs(sin(b / 10.0) * cos(x / 10.0)) * 255, 100 + random(b * 3, b * 4), 130 - b * 4 + random(20)));
-      }
+  clear_frame();
+  show_frame();
+}
+
+struct NewlineFrame {
+  int step;
+  uint32_t seed;
+};
+
+// Per-pixel noise in place of random(), so segments can draw in any order
+static uint32_t pixelNoise(uint32_t seed, int x, int y) {
+  uint32_t h = seed ^ (uint32_t)x * 0x9E3779B1UL ^ (uint32_t)y * 0x85EBCA77UL;
+  h ^= h >> 15;
+  h *= 0x2C1B3C6DUL;
+  h ^= h >> 12;
+  h *= 0x297A2D39UL;
+  return h ^ (h >> 15);
+}
+
+static void drawNewlineSegment(void* context, int xBegin, int xEnd) {
+  const NewlineFrame& frame = *static_cast<const NewlineFrame*>(context);
+  int b = frame.step;
+  float wave = abs(sin(b / 10.0));
+  for (int x = xBegin; x < xEnd; x++) {
+    uint8_t hue = wave * abs(cos(x / 10.0)) * 255;
+    for (int y = 0; y < g_topology.getHeight(); y++) {
+      uint32_t noise = pixelNoise(frame.seed, x, y);
+      set_led(x, y, CHSV(hue, 100 + b * 3 + (b > 0 ? noise % b : 0), 130 - b * 4 + (noise >> 16) % 20));
     }
-    START_TIMER(led_show_transition);
-    FastLED.show();
-    END_FASTLED_TIMER(led_show_transition, g_perfMonitor->getMetrics().fastLEDShowTime);
-    delay(20);
   }
 }
 
+void SmoothScrollTransition::drawNewlineFrame(int step, uint32_t seed) {
+  NewlineFrame frame = { step, seed };
+  g_segmentRenderer.render(drawNewlineSegment, &frame, g_topology.getWidth());
+}
+
+void SmoothScrollTransition::showNewlineStep(int b) {
+  // One frame of the simplified matrix transition effect; every pixel is drawn
+  drawNewlineFrame(b, random(0x7FFFFFFF));
+  show_frame();
+}
+
 //=============================================================================
 // CharacterScrollTransition Implementation  
 //=============================================================================
 
 CharacterScrollTransition::CharacterScrollTransition()
-  : TransitionEffect(true), scrollPosition(0), startPause(true), lastCharacterTime(0) {
+  : TransitionEffect(true), scrollPosition(0), startPause(true), lastCharacterTime(0),
+    renderedPosition(-1), renderedEpoch(0) {
 }
 
 void CharacterScrollTransition::reset() {
   scrollPosition = 0;
   startPause = true;
   lastCharacterTime = millis();
+  renderedPosition = -1;
+}
+
+unsigned long CharacterScrollTransition::getNextUpdateTime(const ContentManager& content) const {
+  if (startPause || renderedPosition != scrollPosition) {
+    return millis();
+  }
+  unsigned long targetDelay = 1000.0 / CPS_TARGET;
+  unsigned long deadline = lastCharacterTime + targetDelay;
+  if (content.getColorEpoch() != 0) {
+    deadline = earliestDeadline(deadline, content.getNextColorChange());
+  }
+  return deadline;
+}
+
+void CharacterScrollTransition::renderStep(ContentManager& content, int step) {
+  int length = content.getStoryLength();
+  renderScrollMessage(content, length > 0 ? step % length : 0);
 }
 
 bool CharacterScrollTransition::update(ContentManager& content) {
@@ -147,9 +398,9 @@ bool CharacterScrollTransition::update(ContentManager& content) {
   unsigned long currentTime = millis();
   unsigned long targetDelay = 1000.0 / CPS_TARGET;
   
-  if (currentTime - lastCharacterTime < targetDelay) {
+  if ((uint32_t)(currentTime - lastCharacterTime) < targetDelay) {
     // Just maintain current display
-    renderScrollMessage(content, scrollPosition);
+    showScrollPosition(content);
     return false;
   }
   
@@ -162,7 +413,7 @@ bool CharacterScrollTransition::update(ContentManager& content) {
     return true;
   }
   
-  renderScrollMessage(content, scrollPosition);
+  showScrollPosition(content);
   
   if (scrollPosition >= 0 && scrollPosition + 21 <= content.getStoryLength()) {
     scrollPosition++;
@@ -170,18 +421,39 @@ bool CharacterScrollTransition::update(ContentManager& content) {
     return true;
   } else {
     scrollPosition = 0;
+    renderedPosition = -1; // New story, even if the position matches
     content.selectRandomStory();
     if (g_perfMonitor) g_perfMonitor->incrementCharactersScrolled();
     return true;
   }
 }
 
+void CharacterScrollTransition::showScrollPosition(ContentManager& content) {
+  // Skip frames identical to the one already on the display
+  unsigned long epoch = content.getColorEpoch();
+  if (scrollPosition == renderedPosition && epoch == renderedEpoch) return;
+  renderScrollMessage(content, scrollPosition);
+  renderedPosition = scrollPosition;
+  renderedEpoch = epoch;
+}
+
 void CharacterScrollTransition::renderScrollMessage(ContentManager& content, int position) {
   // Fast single-step rendering
-  String story = content.getCurrentStory();
-  
-  FastLED.clear();
-  for (int pos = 0; pos <= NUM_CHARS; pos++) {
+  const String& story = content.getCurrentStory();
+  const Font& font = content.getCurrentFont();
+  
+  clear_frame();
+  if (PROPORTIONAL_TEXT) {
+    int x = 0;
+    for (int pos = 0; position + pos < (int)story.length() && x < g_topology.getWidth(); pos++) {
+      char thechar = story.c_str()[position + pos];
+      if (thechar == '\n') thechar = ' ';
+      x += draw_glyph(font, thechar, x, 0, content.getCharacterColor(story, pos, position));
+    }
+    show_frame();
+    return;
+  }
+  for (int pos = 0; pos <= g_topology.getColumns(); pos++) {
     char thechar = ' ';
     if (pos + position < story.length()) {
       thechar = story.c_str()[position + pos];
@@ -190,20 +462,17 @@ void CharacterScrollTransition::renderScrollMessage(ContentManager& content, int
     if (thechar == '\n') thechar = ' ';
     
     CRGB c = content.getCharacterColor(story, pos, position);
-    write_character(thechar, pos, c, 0);
+    write_character(font, thechar, pos, c, 0);
   }
   
-  START_TIMER(led_show);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show, g_perfMonitor->getMetrics().fastLEDShowTime);
+  show_frame();
 }
 
 void CharacterScrollTransition::showStartPauseEffect() {
   // Simplified version - just clear for now
-  FastLED.clear();
-  START_TIMER(led_show_pause);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_pause, g_perfMonitor->getMetrics().fastLEDShowTime);
+  renderedPosition = -1;
+  clear_frame();
+  show_frame();
 }
 
 //=============================================================================
@@ -211,17 +480,42 @@ void CharacterScrollTransition::showStartPauseEffect() {
 //=============================================================================
 
 LineSlideTransition::LineSlideTransition()
-  : TransitionEffect(true), currentLineIndex(0), lastLineTime(0), previousLine("") {
+  : TransitionEffect(true), currentLineIndex(0), lastLineTime(0), previousLine(""),
+    heldLineIndex(-2), heldEpoch(0), holdUntil(0), slideStep(-1), lastSlideTime(0) {
 }
 
 void LineSlideTransition::reset() {
   currentLineIndex = 0;
   lastLineTime = millis();
   previousLine = ""; // Clear previous line on reset
+  heldLineIndex = -2;
+  slideStep = -1;
+}
+
+unsigned long LineSlideTransition::getNextUpdateTime(const ContentManager& content) const {
+  if (slideStep >= 0) {
+    return lastSlideTime + LINE_SLIDE_INTERVAL;
+  }
+  if (heldLineIndex != currentLineIndex - 1) {
+    return millis(); // Hold not drawn yet, or the story ran out of lines
+  }
+  unsigned long deadline = holdUntil;
+  if (content.getColorEpoch() != 0) {
+    deadline = earliestDeadline(deadline, content.getNextColorChange());
+  }
+  return deadline;
+}
+
+void LineSlideTransition::renderStep(ContentManager& content, int step) {
+  // Every slide step between consecutive lines of the story
+  const std::vector<String>& lines = content.getCurrentLines();
+  if (lines.size() < 2) return;
+  int line = (step / 9) % (lines.size() - 1);
+  displaySlideStep(lines[line], lines[line + 1], step % 9, content);
 }
 
 bool LineSlideTransition::update(ContentManager& content) {
-  auto lines = content.getCurrentLines();
+  const std::vector<String>& lines = content.getCurrentLines();
   if (lines.empty()) {
     content.selectRandomStory();
     previousLine = ""; // Reset previous line
@@ -230,103 +524,109 @@ bool LineSlideTransition::update(ContentManager& content) {
   
   unsigned long currentTime = millis();
   
+  // Slide in progress - one step per interval, the display holds in between
+  if (slideStep >= 0) {
+    if ((uint32_t)(currentTime - lastSlideTime) < LINE_SLIDE_INTERVAL) {
+      return false;
+    }
+    
+    displaySlideStep(previousLine, slideLine, slideStep, content);
+    lastSlideTime = currentTime;
+    
+    int slideSteps = smoothTransitions ? 9 : 1; // Increased to accommodate 2-pixel gap
+    if (++slideStep < slideSteps) {
+      return false;
+    }
+    
+    slideStep = -1;
+    previousLine = slideLine;
+    currentLineIndex++;
+    if (g_perfMonitor) g_perfMonitor->incrementCharactersScrolled(slideLine.length());
+    return true;
+  }
+  
   if (currentLineIndex < lines.size()) {
-    String currentLine = lines[currentLineIndex];
+    const String& currentLine = lines[currentLineIndex];
     unsigned long lineDisplayTime = (currentLine.length() * 1000.0) / CPS_TARGET;
     
-    if (currentTime - lastLineTime >= lineDisplayTime) {
+    if ((uint32_t)(currentTime - lastLineTime) >= lineDisplayTime) {
       // Always show transition - for first line, slide from blank
-      displayLineSlide(previousLine, currentLine, content);
-      previousLine = currentLine;
-      currentLineIndex++;
+      heldLineIndex = -2;
+      slideLine = currentLine;
+      slideStep = 0;
+      lastSlideTime = currentTime - LINE_SLIDE_INTERVAL; // First step is due immediately
       lastLineTime = currentTime;
-      if (g_perfMonitor) g_perfMonitor->incrementCharactersScrolled(currentLine.length());
-      return true;
+      return update(content);
     } else {
-      // Still displaying current line - show the correct one
+      // Still displaying current line - draw it once, again only if colors moved on
+      holdUntil = lastLineTime + lineDisplayTime;
+      unsigned long epoch = content.getColorEpoch();
+      if (heldLineIndex == currentLineIndex - 1 && epoch == heldEpoch) {
+        return false;
+      }
+      heldLineIndex = currentLineIndex - 1;
+      heldEpoch = epoch;
+      
       if (currentLineIndex > 0) {
-        String displayLine = lines[currentLineIndex - 1]; // Show the line we're currently on
+        const String& displayLine = lines[currentLineIndex - 1]; // Show the line we're currently on
         maintainCurrentLine(displayLine, content);
       } else {
         // First line hasn't been revealed yet - keep display blank
-        FastLED.clear();
-        FastLED.show();
+        clear_frame();
+        show_frame();
       }
       return false;
     }
   } else {
     // End of lines, reset
     currentLineIndex = 0;
+    heldLineIndex = -2;
     previousLine = ""; // Reset previous line
     content.selectRandomStory();
     return true;
   }
 }
 
-void LineSlideTransition::displayLineSlide(const String& prevLine, const String& newLine, ContentManager& content) {
-  // Display line with true vertical slide transition (restored from original)
-  int slideSteps = smoothTransitions ? 9 : 1; // Increased to accommodate 2-pixel gap
+void LineSlideTransition::displaySlideStep(const String& prevLine, const String& newLine, int step, ContentManager& content) {
+  // One step of the vertical slide transition (restored from original)
+  clear_frame();
   
-  for (int step = 0; step < slideSteps; step++) {
-    FastLED.clear();
-    
-    // Calculate vertical positions with 2-pixel gap
-    int prevY = -step; // Previous line moves up and out
-    int newY = 9 - step; // New line moves up from bottom (7 + 2 pixel gap)
-    
-    // Draw previous line moving up
-    for (int pos = 0; pos < NUM_CHARS && pos < prevLine.length(); pos++) {
-      char prevChar = prevLine.c_str()[pos];
-      CRGB prevColor = content.getCharacterColor(prevLine, pos, 0); // Use content manager coloring
-      
-      // Draw character at shifted vertical position
-      for (int py = 0; py < 7; py++) {
-        int actualY = py + prevY;
-        if (actualY >= 0 && actualY < 7) { // Only draw if within bounds
-          for (int px = 0; px < 5; px++) {
-            if (FONT_BIT(prevChar - 16, px, py)) {
-              set_led(pos*5 + px, actualY, prevColor);
-            }
-          }
-        }
-      }
-    }
-    
-    // Draw new line moving up from bottom
-    for (int pos = 0; pos < NUM_CHARS && pos < newLine.length(); pos++) {
-      char newChar = newLine.c_str()[pos];
-      CRGB newColor = content.getCharacterColor(newLine, pos, 0); // Use content manager coloring
-      
-      // Draw character at shifted vertical position
-      for (int py = 0; py < 7; py++) {
-        int actualY = py + newY;
-        if (actualY >= 0 && actualY < 7) { // Only draw if within bounds
-          for (int px = 0; px < 5; px++) {
-            if (FONT_BIT(newChar - 16, px, py)) {
-              set_led(pos*5 + px, actualY, newColor);
-            }
-          }
-        }
-      }
-    }
-    
-    START_TIMER(led_show_slide);
-    FastLED.show();
-    END_FASTLED_TIMER(led_show_slide, g_perfMonitor->getMetrics().fastLEDShowTime);
-    delay(40);
+  // Calculate vertical positions with 2-pixel gap
+  int prevY = -step; // Previous line moves up and out
+  int newY = 9 - step; // New line moves up from bottom (7 + 2 pixel gap)
+  const Font& font = content.getCurrentFont();
+  
+  if (PROPORTIONAL_TEXT) {
+    drawProportionalLine(prevLine, prevLine.length(), prevY, content);
+    drawProportionalLine(newLine, newLine.length(), newY, content);
+    show_frame();
+    return;
+  }
+  
+  // Row-major glyphs: each visible row of a character is one mask
+  for (int pos = 0; pos < g_topology.getColumns() && pos < prevLine.length(); pos++) {
+    write_character_rows(font, prevLine.c_str()[pos], pos, prevY, content.getCharacterColor(prevLine, pos, 0));
+  }
+  for (int pos = 0; pos < g_topology.getColumns() && pos < newLine.length(); pos++) {
+    write_character_rows(font, newLine.c_str()[pos], pos, newY, content.getCharacterColor(newLine, pos, 0));
   }
+  
+  show_frame();
 }
 
 void LineSlideTransition::maintainCurrentLine(const String& line, ContentManager& content) {
-  FastLED.clear();
-  for (int pos = 0; pos < NUM_CHARS && pos < line.length(); pos++) {
+  clear_frame();
+  if (PROPORTIONAL_TEXT) {
+    drawProportionalLine(line, line.length(), 0, content);
+    show_frame();
+    return;
+  }
+  for (int pos = 0; pos < g_topology.getColumns() && pos < line.length(); pos++) {
     char thechar = line.c_str()[pos];
     CRGB c = content.getCharacterColor(line, pos, 0); // Use content manager coloring
-    write_character(thechar, pos, c);
+    write_character(content.getCurrentFont(), thechar, pos, c);
   }
-  START_TIMER(led_show_maintain);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_maintain, g_perfMonitor->getMetrics().fastLEDShowTime);
+  show_frame();
 }
 
 //=============================================================================
@@ -337,6 +637,22 @@ CursorWipeTransition::CursorWipeTransition()
   : TransitionEffect(true), currentLineIndex(0), lastLineTime(0) {
 }
 
+unsigned long CursorWipeTransition::getNextUpdateTime(const ContentManager& content) const {
+  switch (wipeState) {
+    case WIPE_REVEALING: return lastStateTime + 40;  // One character per step
+    case WIPE_FLASHING: return lastStateTime + 200;  // Cursor flash
+    default: return millis();                        // Next line starts now
+  }
+}
+
+void CursorWipeTransition::renderStep(ContentManager& content, int step) {
+  // Every reveal step of every line, cursor included
+  const std::vector<String>& lines = content.getCurrentLines();
+  if (lines.empty()) return;
+  const String& line = lines[(step / (g_topology.getColumns() + 1)) % lines.size()];
+  displayWipeStep(line, step % (g_topology.getColumns() + 1), content);
+}
+
 void CursorWipeTransition::reset() {
   currentLineIndex = 0;
   lastLineTime = millis();
@@ -348,7 +664,7 @@ void CursorWipeTransition::reset() {
 }
 
 bool CursorWipeTransition::update(ContentManager& content) {
-  auto lines = content.getCurrentLines();
+  const std::vector<String>& lines = content.getCurrentLines();
   if (lines.empty()) {
     content.selectRandomStory();
     return true;
@@ -358,12 +674,12 @@ bool CursorWipeTransition::update(ContentManager& content) {
   
   // Start with blank display for first line
   if (currentLineIndex == 0 && wipeState == WIPE_IDLE && lines.size() > 0) {
-    FastLED.clear();
-    FastLED.show();
+    clear_frame();
+    show_frame();
   }
   
   if (currentLineIndex < lines.size()) {
-    String currentLine = lines[currentLineIndex];
+    const String& currentLine = lines[currentLineIndex];
     
     // Non-blocking cursor wipe animation
     if (wipeState == WIPE_IDLE) {
@@ -378,7 +694,7 @@ bool CursorWipeTransition::update(ContentManager& content) {
     
     if (wipeState == WIPE_REVEALING) {
       // Wipe animation - reveal one character every 40ms
-      if (currentTime - lastStateTime >= 40) {
+      if ((uint32_t)(currentTime - lastStateTime) >= 40) {
         displayWipeStep(currentWipeLine, wipeStep, content);
         wipeStep++;
         lastStateTime = currentTime;
@@ -393,7 +709,7 @@ bool CursorWipeTransition::update(ContentManager& content) {
     
     if (wipeState == WIPE_FLASHING) {
       // Flash cursor at end - every 200ms
-      if (currentTime - lastStateTime >= 200) {
+      if ((uint32_t)(currentTime - lastStateTime) >= 200) {
         displayFlashStep(currentWipeLine, flashStep % 2 == 0, content);
         flashStep++;
         lastStateTime = currentTime;
@@ -401,7 +717,7 @@ bool CursorWipeTransition::update(ContentManager& content) {
         if (flashStep >= 6) { // Flash 3 times (6 steps: on/off/on/off/on/off)
           // Move to next line
           unsigned long lineDisplayTime = (currentLine.length() * 1000.0) / CPS_TARGET + 2000;
-          if (currentTime - lastLineTime >= lineDisplayTime) {
+          if ((uint32_t)(currentTime - lastLineTime) >= lineDisplayTime) {
             currentLineIndex++;
             lastLineTime = currentTime;
             wipeState = WIPE_IDLE;
@@ -420,102 +736,37 @@ bool CursorWipeTransition::update(ContentManager& content) {
   }
 }
 
-void CursorWipeTransition::displayLineCursorWipe(const String& line, ContentManager& content) {
-  // Display line with cursor wipe effect - stops at actual text end and flashes (restored from original)
-  
-  // Find actual end of text (excluding trailing spaces)
-  String trimmedLine = line;
-  trimmedLine.trim();
-  int textLength = trimmedLine.length();
-  
-  int wipeSteps = smoothTransitions ? textLength : 1;
-  
-  // Wipe phase - reveal characters one by one
-  for (int wipe = 0; wipe <= wipeSteps; wipe++) {
-    FastLED.clear();
-    
-    for (int pos = 0; pos < NUM_CHARS; pos++) {
-      CRGB c = CRGB::Black;
-      char thechar = ' ';
-      
-      if (pos < textLength) {
-        thechar = line.c_str()[pos];
-        
-        if (pos < wipe) {
-          // Character revealed - use content manager coloring
-          c = content.getCharacterColor(line, pos, 0);
-        } else if (pos == wipe) {
-          // Cursor position during wipe
-          c = CRGB::White;
-          thechar = '_';
-        }
-      }
-      
-      write_character(thechar, pos, c);
-    }
-    
-    START_TIMER(led_show_wipe);
-    FastLED.show();
-    END_FASTLED_TIMER(led_show_wipe, g_perfMonitor->getMetrics().fastLEDShowTime);
-    delay(40); // Faster character drawing (was 80ms, now 40ms)
-  }
-  
-  // Pause phase - flash cursor at end of text
-  if (smoothTransitions) {
-    for (int flash = 0; flash < 3; flash++) { // Flash 3 times
-      // Show text with cursor
-      FastLED.clear();
-      for (int pos = 0; pos < textLength; pos++) {
-        char thechar = line.c_str()[pos];
-        CRGB c = content.getCharacterColor(line, pos, 0);
-        write_character(thechar, pos, c);
-      }
-      // Add flashing cursor at end
-      if (textLength < NUM_CHARS) {
-        write_character('_', textLength, CRGB::White);
-      }
-      
-      START_TIMER(led_show_flash_on);
-      FastLED.show();
-      END_FASTLED_TIMER(led_show_flash_on, g_perfMonitor->getMetrics().fastLEDShowTime);
-      delay(200);
-      
-      // Show text without cursor
-      FastLED.clear();
-      for (int pos = 0; pos < textLength; pos++) {
-        char thechar = line.c_str()[pos];
-        CRGB c = content.getCharacterColor(line, pos, 0);
-        write_character(thechar, pos, c);
-      }
-      
-      START_TIMER(led_show_flash_off);
-      FastLED.show();
-      END_FASTLED_TIMER(led_show_flash_off, g_perfMonitor->getMetrics().fastLEDShowTime);
-      delay(200);
-    }
-  }
-}
-
 void CursorWipeTransition::maintainCurrentLine(const String& line, ContentManager& content) {
   // Just maintain the line display without animation
-  FastLED.clear();
-  for (int pos = 0; pos < NUM_CHARS && pos < line.length(); pos++) {
+  clear_frame();
+  if (PROPORTIONAL_TEXT) {
+    drawProportionalLine(line, line.length(), 0, content);
+    show_frame();
+    return;
+  }
+  for (int pos = 0; pos < g_topology.getColumns() && pos < line.length(); pos++) {
     char thechar = line.c_str()[pos];
     CRGB c = content.getCharacterColor(line, pos, 0); // Use content manager coloring
-    write_character(thechar, pos, c);
+    write_character(content.getCurrentFont(), thechar, pos, c);
   }
-  START_TIMER(led_show_maintain);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_maintain, g_perfMonitor->getMetrics().fastLEDShowTime);
+  show_frame();
 }
 
 void CursorWipeTransition::displayWipeStep(const String& line, int step, ContentManager& content) {
   // Display one step of the wipe animation (non-blocking)
-  FastLED.clear();
+  clear_frame();
   
   int textLength = line.length();
   
-  for (int pos = 0; pos < NUM_CHARS; pos++) {
+  if (PROPORTIONAL_TEXT) {
+    // Cursor sits where the next character to be revealed starts
+    int x = drawProportionalLine(line, step, 0, content);
+    if (step < textLength) draw_glyph(content.getCurrentFont(), '_', x, 0, CRGB::White);
+    show_frame();
+    return;
+  }
+  
+  for (int pos = 0; pos < g_topology.getColumns(); pos++) {
     CRGB c = CRGB::Black;
     char thechar = ' ';
     
@@ -532,35 +783,38 @@ void CursorWipeTransition::displayWipeStep(const String& line, int step, Content
       }
     }
     
-    write_character(thechar, pos, c);
+    write_character(content.getCurrentFont(), thechar, pos, c);
   }
   
-  START_TIMER(led_show_wipe);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_wipe, g_perfMonitor->getMetrics().fastLEDShowTime);
+  show_frame();
 }
 
 void CursorWipeTransition::displayFlashStep(const String& line, bool showCursor, ContentManager& content) {
   // Display one step of the flash animation (non-blocking)
-  FastLED.clear();
+  clear_frame();
   
   int textLength = line.length();
   
+  if (PROPORTIONAL_TEXT) {
+    int x = drawProportionalLine(line, textLength, 0, content);
+    if (showCursor && x < g_topology.getWidth()) draw_glyph(content.getCurrentFont(), '_', x, 0, CRGB::White);
+    show_frame();
+    return;
+  }
+  
   // Show revealed text
-  for (int pos = 0; pos < textLength && pos < NUM_CHARS; pos++) {
+  for (int pos = 0; pos < textLength && pos < g_topology.getColumns(); pos++) {
     char thechar = line.c_str()[pos];
     CRGB c = content.getCharacterColor(line, pos, 0);
-    write_character(thechar, pos, c);
+    write_character(content.getCurrentFont(), thechar, pos, c);
   }
   
   // Add flashing cursor at end if requested and space available
-  if (showCursor && textLength < NUM_CHARS) {
-    write_character('_', textLength, CRGB::White);
+  if (showCursor && textLength < g_topology.getColumns()) {
+    write_character(content.getCurrentFont(), '_', textLength, CRGB::White);
   }
   
-  START_TIMER(led_show_flash);
-  FastLED.show();
-  END_FASTLED_TIMER(led_show_flash, g_perfMonitor->getMetrics().fastLEDShowTime);
+  show_frame();
 }
 
 //=============================================================================
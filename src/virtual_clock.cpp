@@ -0,0 +1,46 @@
+#include "virtual_clock.h"
+
+// 64 bits so that millis() keeps counting after micros() wraps at ~71 minutes
+static volatile uint64_t virtualMicros = 0;
+static volatile bool virtualRunning = false;
+
+void VirtualClock::start(uint64_t startMicros) {
+  virtualMicros = startMicros;
+  virtualRunning = true;
+}
+
+void VirtualClock::advance(unsigned long micros) {
+  virtualMicros = virtualMicros + micros;
+}
+
+void VirtualClock::stop() {
+  virtualRunning = false;
+}
+
+bool VirtualClock::running() {
+  return virtualRunning;
+}
+
+//=============================================================================
+// Clock Hooks
+//=============================================================================
+
+// The hooks must exist whenever the --wrap flags are set. They can be called
+// from interrupt handlers, so they stay in IRAM like the functions they wrap.
+#if DIAGNOSTIC_HOOKS
+extern "C" {
+unsigned long __real_millis();
+unsigned long __real_micros();
+
+// Simulated time wraps at 32 bits like the ESP32 clock, even where unsigned long is wider
+unsigned long IRAM_ATTR __wrap_millis() {
+  if (virtualRunning) return (uint32_t)(virtualMicros / 1000);
+  return __real_millis();
+}
+
+unsigned long IRAM_ATTR __wrap_micros() {
+  if (virtualRunning) return (uint32_t)virtualMicros;
+  return __real_micros();
+}
+}
+#endif
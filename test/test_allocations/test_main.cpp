@@ -0,0 +1,73 @@
+// Steady-state frames must not touch the heap. Each case replays one mode
+// (and, for text, one transition) on the virtual clock for long enough to
+// get well past the warmup, and fails if any frame after it allocated.
+#include <Arduino.h>
+#include <unity.h>
+#include "display_controller.h"
+#include "performance_monitor.h"
+#include "scenario_replay.h"
+
+extern DisplayController displayController;
+extern void setup_firmware();
+
+#define STEADY_CASE_MILLIS 20000UL  // Simulated time per case
+
+static ScenarioReplay* replay;
+
+void setUp() {
+  replay = new ScenarioReplay(displayController);
+  TEST_ASSERT_TRUE(replay->open());
+}
+
+void tearDown() {
+  replay->stop();
+  replay->close();
+  delete replay;
+}
+
+static void runSteady(const Scenario& scenario) {
+  unsigned long allocatingBefore = g_perfMonitor->getSteadyAllocatingFrames();
+  int rendered = 0;
+  replay->start(scenario);
+  while (replay->elapsed() < STEADY_CASE_MILLIS) {
+    if (replay->frame()) rendered++;
+  }
+  TEST_ASSERT_GREATER_THAN_MESSAGE(ALLOCATION_WARMUP_FRAMES, rendered, scenario.name);
+  TEST_ASSERT_EQUAL_UINT_MESSAGE(allocatingBefore, g_perfMonitor->getSteadyAllocatingFrames(), scenario.name);
+}
+
+static void test_text_transitions_do_not_allocate() {
+  for (int i = 0; i < NUM_TRANSITION_TYPES; i++) {
+    Scenario scenario = { "text", DisplayMode::TEXT_CONTENT, static_cast<TransitionType>(i),
+                          ColorMode::WORD_BASED, 0, nullptr, 0 };
+    runSteady(scenario);
+  }
+}
+
+static void test_space_animation_does_not_allocate() {
+  Scenario scenario = { "space", DisplayMode::SPACE_ANIMATION, TransitionType::SMOOTH_SCROLL,
+                        ColorMode::WORD_BASED, 0, nullptr, 0 };
+  runSteady(scenario);
+}
+
+static void test_color_show_does_not_allocate() {
+  Scenario scenario = { "color_show", DisplayMode::COLOR_SHOW, TransitionType::SMOOTH_SCROLL,
+                        ColorMode::WORD_BASED, 0, nullptr, 0 };
+  runSteady(scenario);
+}
+
+static void test_test_patterns_do_not_allocate() {
+  Scenario scenario = { "test_patterns", DisplayMode::TEST_PATTERNS, TransitionType::SMOOTH_SCROLL,
+                        ColorMode::WORD_BASED, 0, nullptr, 0 };
+  runSteady(scenario);
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_text_transitions_do_not_allocate);
+  RUN_TEST(test_space_animation_does_not_allocate);
+  RUN_TEST(test_color_show_does_not_allocate);
+  RUN_TEST(test_test_patterns_do_not_allocate);
+  return UNITY_END();
+}
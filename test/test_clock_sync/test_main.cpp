@@ -0,0 +1,371 @@
+// Clock sync between a master and a follower over the loopback transport, on
+// the virtual clock. Both share the process clock, so the master's clock is
+// skewed by rewriting the timestamps in its responses on the way out.
+//
+// One test runs the master in a second process instead, with its own clock,
+// and syncs to it over UDP on 127.0.0.1. The others check that synchronized
+// controllers draw adjacent slices of one scroll, laid out as a standalone
+// sign lays out its text.
+#include <Arduino.h>
+#include <unity.h>
+#include <arpa/inet.h>
+#include <chrono>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#include "display_controller.h"
+#include "scenario_replay.h"
+#include "shared_clock.h"
+#include "transition_effects.h"
+#include "virtual_clock.h"
+
+extern CRGB* leds;
+extern DisplayController displayController;
+extern void setup_firmware();
+extern int draw_glyph(const Font& font, uint8_t character, int x, int y, CRGB color);
+
+#define MASTER_SKEW_MICROS 250000LL  // Master clock ahead of the follower's
+#define SYNC_RUN_MILLIS 10000UL
+#define SYNC_STEP_MICROS 1000UL      // Both controllers are serviced once per step
+#define SCROLL_FRAMES 300
+#define MASTER_PROCESS_ARG "clock-master"  // Runs this binary as the master of the two-process test
+#define MASTER_START_DELAY_MILLIS 300UL     // The master boots this much later, so its clock is behind
+#define PROCESS_SYNC_MILLIS 4500UL          // Real time the follower syncs for; a request per CLOCK_SYNC_INTERVAL
+#define SYNC_COLUMN_MICROS (1000000 / (CPS_TARGET * SYNC_SCROLL_CHAR_PITCH))
+#define CONTIGUITY_INSTANTS 40
+#define CONTIGUITY_STEP_MICROS 37000UL
+
+// Loopback that adds a fixed skew to the master's receive and transmit times
+class SkewedLoopbackTransport : public LoopbackClockTransport {
+public:
+  SkewedLoopbackTransport(unsigned long delayMicros, int64_t skew)
+    : LoopbackClockTransport(delayMicros), skew(skew) {}
+
+  bool send(const uint8_t* data, size_t length) override {
+    uint8_t packet[CLOCK_SYNC_PACKET_SIZE];
+    if (length != CLOCK_SYNC_PACKET_SIZE || data[2] != CLOCK_SYNC_RESPONSE) {
+      return LoopbackClockTransport::send(data, length);
+    }
+    memcpy(packet, data, length);
+    shift(packet + 12);
+    shift(packet + 20);
+    return LoopbackClockTransport::send(packet, length);
+  }
+
+private:
+  int64_t skew;
+
+  void shift(uint8_t* field) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) value = (value << 8) | field[i];
+    value += skew;
+    for (int i = 0; i < 8; i++) field[i] = (value >> (8 * i)) & 0xFF;
+  }
+};
+
+// UDP on 127.0.0.1, as UdpClockTransport is on the sign: the master answers
+// whoever asked, a follower asks the master's port
+class LocalUdpClockTransport : public ClockTransport {
+public:
+  LocalUdpClockTransport() : peerPort(0) {
+    socketFd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in local = address(0); // Any free port
+    bind(socketFd, reinterpret_cast<sockaddr*>(&local), sizeof(local));
+  }
+  ~LocalUdpClockTransport() { close(socketFd); }
+
+  uint16_t port() const {
+    sockaddr_in local;
+    socklen_t length = sizeof(local);
+    getsockname(socketFd, reinterpret_cast<sockaddr*>(&local), &length);
+    return ntohs(local.sin_port);
+  }
+  void setPeer(uint16_t port) { peerPort = port; }
+
+  bool send(const uint8_t* data, size_t length) override {
+    if (!peerPort) return false;
+    sockaddr_in peer = address(peerPort);
+    return sendto(socketFd, data, length, 0, reinterpret_cast<sockaddr*>(&peer), sizeof(peer)) == (ssize_t)length;
+  }
+
+  int receive(uint8_t* data, size_t capacity) override {
+    sockaddr_in from;
+    socklen_t length = sizeof(from);
+    ssize_t received = recvfrom(socketFd, data, capacity, MSG_DONTWAIT, reinterpret_cast<sockaddr*>(&from), &length);
+    if (received <= 0) return 0;
+    peerPort = ntohs(from.sin_port);
+    return received;
+  }
+
+private:
+  int socketFd;
+  uint16_t peerPort;
+
+  static sockaddr_in address(uint16_t port) {
+    sockaddr_in result;
+    memset(&result, 0, sizeof(result));
+    result.sin_family = AF_INET;
+    result.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    result.sin_port = htons(port);
+    return result;
+  }
+};
+
+// When this process's micros() read 0, on the machine-wide clock. Two
+// processes' clocks differ by the difference of their boot times.
+static long long bootMicros() {
+  long long now = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+  return now - (long long)micros();
+}
+
+// Body of the master process: report its port and boot time, then answer
+// requests until the follower stops it
+static int runMasterProcess() {
+  LocalUdpClockTransport link;
+  SharedClock master(&link, true);
+  printf("%u %lld\n", link.port(), bootMicros());
+  fflush(stdout);
+  unsigned long start = millis();
+  while (millis() - start < 4 * PROCESS_SYNC_MILLIS) {
+    master.update();
+    delayMicroseconds(100);
+  }
+  return 0;
+}
+
+void setUp() {
+  VirtualClock::start(SCENARIO_CLOCK_START_MICROS);
+}
+
+void tearDown() {
+  VirtualClock::stop();
+}
+
+static void runClocks(SharedClock& master, SharedClock& follower, unsigned long millis) {
+  for (unsigned long elapsed = 0; elapsed < millis * 1000; elapsed += SYNC_STEP_MICROS) {
+    master.update();
+    follower.update();
+    VirtualClock::advance(SYNC_STEP_MICROS);
+  }
+}
+
+// Runs first: SharedClock::localMicros() extends the last counter value it
+// saw, so it must not have seen the virtual clock before real time
+static void test_follower_syncs_to_a_master_process() {
+  VirtualClock::stop();
+  int output[2];
+  TEST_ASSERT_EQUAL_INT(0, pipe(output));
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    // A fresh image, so the master's clock starts from its own boot
+    delay(MASTER_START_DELAY_MILLIS);
+    dup2(output[1], STDOUT_FILENO);
+    close(output[0]);
+    execl("/proc/self/exe", "test_clock_sync", MASTER_PROCESS_ARG, (char*)nullptr);
+    _exit(1);
+  }
+  TEST_ASSERT_GREATER_THAN(0, pid);
+  close(output[1]);
+  FILE* masterOutput = fdopen(output[0], "r");
+  unsigned int masterPort = 0;
+  long long masterBoot = 0;
+  int fields = fscanf(masterOutput, "%u %lld", &masterPort, &masterBoot);
+  fclose(masterOutput);
+
+  LocalUdpClockTransport link;
+  link.setPeer(masterPort);
+  SharedClock follower(&link, false);
+  unsigned long start = millis();
+  while (fields == 2 && millis() - start < PROCESS_SYNC_MILLIS) {
+    follower.update();
+    delayMicroseconds(100);
+  }
+  kill(pid, SIGTERM);
+  waitpid(pid, nullptr, 0);
+
+  // The master's clock reads what ours did when it booted, so it is behind by the difference
+  long long skew = bootMicros() - masterBoot;
+  TEST_ASSERT_EQUAL_INT(2, fields);
+  TEST_ASSERT_TRUE(follower.isSynced());
+  TEST_ASSERT_GREATER_THAN(MASTER_START_DELAY_MILLIS * 1000 - 1, -skew);
+  // Well inside a column of the scroll, so both controllers show the same one
+  TEST_ASSERT_INT_WITHIN(SYNC_COLUMN_MICROS / 4, skew, follower.getOffsetMicros());
+}
+
+static void test_follower_learns_the_master_skew() {
+  SkewedLoopbackTransport masterLink(3000, MASTER_SKEW_MICROS);
+  LoopbackClockTransport followerLink(3000);
+  LoopbackClockTransport::connect(masterLink, followerLink);
+  SharedClock master(&masterLink, true);
+  SharedClock follower(&followerLink, false);
+
+  TEST_ASSERT_TRUE(master.isSynced());
+  TEST_ASSERT_FALSE(follower.isSynced());
+  runClocks(master, follower, SYNC_RUN_MILLIS);
+
+  // Servicing once a step puts up to a step on each timestamp
+  TEST_ASSERT_TRUE(follower.isSynced());
+  TEST_ASSERT_INT_WITHIN(SYNC_STEP_MICROS, MASTER_SKEW_MICROS, follower.getOffsetMicros());
+  TEST_ASSERT_INT_WITHIN(2 * SYNC_STEP_MICROS, 6000, follower.getRoundTripMicros());
+  TEST_ASSERT_INT_WITHIN(SYNC_STEP_MICROS, MASTER_SKEW_MICROS, (long)(follower.nowMicros() - master.nowMicros()));
+}
+
+static void test_asymmetric_path_error_is_half_the_asymmetry() {
+  SkewedLoopbackTransport masterLink(1000, MASTER_SKEW_MICROS);  // Master to follower
+  LoopbackClockTransport followerLink(9000);                      // Follower to master
+  LoopbackClockTransport::connect(masterLink, followerLink);
+  SharedClock master(&masterLink, true);
+  SharedClock follower(&followerLink, false);
+
+  runClocks(master, follower, SYNC_RUN_MILLIS);
+
+  TEST_ASSERT_TRUE(follower.isSynced());
+  TEST_ASSERT_INT_WITHIN(SYNC_STEP_MICROS, MASTER_SKEW_MICROS + (9000 - 1000) / 2, follower.getOffsetMicros());
+}
+
+static void test_silent_master_leaves_the_follower_unsynced() {
+  LoopbackClockTransport masterLink;
+  LoopbackClockTransport followerLink;
+  LoopbackClockTransport::connect(masterLink, followerLink);
+  SharedClock follower(&followerLink, false);
+
+  for (int i = 0; i < 5000; i++) {
+    follower.update();
+    VirtualClock::advance(SYNC_STEP_MICROS);
+  }
+  TEST_ASSERT_FALSE(follower.isSynced());
+  TEST_ASSERT_EQUAL_INT(0, follower.getOffsetMicros());
+}
+
+// Hashes of the frames a smooth scroll draws, one update per step
+static uint32_t scrollFrames(SmoothScrollTransition& scroll, SharedClock* clock) {
+  ContentManager& content = displayController.getContentManager();
+  uint32_t hash = FRAME_HASH_SEED;
+  randomSeed(SCENARIO_SEED);
+  content.selectStory(0);
+  scroll.setSharedClock(clock, 0);
+  scroll.reset();
+  for (int frame = 0; frame < SCROLL_FRAMES; frame++) {
+    if (clock) clock->update();
+    scroll.update(content);
+    hash = ScenarioReplay::hashFrame(hash);
+    VirtualClock::advance(10 * SYNC_STEP_MICROS);
+  }
+  return hash;
+}
+
+static void test_unsynced_scroll_keeps_local_pacing() {
+  ScenarioReplay replay(displayController);
+  TEST_ASSERT_TRUE(replay.open());  // No LED output while the transitions draw
+  LoopbackClockTransport followerLink;  // Nobody answers
+  SharedClock follower(&followerLink, false);
+  SmoothScrollTransition local;
+  SmoothScrollTransition shared;
+
+  VirtualClock::start(SCENARIO_CLOCK_START_MICROS);
+  uint32_t localHash = scrollFrames(local, nullptr);
+  VirtualClock::start(SCENARIO_CLOCK_START_MICROS);
+  uint32_t sharedHash = scrollFrames(shared, &follower);
+  replay.close();
+
+  TEST_ASSERT_FALSE(follower.isSynced());
+  TEST_ASSERT_EQUAL_UINT32(localHash, sharedHash);
+}
+
+// One synchronized frame at the shared clock's current time
+static std::vector<CRGB> syncedFrame(ContentManager& content, SharedClock& clock, int columnOffset) {
+  SmoothScrollTransition scroll;
+  scroll.setSharedClock(&clock, columnOffset);
+  scroll.reset();
+  scroll.update(content);
+  return std::vector<CRGB>(leds, leds + g_topology.getLedCount());
+}
+
+static bool sameColumn(const std::vector<CRGB>& a, int xa, const std::vector<CRGB>& b, int xb) {
+  for (int y = 0; y < g_topology.getHeight(); y++) {
+    if (!(a[g_topology.index(xa, y)] == b[g_topology.index(xb, y)])) return false;
+  }
+  return true;
+}
+
+static void test_column_offsets_draw_adjacent_slices() {
+  ScenarioReplay replay(displayController);
+  TEST_ASSERT_TRUE(replay.open());
+  ContentManager& content = displayController.getContentManager();
+  LoopbackClockTransport link;
+  SharedClock clock(&link, true);
+  int width = g_topology.getWidth();
+  int half = width / 2;
+  int litColumns = 0;
+  std::vector<CRGB> blank(g_topology.getLedCount());
+
+  // Controllers at 0 and width; the one at half must overlap both seamlessly
+  for (int instant = 0; instant < CONTIGUITY_INSTANTS; instant++) {
+    std::vector<CRGB> left = syncedFrame(content, clock, 0);
+    std::vector<CRGB> middle = syncedFrame(content, clock, half);
+    std::vector<CRGB> right = syncedFrame(content, clock, width);
+    for (int x = 0; x < width - half; x++) {
+      TEST_ASSERT_TRUE(sameColumn(left, half + x, middle, x));
+    }
+    for (int x = width - half; x < width; x++) {
+      TEST_ASSERT_TRUE(sameColumn(right, x - (width - half), middle, x));
+    }
+    for (int x = 0; x < width; x++) {
+      if (!sameColumn(right, x, blank, x)) litColumns++;
+    }
+    VirtualClock::advance(CONTIGUITY_STEP_MICROS);
+  }
+  replay.close();
+  TEST_ASSERT_GREATER_THAN(0, litColumns);
+}
+
+static void test_synced_layout_matches_a_standalone_sign() {
+  ScenarioReplay replay(displayController);
+  TEST_ASSERT_TRUE(replay.open());
+  ContentManager content;
+  String story = "Little lilies in a wide meadow, swaying: willow, ivy, mimosa and wild thyme";
+  content.addStory(story);
+  const Font& font = content.getStoryFont(0);
+  LoopbackClockTransport link;
+  SharedClock clock(&link, true);
+
+  // Shift the view so that the story starts at its left edge
+  uint64_t loopColumns = font.textWidth(story.c_str(), story.length(), FONT_GLYPH_GAP) +
+                         SYNC_SCROLL_STORY_GAP * font.advance(' ', FONT_GLYPH_GAP);
+  uint64_t scrolled = clock.nowMicros() * (CPS_TARGET * SYNC_SCROLL_CHAR_PITCH) / 1000000;
+  int columnOffset = loopColumns - scrolled % loopColumns;
+  std::vector<CRGB> synced = syncedFrame(content, clock, columnOffset);
+
+  clear_frame();
+  int x = 0;
+  for (int pos = 0; pos < (int)story.length() && x < g_topology.getWidth(); pos++) {
+    x += draw_glyph(font, story.c_str()[pos], x, 0, content.getCharacterColor(story, pos, 0));
+  }
+  std::vector<CRGB> standalone(leds, leds + g_topology.getLedCount());
+  replay.close();
+  TEST_ASSERT_TRUE(PROPORTIONAL_TEXT);
+  TEST_ASSERT_GREATER_THAN(g_topology.getWidth() - 1, x);
+  for (int column = 0; column < g_topology.getWidth(); column++) {
+    TEST_ASSERT_TRUE(sameColumn(synced, column, standalone, column));
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1 && strcmp(argv[1], MASTER_PROCESS_ARG) == 0) return runMasterProcess();
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_follower_syncs_to_a_master_process);
+  RUN_TEST(test_follower_learns_the_master_skew);
+  RUN_TEST(test_asymmetric_path_error_is_half_the_asymmetry);
+  RUN_TEST(test_silent_master_leaves_the_follower_unsynced);
+  RUN_TEST(test_unsynced_scroll_keeps_local_pacing);
+  RUN_TEST(test_column_offsets_draw_adjacent_slices);
+  RUN_TEST(test_synced_layout_matches_a_standalone_sign);
+  return UNITY_END();
+}
@@ -0,0 +1,136 @@
+// Frame stream packets: what the encoder writes the decoder applies exactly,
+// and packets it cannot trust are dropped without touching the frame.
+#include <Arduino.h>
+#include <unity.h>
+#include <string.h>
+#include "frame_stream.h"
+
+#define PIXELS 300
+#define PACKET_CAPACITY 1024
+
+static uint8_t source[PIXELS * 3];
+static uint8_t shown[PIXELS * 3];
+static uint8_t packet[PACKET_CAPACITY];
+
+void setUp() {
+  for (int i = 0; i < PIXELS * 3; i++) source[i] = (uint8_t)(i * 7);
+  memset(shown, 0, sizeof(shown));
+}
+
+void tearDown() {}
+
+// Number of frames the bytes completed
+static int feedAll(FrameStreamDecoder& decoder, const uint8_t* bytes, size_t length) {
+  int frames = 0;
+  for (size_t i = 0; i < length; i++) {
+    if (decoder.feed(bytes[i])) frames++;
+  }
+  return frames;
+}
+
+// Recomputes the trailing checksum after a packet was edited
+static void resign(uint8_t* bytes, size_t length) {
+  uint8_t checksum = 0;
+  for (size_t i = 0; i < length - 1; i++) checksum ^= bytes[i];
+  bytes[length - 1] = checksum;
+}
+
+static void test_keyframe_and_deltas_round_trip() {
+  FrameStreamEncoder encoder(PIXELS);
+  FrameStreamDecoder decoder(shown, PIXELS);
+
+  size_t length = encoder.encode(source, packet, sizeof(packet));
+  TEST_ASSERT_TRUE(length > 0);
+  TEST_ASSERT_EQUAL_INT(1, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_MEMORY(source, shown, sizeof(source));
+
+  // Two separate changes become a small delta
+  source[3] ^= 0xFF;
+  source[200 * 3 + 1] ^= 0xFF;
+  length = encoder.encode(source, packet, sizeof(packet));
+  TEST_ASSERT_TRUE(length < 32);
+  TEST_ASSERT_EQUAL_INT(1, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_MEMORY(source, shown, sizeof(source));
+
+  // An unchanged frame still advances the sequence
+  length = encoder.encode(source, packet, sizeof(packet));
+  TEST_ASSERT_EQUAL_INT(FRAME_STREAM_HEADER_SIZE + 1, length);
+  TEST_ASSERT_EQUAL_INT(1, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_INT(3, decoder.getFramesApplied());
+}
+
+static void test_bad_span_leaves_the_frame_untouched() {
+  FrameStreamEncoder encoder(PIXELS);
+  FrameStreamDecoder decoder(shown, PIXELS);
+  size_t length = encoder.encode(source, packet, sizeof(packet));
+  feedAll(decoder, packet, length);
+
+  // A delta whose first span is fine and whose second runs past the display
+  source[0] ^= 0xFF;
+  source[100 * 3] ^= 0xFF;
+  length = encoder.encode(source, packet, sizeof(packet));
+  size_t second = FRAME_STREAM_HEADER_SIZE + FRAME_STREAM_SPAN_HEADER_SIZE + 3;
+  packet[second] = (PIXELS - 1) & 0xFF;
+  packet[second + 1] = (PIXELS - 1) >> 8;
+  packet[second + 2] = 2;
+  resign(packet, length);
+
+  uint8_t before[sizeof(shown)];
+  memcpy(before, shown, sizeof(shown));
+  TEST_ASSERT_EQUAL_INT(0, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_MEMORY(before, shown, sizeof(shown));
+  TEST_ASSERT_EQUAL_INT(1, decoder.getFramesDropped());
+}
+
+static void test_overrunning_span_is_dropped() {
+  FrameStreamEncoder encoder(PIXELS);
+  FrameStreamDecoder decoder(shown, PIXELS);
+  size_t length = encoder.encode(source, packet, sizeof(packet));
+  packet[FRAME_STREAM_HEADER_SIZE + 2] = 255;  // First span claims more bytes than the payload holds
+  packet[9] = 3 + 3 * 10;                        // Payload is one span header and 10 pixels
+  packet[10] = 0;
+  length = FRAME_STREAM_HEADER_SIZE + 3 + 3 * 10 + 1;
+  resign(packet, length);
+
+  TEST_ASSERT_EQUAL_INT(0, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_INT(0, decoder.getFramesApplied());
+  for (size_t i = 0; i < sizeof(shown); i++) TEST_ASSERT_EQUAL_INT(0, shown[i]);
+}
+
+static void test_deltas_after_a_gap_wait_for_a_keyframe() {
+  FrameStreamEncoder encoder(PIXELS);
+  FrameStreamDecoder decoder(shown, PIXELS);
+  size_t length = encoder.encode(source, packet, sizeof(packet));
+  feedAll(decoder, packet, length);
+
+  source[0] ^= 0xFF;
+  encoder.encode(source, packet, sizeof(packet));  // Lost on the way
+  source[3] ^= 0xFF;
+  length = encoder.encode(source, packet, sizeof(packet));
+  TEST_ASSERT_EQUAL_INT(0, feedAll(decoder, packet, length));
+
+  encoder.requestKeyframe();
+  length = encoder.encode(source, packet, sizeof(packet));
+  TEST_ASSERT_EQUAL_INT(1, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_MEMORY(source, shown, sizeof(source));
+}
+
+static void test_corrupt_byte_fails_the_checksum() {
+  FrameStreamEncoder encoder(PIXELS);
+  FrameStreamDecoder decoder(shown, PIXELS);
+  size_t length = encoder.encode(source, packet, sizeof(packet));
+  packet[FRAME_STREAM_HEADER_SIZE + 10] ^= 0x01;
+
+  TEST_ASSERT_EQUAL_INT(0, feedAll(decoder, packet, length));
+  TEST_ASSERT_EQUAL_INT(1, decoder.getChecksumErrors());
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_keyframe_and_deltas_round_trip);
+  RUN_TEST(test_bad_span_leaves_the_frame_untouched);
+  RUN_TEST(test_overrunning_span_is_dropped);
+  RUN_TEST(test_deltas_after_a_gap_wait_for_a_keyframe);
+  RUN_TEST(test_corrupt_byte_fails_the_checksum);
+  return UNITY_END();
+}
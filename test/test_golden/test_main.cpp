@@ -0,0 +1,25 @@
+// Rendering must match the golden hashes recorded for the host
+// (include/golden_frame_table_host.h), with every case covered.
+#include <Arduino.h>
+#include <unity.h>
+#include "display_controller.h"
+#include "golden_frames.h"
+
+extern DisplayController displayController;
+extern void setup_firmware();
+
+void setUp() {}
+void tearDown() {}
+
+static void test_frames_match_the_golden_hashes() {
+  GoldenFrameCheck check(displayController);
+  TEST_ASSERT_TRUE(check.verify());
+  TEST_ASSERT_EQUAL_INT(0, check.getMissing());
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_match_the_golden_hashes);
+  return UNITY_END();
+}
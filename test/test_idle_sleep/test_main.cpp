@@ -0,0 +1,113 @@
+// Sleeping until the next deadline must not change what the sign shows. Each
+// case runs twice on the virtual clock: once calling update() every
+// millisecond, and once sleeping until getNextWakeTime() as the loop does.
+// Both runs must show the same frames, each within a millisecond of the other.
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "display_controller.h"
+#include "scenario_replay.h"
+#include "virtual_clock.h"
+#include "topology.h"
+
+extern DisplayController displayController;
+extern CRGB* leds;
+extern void setup_firmware();
+
+#define IDLE_CASE_MILLIS 20000UL  // Simulated time per run
+#define IDLE_TIME_TOLERANCE_MILLIS 1 // The busy loop only sees a change on its next poll
+
+struct ShownFrame {
+  unsigned long atMillis;
+  uint32_t hash;
+};
+
+static ScenarioReplay* replay;
+
+void setUp() {
+  replay = new ScenarioReplay(displayController);
+  TEST_ASSERT_TRUE(replay->open());
+}
+
+void tearDown() {
+  replay->stop();
+  replay->close();
+  delete replay;
+}
+
+// One run of the scenario from a blank display. A frame that changed the
+// LEDs holds the output for its wire time, as in show_frame(); otherwise the
+// busy loop goes round again a millisecond later, and the sleeping loop waits
+// for the controller's next wake time.
+static std::vector<ShownFrame> runFrames(const Scenario& scenario, bool sleeping) {
+  std::vector<ShownFrame> shown;
+  fill_solid(leds, g_topology.getLedCount(), CRGB::Black);
+  replay->start(scenario);
+  while (replay->elapsed() < IDLE_CASE_MILLIS) {
+    unsigned long now = replay->elapsed();
+    displayController.update();
+
+    uint32_t hash = ScenarioReplay::hashFrame(FRAME_HASH_SEED);
+    bool changed = shown.empty() || shown.back().hash != hash;
+    if (changed) {
+      ShownFrame frame = { now, hash };
+      shown.push_back(frame);
+    }
+
+    unsigned long step = changed ? SCENARIO_FRAME_MICROS : 1000;
+    long untilWake = (long)(displayController.getNextWakeTime() - millis());
+    if (sleeping && untilWake > 0 && (unsigned long)untilWake * 1000 > step) {
+      step = (unsigned long)untilWake * 1000;
+    }
+    VirtualClock::advance(step);
+  }
+  replay->stop();
+  return shown;
+}
+
+static void checkSameFrames(const Scenario& scenario) {
+  std::vector<ShownFrame> busy = runFrames(scenario, false);
+  std::vector<ShownFrame> sleeping = runFrames(scenario, true);
+  TEST_ASSERT_GREATER_THAN_MESSAGE(1, (int)busy.size(), scenario.name);
+  TEST_ASSERT_EQUAL_UINT_MESSAGE(busy.size(), sleeping.size(), scenario.name);
+  for (size_t i = 0; i < busy.size(); i++) {
+    TEST_ASSERT_INT_WITHIN_MESSAGE(IDLE_TIME_TOLERANCE_MILLIS, busy[i].atMillis, sleeping[i].atMillis, scenario.name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(busy[i].hash, sleeping[i].hash, scenario.name);
+  }
+}
+
+static void test_text_transitions_show_the_same_frames() {
+  for (int i = 0; i < NUM_TRANSITION_TYPES; i++) {
+    Scenario scenario = { "text", DisplayMode::TEXT_CONTENT, static_cast<TransitionType>(i),
+                          ColorMode::WORD_BASED, 0, nullptr, 0 };
+    checkSameFrames(scenario);
+  }
+}
+
+static void test_single_color_drift_shows_the_same_frames() {
+  Scenario scenario = { "line_slide_single_color", DisplayMode::TEXT_CONTENT, TransitionType::LINE_SLIDE,
+                        ColorMode::SINGLE_COLOR, 1, nullptr, 0 };
+  checkSameFrames(scenario);
+}
+
+static void test_space_animation_shows_the_same_frames() {
+  Scenario scenario = { "space", DisplayMode::SPACE_ANIMATION, TransitionType::SMOOTH_SCROLL,
+                        ColorMode::WORD_BASED, 0, nullptr, 0 };
+  checkSameFrames(scenario);
+}
+
+static void test_test_patterns_show_the_same_frames() {
+  Scenario scenario = { "test_patterns", DisplayMode::TEST_PATTERNS, TransitionType::SMOOTH_SCROLL,
+                        ColorMode::WORD_BASED, 0, nullptr, 0 };
+  checkSameFrames(scenario);
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_text_transitions_show_the_same_frames);
+  RUN_TEST(test_single_color_drift_shows_the_same_frames);
+  RUN_TEST(test_space_animation_shows_the_same_frames);
+  RUN_TEST(test_test_patterns_show_the_same_frames);
+  return UNITY_END();
+}
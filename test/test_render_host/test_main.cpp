@@ -0,0 +1,41 @@
+// The render host (host/render_host.h) drives simulated displays from a pool
+// of worker processes. Every device must end on the frame its renderer drew,
+// with no packet lost or corrupted on the way, and the run reports how many
+// displays one host core can drive.
+#include <Arduino.h>
+#include <unity.h>
+#include "render_host.h"
+
+extern void setup_firmware();
+
+#define TEST_DISPLAYS 16
+#define TEST_WORKERS 2
+#define TEST_FRAMES 300UL  // Ten seconds at RENDER_HOST_FPS, so keyframes and deltas both go out
+
+void setUp() {}
+void tearDown() {}
+
+static void test_every_device_shows_its_frames() {
+  RenderHostResult result;
+  TEST_ASSERT_TRUE(RenderHost::run(TEST_DISPLAYS, TEST_WORKERS, TEST_FRAMES, result));
+  TEST_ASSERT_TRUE(result.framesMatch);
+  TEST_ASSERT_EQUAL_UINT(TEST_DISPLAYS * TEST_FRAMES, result.framesApplied);
+  TEST_ASSERT_EQUAL_UINT(0, result.framesDropped);
+  TEST_ASSERT_EQUAL_UINT(0, result.checksumErrors);
+}
+
+static void test_reports_displays_per_core() {
+  RenderHostResult result;
+  TEST_ASSERT_TRUE(RenderHost::run(TEST_DISPLAYS, 1, TEST_FRAMES, result));
+  TEST_ASSERT_GREATER_THAN(0, result.cpuMicros);
+  TEST_ASSERT_TRUE(result.displaysPerCore > 0);
+  Serial.printf("Displays per core at %d FPS: %.1f\n", RENDER_HOST_FPS, result.displaysPerCore);
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_every_device_shows_its_frames);
+  RUN_TEST(test_reports_displays_per_core);
+  return UNITY_END();
+}
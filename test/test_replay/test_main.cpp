@@ -0,0 +1,74 @@
+// Scenario replay must do the same thing every time: each built-in scenario
+// renders the same frames however often it runs and whatever ran before it.
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "display_controller.h"
+#include "scenario_replay.h"
+
+extern DisplayController displayController;
+extern void setup_firmware();
+
+struct ReplayResult {
+  unsigned long frames;
+  uint32_t hash;
+};
+
+static ScenarioReplay* replay;
+
+void setUp() {
+  replay = new ScenarioReplay(displayController);
+  TEST_ASSERT_TRUE(replay->open());
+}
+
+void tearDown() {
+  replay->close();
+  delete replay;
+}
+
+// Frames rendered and their chained hash, as run() reports them
+static ReplayResult replayScenario(const Scenario& scenario) {
+  ReplayResult result = { 0, FRAME_HASH_SEED };
+  replay->start(scenario);
+  while (replay->elapsed() < SCENARIO_DURATION_MILLIS) {
+    if (replay->frame()) {
+      result.frames++;
+      result.hash = ScenarioReplay::hashFrame(result.hash);
+    }
+  }
+  replay->stop();
+  return result;
+}
+
+static void test_repeated_runs_render_the_same_frames() {
+  for (int i = 0; i < ScenarioReplay::getScenarioCount(); i++) {
+    const Scenario& scenario = ScenarioReplay::getScenario(i);
+    ReplayResult first = replayScenario(scenario);
+    ReplayResult second = replayScenario(scenario);
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, first.frames, scenario.name);
+    TEST_ASSERT_EQUAL_UINT_MESSAGE(first.frames, second.frames, scenario.name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(first.hash, second.hash, scenario.name);
+  }
+}
+
+static void test_order_does_not_matter() {
+  int count = ScenarioReplay::getScenarioCount();
+  std::vector<ReplayResult> forward;
+  for (int i = 0; i < count; i++) {
+    forward.push_back(replayScenario(ScenarioReplay::getScenario(i)));
+  }
+  for (int i = count - 1; i >= 0; i--) {
+    const Scenario& scenario = ScenarioReplay::getScenario(i);
+    ReplayResult backward = replayScenario(scenario);
+    TEST_ASSERT_EQUAL_UINT_MESSAGE(forward[i].frames, backward.frames, scenario.name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(forward[i].hash, backward.hash, scenario.name);
+  }
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_repeated_runs_render_the_same_frames);
+  RUN_TEST(test_order_does_not_matter);
+  return UNITY_END();
+}
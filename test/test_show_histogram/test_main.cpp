@@ -0,0 +1,79 @@
+// Show times reach the report through a per-window histogram that the
+// output task records into and the reporter swaps out. Every window must
+// hold exactly the shows recorded in it, however long the monitor runs and
+// whichever task is recording at the time.
+#include <Arduino.h>
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "performance_monitor.h"
+#include "virtual_clock.h"
+
+#define REPORT_INTERVAL_MILLIS 2000UL    // isReportDue() waits this long
+#define SHOWS_PER_WINDOW 40000UL         // More than a 16-bit bucket holds over two windows
+#define SHOW_MICROS 300UL
+
+void setUp() {
+  VirtualClock::start(1000000ULL);
+}
+
+void tearDown() {
+  VirtualClock::stop();
+}
+
+static bool nextSnapshot(PerformanceMonitor& monitor, PerformanceSnapshot& snapshot) {
+  monitor.incrementFrame();
+  VirtualClock::advance(REPORT_INTERVAL_MILLIS * 1000);
+  return monitor.takeSnapshot(snapshot);
+}
+
+static void test_windows_do_not_saturate() {
+  PerformanceMonitor monitor(true);
+  unsigned long expected = LatencyHistogram::bucketMidpoint(LatencyHistogram::bucketFor(SHOW_MICROS));
+  if (expected > SHOW_MICROS) expected = SHOW_MICROS;
+
+  for (int window = 0; window < 4; window++) {
+    for (unsigned long i = 0; i < SHOWS_PER_WINDOW; i++) {
+      monitor.recordShowTime(SHOW_MICROS);
+    }
+    PerformanceSnapshot snapshot;
+    TEST_ASSERT_TRUE(nextSnapshot(monitor, snapshot));
+    TEST_ASSERT_EQUAL_UINT(SHOWS_PER_WINDOW, snapshot.metrics.showTimes.count());
+    TEST_ASSERT_EQUAL_UINT(expected, snapshot.metrics.showTimes.percentile(0.50f));
+    TEST_ASSERT_EQUAL_UINT(SHOW_MICROS, snapshot.metrics.showTimes.max);
+  }
+}
+
+static void test_no_show_is_lost_while_recording() {
+  PerformanceMonitor monitor(true);
+  const unsigned long shows = 200000;
+  std::atomic<bool> done(false);
+  std::thread output([&monitor, &done, shows] {
+    for (unsigned long i = 1; i <= shows; i++) {
+      monitor.recordShowTime(SHOW_MICROS);
+      // Pauses keep each window well short of a full 16-bit bucket
+      if (i % 1000 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    done = true;
+  });
+
+  // Windows far shorter than a real one, so swaps land mid-recording
+  unsigned long counted = 0;
+  PerformanceSnapshot snapshot;
+  while (!done) {
+    TEST_ASSERT_TRUE(nextSnapshot(monitor, snapshot));
+    counted += snapshot.metrics.showTimes.count();
+  }
+  output.join();
+  TEST_ASSERT_TRUE(nextSnapshot(monitor, snapshot));
+  counted += snapshot.metrics.showTimes.count();
+  TEST_ASSERT_EQUAL_UINT(shows, counted);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_windows_do_not_saturate);
+  RUN_TEST(test_no_show_is_lost_while_recording);
+  return UNITY_END();
+}
@@ -0,0 +1,91 @@
+// Smooth scroll speed follows elapsed time: the stride adaptive quality sets
+// under load only changes how many frames the scroll takes, not how fast it
+// moves, whether frames come quickly or are held back by the LED output.
+#include <Arduino.h>
+#include <unity.h>
+#include "display_controller.h"
+#include "scenario_replay.h"
+#include "transition_effects.h"
+#include "virtual_clock.h"
+
+extern DisplayController displayController;
+extern void setup_firmware();
+
+#define SCROLL_RUN_MILLIS 20000UL
+#define FAST_FRAME_MICROS 2000UL   // Frames well under the sub-step interval
+#define SLOW_FRAME_MICROS 34000UL  // One output of 32 blocks
+
+static ScenarioReplay* replay;
+
+void setUp() {
+  replay = new ScenarioReplay(displayController);
+  TEST_ASSERT_TRUE(replay->open());  // No LED output while the transition draws
+}
+
+void tearDown() {
+  replay->close();
+  delete replay;
+}
+
+struct ScrollRun {
+  int characters;  // Times update() reported the scroll moved on a character
+  int frames;      // Frames drawn
+};
+
+// One long paragraph, so no newline effect (paced by frames, not time) interrupts the scroll
+static ScrollRun scroll(int stride, unsigned long frameMicros) {
+  ContentManager content;
+  String story;
+  while (story.length() < 600) story += "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG ";
+  content.addStory(story);
+  SmoothScrollTransition transition;
+  ScrollRun run = { 0, 0 };
+
+  VirtualClock::start(SCENARIO_CLOCK_START_MICROS);
+  randomSeed(SCENARIO_SEED);
+  transition.setStepStride(stride);
+  transition.reset();
+  unsigned long start = millis();
+  while (millis() - start < SCROLL_RUN_MILLIS) {
+    uint32_t before = ScenarioReplay::hashFrame(FRAME_HASH_SEED);
+    if (transition.update(content)) run.characters++;
+    if (ScenarioReplay::hashFrame(FRAME_HASH_SEED) != before) run.frames++;
+    VirtualClock::advance(frameMicros);
+  }
+  VirtualClock::stop();
+  return run;
+}
+
+static void checkStrideKeepsSpeed(unsigned long frameMicros) {
+  ScrollRun full = scroll(1, frameMicros);
+  TEST_ASSERT_GREATER_THAN(0, full.characters);
+  for (int stride = 2; stride <= 3; stride++) {
+    ScrollRun coarse = scroll(stride, frameMicros);
+    TEST_ASSERT_INT_WITHIN(1, full.characters, coarse.characters);
+    TEST_ASSERT_TRUE(coarse.frames <= full.frames);
+  }
+}
+
+static void test_stride_keeps_speed_with_fast_frames() {
+  checkStrideKeepsSpeed(FAST_FRAME_MICROS);
+}
+
+static void test_stride_keeps_speed_with_slow_frames() {
+  checkStrideKeepsSpeed(SLOW_FRAME_MICROS);
+}
+
+static void test_slow_frames_keep_the_speed_of_fast_ones() {
+  ScrollRun fast = scroll(1, FAST_FRAME_MICROS);
+  ScrollRun slow = scroll(1, SLOW_FRAME_MICROS);
+  TEST_ASSERT_INT_WITHIN(1, fast.characters, slow.characters);
+  TEST_ASSERT_TRUE(slow.frames < fast.frames);
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_stride_keeps_speed_with_fast_frames);
+  RUN_TEST(test_stride_keeps_speed_with_slow_frames);
+  RUN_TEST(test_slow_frames_keep_the_speed_of_fast_ones);
+  return UNITY_END();
+}
@@ -0,0 +1,24 @@
+// The full simulated week of the soak test (soak_test.h) must pass: no
+// allocation or heap growth, no stalled mode, no drift in frame cost.
+#include <Arduino.h>
+#include <unity.h>
+#include "display_controller.h"
+#include "soak_test.h"
+
+extern DisplayController displayController;
+extern void setup_firmware();
+
+void setUp() {}
+void tearDown() {}
+
+static void test_simulated_week_passes() {
+  SoakTest soak(displayController);
+  TEST_ASSERT_TRUE(soak.run());
+}
+
+int main(int argc, char** argv) {
+  setup_firmware();
+  UNITY_BEGIN();
+  RUN_TEST(test_simulated_week_passes);
+  return UNITY_END();
+}
@@ -0,0 +1,89 @@
+// Topology descriptions: valid layouts map every pixel, and descriptions
+// that are malformed or too large are refused without touching the topology.
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "topology.h"
+
+void setUp() {}
+void tearDown() {}
+
+static void test_row_maps_blocks_in_chain_order() {
+  Topology topology;
+  TEST_ASSERT_TRUE(topology.load("4x1"));
+  TEST_ASSERT_EQUAL_INT(4 * BLOCK_WIDTH, topology.getWidth());
+  TEST_ASSERT_EQUAL_INT(BLOCK_HEIGHT, topology.getHeight());
+  TEST_ASSERT_EQUAL_INT(0, topology.index(0, 0));
+  TEST_ASSERT_EQUAL_INT(BLOCK_LEDS + BLOCK_WIDTH + 1, topology.index(BLOCK_WIDTH + 1, 1));
+}
+
+static void test_serpentine_rotated_layout() {
+  Topology topology;
+  TEST_ASSERT_TRUE(topology.load("2x2s:NR"));
+  // The second row starts on the right, and blocks after the first are upside
+  // down, so the third block's top right pixel is the first LED of its last row
+  TEST_ASSERT_EQUAL_INT(2 * BLOCK_LEDS + (BLOCK_HEIGHT - 1) * BLOCK_WIDTH, topology.index(2 * BLOCK_WIDTH - 1, BLOCK_HEIGHT));
+  TEST_ASSERT_EQUAL_INT(BLOCK_LEDS - 1, topology.index(BLOCK_WIDTH - 1, BLOCK_HEIGHT - 1));
+}
+
+static void test_every_pixel_maps_to_its_own_led() {
+  Topology topology;
+  TEST_ASSERT_TRUE(topology.load("512x1/8"));
+  std::vector<bool> seen(topology.getLedCount(), false);
+  for (int y = 0; y < topology.getHeight(); y++) {
+    for (int x = 0; x < topology.getWidth(); x++) {
+      int index = topology.index(x, y);
+      TEST_ASSERT_TRUE(index >= 0 && index < topology.getLedCount());
+      TEST_ASSERT_FALSE(seen[index]);
+      seen[index] = true;
+    }
+  }
+}
+
+static void test_malformed_descriptions_are_refused() {
+  const char* descriptions[] = { "", "x1", "32", "32x", "32x1q", "32x1:", "32x1:NQ", "32x1/", "32x1/0", "32x1/9", "2x1/3" };
+  Topology topology;
+  TEST_ASSERT_TRUE(topology.load("32x1"));
+  for (size_t i = 0; i < sizeof(descriptions) / sizeof(descriptions[0]); i++) {
+    TEST_ASSERT_FALSE_MESSAGE(topology.load(descriptions[i]), descriptions[i]);
+  }
+  TEST_ASSERT_EQUAL_STRING("32x1", topology.getDescription());
+  TEST_ASSERT_EQUAL_INT(32 * BLOCK_WIDTH, topology.getWidth());
+}
+
+static void test_oversized_descriptions_are_refused() {
+  const char* descriptions[] = {
+    "513x1", "1x366", "512x2", "0x1", "1x0", "-1x1",
+    "858993460x1",                  // x5 wraps a 32-bit long to 4
+    "1x613566757",                  // x7 wraps a 32-bit long to 3
+    "65536x65536",                  // Sides fit, the product does not
+    "3689348814741910324x1",        // x5 wraps a 64-bit long to 4
+    "99999999999999999999999x1"     // Beyond any long
+  };
+  Topology topology;
+  TEST_ASSERT_TRUE(topology.load("32x1"));
+  for (size_t i = 0; i < sizeof(descriptions) / sizeof(descriptions[0]); i++) {
+    TEST_ASSERT_FALSE_MESSAGE(topology.load(descriptions[i]), descriptions[i]);
+  }
+  TEST_ASSERT_EQUAL_STRING("32x1", topology.getDescription());
+  TEST_ASSERT_EQUAL_INT(32 * BLOCK_LEDS, topology.getLedCount());
+}
+
+static void test_largest_sign_loads() {
+  Topology topology;
+  TEST_ASSERT_TRUE(topology.load("512x1"));
+  TEST_ASSERT_EQUAL_INT(TOPOLOGY_MAX_LEDS, topology.getLedCount());
+  TEST_ASSERT_TRUE(topology.load("1x365"));
+  TEST_ASSERT_TRUE(topology.getHeight() <= TOPOLOGY_MAX_HEIGHT);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_row_maps_blocks_in_chain_order);
+  RUN_TEST(test_serpentine_rotated_layout);
+  RUN_TEST(test_every_pixel_maps_to_its_own_led);
+  RUN_TEST(test_malformed_descriptions_are_refused);
+  RUN_TEST(test_oversized_descriptions_are_refused);
+  RUN_TEST(test_largest_sign_loads);
+  return UNITY_END();
+}
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Compare two kernel benchmark or scenario replay runs.
+
+Each file is captured serial output containing a KERNEL BENCHMARK block (see
+include/kernel_benchmark.h) and/or a SCENARIO REPLAY block (see
+include/scenario_replay.h); anything around the blocks is ignored. Prints the
+median time per call of every kernel and the work per simulated minute of
+every scenario in both runs, and the change. Scenarios whose rendered frames
+differ between the runs are marked.
+
+    python3 tools/compare_benchmarks.py before.txt after.txt
+"""
+
+import json
+import sys
+
+# Block name -> (key naming each result, value compared)
+BLOCKS = {
+    "KERNEL BENCHMARK": ("kernel", "ns_per_op"),
+    "SCENARIO REPLAY": ("scenario", "per_minute"),
+}
+
+
+def load(path):
+    # (block, name) -> result, from the last complete block of each kind
+    results = {}
+    current = None
+    pending = {}
+    with open(path, "r", errors="replace") as capture:
+        for line in capture:
+            line = line.strip()
+            for block in BLOCKS:
+                if line.endswith("=== %s BEGIN ===" % block):
+                    current, pending = block, {}
+                elif line.endswith("=== %s END ===" % block) and current == block:
+                    results = {k: v for k, v in results.items() if k[0] != block}
+                    results.update(pending)
+                    current = None
+            if current and line.startswith("{"):
+                result = json.loads(line)
+                pending[(current, result[BLOCKS[current][0]])] = result
+    return results
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__.strip())
+        return 1
+    before = load(sys.argv[1])
+    after = load(sys.argv[2])
+    if not before or not after:
+        print("No complete benchmark block in %s" % (sys.argv[1] if not before else sys.argv[2]))
+        return 1
+
+    print("%-36s %14s %14s %8s" % ("Kernel / scenario", "Before", "After", "Change"))
+    for key in list(before) + [key for key in after if key not in before]:
+        block, name = key
+        metric = BLOCKS[block][1]
+        old = before.get(key)
+        new = after.get(key)
+        if old is None or new is None:
+            value = (old or new)[metric]
+            print("%-36s %14s %14s %8s" % (name, value if old else "-", value if new else "-", "n/a"))
+            continue
+        if old.get("unit") != new.get("unit"):
+            print("%-36s %14s %14s %8s" % (name, old["unit"], new["unit"], "n/a"))
+            continue
+        change = (new[metric] - old[metric]) * 100.0 / old[metric] if old[metric] else 0.0
+        note = ""
+        if old.get("frame_hash") != new.get("frame_hash"):
+            note = "  frames differ"
+        print("%-36s %14d %14d %+7.1f%%%s" % (name, old[metric], new[metric], change, note))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
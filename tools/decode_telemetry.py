@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Decode the binary performance telemetry written by the firmware.
+
+Reads a serial port (needs pyserial) or a captured file, passes ordinary text
+output through, and prints each telemetry record as a performance report.
+The record format is documented in include/telemetry.h.
+
+    python3 tools/decode_telemetry.py /dev/ttyUSB0
+    python3 tools/decode_telemetry.py capture.bin
+"""
+
+import struct
+import sys
+
+MAGIC = b"RT"
+VERSION = 1
+HEADER_SIZE = 7
+
+SECTION_COUNTERS = 1
+SECTION_HISTOGRAM = 2
+SECTION_TIMER = 3
+SECTION_TASK = 4
+SECTION_HEAP = 5
+SECTION_ALLOCATION_SITE = 6
+SECTION_QUALITY = 7
+
+HISTOGRAM_NAMES = {0: "Frame", 1: "Render", 2: "Show"}
+
+
+def bucket_midpoint(bucket, linear, sub_bits):
+    # Mirrors LatencyHistogram::bucketMidpoint()
+    if bucket < linear:
+        return bucket
+    sub_buckets = 1 << sub_bits
+    octave = linear.bit_length() - 1 + (bucket - linear) // sub_buckets
+    sub = (bucket - linear) % sub_buckets
+    width = 1 << (octave - sub_bits)
+    return (sub_buckets + sub) * width + width // 2
+
+
+def percentile(histogram, fraction):
+    total = sum(count for _, count in histogram["buckets"])
+    if total == 0:
+        return 0
+    rank = max(1, int(fraction * total + 0.5))
+    seen = 0
+    for bucket, count in histogram["buckets"]:
+        seen += count
+        if seen >= rank:
+            value = bucket_midpoint(bucket, histogram["linear"], histogram["sub_bits"])
+            return min(value, histogram["max"])
+    return histogram["max"]
+
+
+def parse_named(payload):
+    length = payload[0]
+    name = payload[1:1 + length].decode("ascii", "replace")
+    values = struct.unpack_from("<3I", payload, 1 + length)
+    return name, values
+
+
+def parse_record(sequence, payload):
+    record = {"sequence": sequence, "counters": None, "histograms": [], "timers": [], "tasks": [],
+              "heap": None, "sites": [], "quality": None}
+    pos = 0
+    while pos + 3 <= len(payload):
+        kind, length = struct.unpack_from("<BH", payload, pos)
+        body = payload[pos + 3:pos + 3 + length]
+        pos += 3 + length
+        if kind == SECTION_COUNTERS:
+            record["counters"] = struct.unpack_from("<8I", body)
+        elif kind == SECTION_HISTOGRAM:
+            hid, linear, sub_bits, maximum = struct.unpack_from("<BBBI", body)
+            buckets = [struct.unpack_from("<BH", body, i) for i in range(7, len(body), 3)]
+            record["histograms"].append({"id": hid, "linear": linear, "sub_bits": sub_bits,
+                                         "max": maximum, "buckets": buckets})
+        elif kind == SECTION_TIMER:
+            record["timers"].append(parse_named(body))
+        elif kind == SECTION_TASK:
+            record["tasks"].append(parse_named(body))
+        elif kind == SECTION_HEAP:
+            record["heap"] = struct.unpack_from("<6I", body)
+        elif kind == SECTION_ALLOCATION_SITE:
+            record["sites"].append(parse_named(body))
+        elif kind == SECTION_QUALITY:
+            record["quality"] = struct.unpack_from("<BBI", body)
+        # Unknown sections are skipped
+    return record
+
+
+def print_record(record):
+    print("=== PERFORMANCE REPORT #%d ===" % record["sequence"])
+    if record["counters"]:
+        interval, frames, updates, chars, idle, over, min_frame, max_frame = record["counters"]
+        seconds = interval / 1000.0 or 1.0
+        print("Loop FPS: %.1f | Visual FPS: %.1f | Chars/sec: %.1f" %
+              (frames / seconds, updates / seconds, chars / seconds))
+        duty = max(0.0, 100.0 - idle / (interval * 10.0)) if interval else 0.0
+        print("Duty Cycle: %.1f%% | Idle: %dms" % (duty, idle // 1000))
+    for histogram in record["histograms"]:
+        name = HISTOGRAM_NAMES.get(histogram["id"], "Histogram %d" % histogram["id"])
+        print("%s p50/p95/p99/max: %.2f/%.2f/%.2f/%.2fms" % (
+            name, percentile(histogram, 0.50) / 1000.0, percentile(histogram, 0.95) / 1000.0,
+            percentile(histogram, 0.99) / 1000.0, histogram["max"] / 1000.0))
+    if record["counters"]:
+        print("Frame range: %.2f-%.2fms | Over budget: %d" % (min_frame / 1000.0, max_frame / 1000.0, over))
+    if record["quality"]:
+        level, lowest, changes = record["quality"]
+        print("Quality: level %d of %d | Changes: %d" % (level, lowest, changes))
+    if record["timers"]:
+        print("Timers: " + " | ".join("%s %.2f/%.2fms x%d" % (name, total / 1000.0 / calls, maximum / 1000.0, calls)
+                                      for name, (total, calls, maximum) in record["timers"]))
+    if record["heap"]:
+        allocations, size, frees, allocating, free_heap, largest = record["heap"]
+        print("Allocations: %d (%d bytes) | Frees: %d | Allocating frames: %d" % (allocations, size, frees, allocating))
+        if free_heap:
+            print("Heap free: %d | Largest block: %d" % (free_heap, largest))
+    if record["sites"]:
+        print("Frame allocs: " + " | ".join("%s %.2f/frame %dB/frame x%d" % (name, allocations / float(frames), size // frames, frames)
+                                            for name, (frames, allocations, size) in record["sites"] if frames))
+    if record["tasks"] and record["counters"] and record["counters"][0]:
+        interval = record["counters"][0]
+        print("Tasks: " + " | ".join("%s %.1f%% %d steps max %.2fms" % (name, busy / (interval * 10.0), steps, maximum / 1000.0)
+                                     for name, (busy, steps, maximum) in record["tasks"]))
+    print("========================")
+    sys.stdout.flush()
+
+
+def decode(read):
+    # read() returns b"" when no data arrived yet and None at end of input
+    buffer = bytearray()
+    while True:
+        chunk = read()
+        if chunk is None:
+            break
+        buffer += chunk
+        while True:
+            start = buffer.find(MAGIC)
+            if start < 0:
+                # Keep a trailing 'R' that may start the next record
+                keep = 1 if buffer.endswith(MAGIC[:1]) else 0
+                sys.stdout.write(buffer[:len(buffer) - keep].decode("utf-8", "replace"))
+                del buffer[:len(buffer) - keep]
+                break
+            sys.stdout.write(buffer[:start].decode("utf-8", "replace"))
+            del buffer[:start]
+            if len(buffer) < HEADER_SIZE:
+                break
+            version, sequence, length = struct.unpack_from("<BHH", buffer, 2)
+            total = HEADER_SIZE + length + 1
+            if version != VERSION:
+                # Not a record after all (or one this decoder cannot read) - treat as text
+                sys.stdout.write(buffer[:1].decode("utf-8", "replace"))
+                del buffer[:1]
+                continue
+            if len(buffer) < total:
+                break
+            checksum = 0
+            for byte in buffer[:total - 1]:
+                checksum ^= byte
+            if checksum != buffer[total - 1]:
+                sys.stdout.write(buffer[:1].decode("utf-8", "replace"))
+                del buffer[:1]
+                continue
+            print_record(parse_record(sequence, bytes(buffer[HEADER_SIZE:total - 1])))
+            del buffer[:total]
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__.strip())
+        return 1
+    path = sys.argv[1]
+    if path.startswith("/dev/") or path.upper().startswith("COM"):
+        import serial
+        port = serial.Serial(path, 115200, timeout=1)
+        decode(lambda: port.read(port.in_waiting or 1))
+    else:
+        with open(path, "rb") as capture:
+            decode(lambda: capture.read(4096) or None)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Extract golden frame output from a serial capture.
+
+    python3 tools/golden_frames.py update capture.txt [header]
+        Write the table printed by 'g' (GOLDEN FRAMES block) to the header,
+        by default the one for the platform it was recorded on
+        (include/golden_frame_table_<platform>.h).
+
+    python3 tools/golden_frames.py dumps capture.txt [directory]
+        Save every frame dumped by 'G' (FRAME DUMP blocks) as a PPM image,
+        named after its case and frame number.
+
+See include/golden_frames.h for the check itself.
+"""
+
+import os
+import re
+import sys
+
+TABLE_BEGIN = "=== GOLDEN FRAMES BEGIN ==="
+TABLE_END = "=== GOLDEN FRAMES END ==="
+DUMP_BEGIN = re.compile(r"=== FRAME DUMP BEGIN (.*) frame (\d+) ===$")
+DUMP_END = "=== FRAME DUMP END ==="
+TABLE_PLATFORM = re.compile(r'#define GOLDEN_TABLE_PLATFORM "(\w+)"')
+
+
+def blocks(path, is_begin, end):
+    # (begin line match, lines) for every complete block in the capture
+    found = []
+    current = None
+    with open(path, "r", errors="replace") as capture:
+        for line in capture:
+            line = line.rstrip("\r\n")
+            if current is None:
+                match = is_begin(line)
+                if match:
+                    current = (match, [])
+            elif line.endswith(end):
+                found.append(current)
+                current = None
+            else:
+                current[1].append(line)
+    return found
+
+
+def update(path, header):
+    found = blocks(path, lambda line: line.endswith(TABLE_BEGIN), TABLE_END)
+    if not found:
+        print("No complete golden frame table in %s" % path)
+        return 1
+    if header is None:
+        platform = next((m.group(1) for m in map(TABLE_PLATFORM.search, found[-1][1]) if m), None)
+        if platform is None:
+            print("The table in %s does not name its platform" % path)
+            return 1
+        header = "include/golden_frame_table_%s.h" % platform
+    with open(header, "w") as out:
+        out.write("\n".join(found[-1][1]) + "\n")
+    print("Wrote %s" % header)
+    return 0
+
+
+def dumps(path, directory):
+    found = blocks(path, lambda line: DUMP_BEGIN.search(line), DUMP_END)
+    if not found:
+        print("No frame dumps in %s" % path)
+        return 1
+    os.makedirs(directory, exist_ok=True)
+    for match, lines in found:
+        name = re.sub(r"[^A-Za-z0-9]+", "_", match.group(1)).strip("_").lower()
+        filename = os.path.join(directory, "%s_frame%s.ppm" % (name, match.group(2)))
+        with open(filename, "w") as out:
+            out.write("\n".join(lines) + "\n")
+        print("Wrote %s" % filename)
+    return 0
+
+
+def main():
+    if len(sys.argv) < 3 or sys.argv[1] not in ("update", "dumps"):
+        print(__doc__.strip())
+        return 1
+    if sys.argv[1] == "update":
+        return update(sys.argv[2], sys.argv[3] if len(sys.argv) > 3 else None)
+    return dumps(sys.argv[2], sys.argv[3] if len(sys.argv) > 3 else ".")
+
+
+if __name__ == "__main__":
+    sys.exit(main())